@@ -18,6 +18,7 @@
 #include "archival/types.h"
 #include "cloud_storage/partition_manifest.h"
 #include "cloud_storage/remote.h"
+#include "cloud_storage/remote_segment_index.h"
 #include "cloud_storage/topic_manifest.h"
 #include "cloud_storage/tx_range_manifest.h"
 #include "cloud_storage/types.h"
@@ -31,6 +32,7 @@
 #include "storage/parser.h"
 #include "utils/human.h"
 #include "utils/retry_chain_node.h"
+#include "utils/stream_utils.h"
 
 #include <seastar/core/abort_source.hh>
 #include <seastar/core/coroutine.hh>
@@ -84,6 +86,10 @@ ntp_archiver::ntp_archiver(
   , _max_segments_pending_deletion(
       config::shard_local_cfg()
         .cloud_storage_max_segments_pending_deletion_per_partition.bind())
+  , _catchup_batch_size(
+      config::shard_local_cfg().cloud_storage_upload_catchup_batch_size.bind())
+  , _catchup_concurrency(
+      config::shard_local_cfg().cloud_storage_upload_catchup_concurrency.bind())
   , _housekeeping_interval(
       config::shard_local_cfg().cloud_storage_housekeeping_interval_ms.bind())
   , _housekeeping_jitter(_housekeeping_interval(), 5ms)
@@ -95,7 +101,11 @@ ntp_archiver::ntp_archiver(
   , _local_segment_merger(
       maybe_make_adjacent_segment_merger(*this, _rtclog, parent.log().config()))
   , _segment_merging_enabled(
-      config::shard_local_cfg().cloud_storage_enable_segment_merging.bind()) {
+      config::shard_local_cfg().cloud_storage_enable_segment_merging.bind())
+  , _binary_manifest_enabled(
+      config::shard_local_cfg().cloud_storage_enable_binary_manifest.bind())
+  , _spillover_manifest_size(
+      config::shard_local_cfg().cloud_storage_spillover_manifest_size.bind()) {
     _start_term = _parent.term();
     // Override bucket for read-replica
     if (_parent.is_read_replica_mode_enabled()) {
@@ -110,6 +120,13 @@ ntp_archiver::ntp_archiver(
         });
     }
 
+    _binary_manifest_enabled.watch([this] {
+        // Any replica could have uploaded the manifest in the other format
+        // while it was the leader.
+        _binary_manifest_stale = true;
+        _json_manifest_stale = true;
+    });
+
     vlog(
       archival_log.debug,
       "created ntp_archiver {} in term {}",
@@ -531,6 +548,24 @@ ss::future<cloud_storage::download_result> ntp_archiver::sync_manifest() {
         // otherwise the read-replica will be able to see partial update. Also,
         // the batching is more efficient.
         auto builder = _parent.archival_meta_stm()->batch_start(deadline, _as);
+        // Spillover manifests removed by retention on the source cluster
+        // are dropped in order. The segments are owned by the source
+        // cluster so the list of segments to remove is empty.
+        auto new_archive_start = m.get_archive_start_offset().value_or(
+          new_start_offset.value_or(model::offset{}));
+        for (const auto& s : manifest().get_spillover_map()) {
+            if (s.base_offset >= new_archive_start) {
+                break;
+            }
+            builder.drop_spillover(s, {});
+        }
+        // The spillover manifests precede the segments of the manifest
+        // so they have to be applied first.
+        for (const auto& s : m.get_spillover_map()) {
+            if (!manifest().get_spillover_map().contains(s.base_offset)) {
+                builder.spillover(s);
+            }
+        }
         builder.add_segments(std::move(mdiff));
         if (
           new_start_offset.has_value() && old_start_offset.has_value()
@@ -619,12 +654,9 @@ ntp_archiver::download_manifest() {
       _conf->cloud_storage_initial_backoff,
       &_rtcnode);
     cloud_storage::partition_manifest tmp(_ntp, _rev);
-    auto path = tmp.get_manifest_path();
-    auto key = cloud_storage::remote_manifest_path(
-      std::filesystem::path(std::move(path)));
     vlog(_rtclog.debug, "Downloading manifest");
-    auto result = co_await _remote.download_manifest(
-      get_bucket_name(), key, tmp, fib);
+    auto result = co_await _remote.download_partition_manifest(
+      get_bucket_name(), tmp, fib);
 
     // It's OK if the manifest is not found for a newly created topic. The
     // condition in if statement is not guaranteed to cover all cases for new
@@ -654,13 +686,43 @@ ss::future<cloud_storage::upload_result> ntp_archiver::upload_manifest(
       _conf->cloud_storage_initial_backoff,
       &rtc.get());
     retry_chain_logger ctxlog(archival_log, fib, _ntp.path());
+    // The binary manifest can only be uploaded once every node is able
+    // to read it. The references to the spillover manifests can only be
+    // encoded using the binary format.
+    const bool binary_supported = _parent.feature_table().is_active(
+      features::feature::cloud_storage_manifest_format_v2);
+    const bool binary_required = !manifest().get_spillover_map().empty();
+    auto format = binary_supported
+                      && (_binary_manifest_enabled() || binary_required)
+                    ? cloud_storage::manifest_format::serde
+                    : cloud_storage::manifest_format::json;
     vlog(
       ctxlog.debug,
       "Uploading manifest, path: {}",
-      manifest().get_manifest_path());
+      manifest().get_manifest_path(format));
     auto units = co_await _parent.archival_meta_stm()->acquire_manifest_lock();
-    co_return co_await _remote.upload_manifest(
-      get_bucket_name(), manifest(), fib, _manifest_tags);
+    auto res = co_await _remote.upload_manifest(
+      get_bucket_name(), manifest(), format, fib, _manifest_tags);
+    if (res != cloud_storage::upload_result::success) {
+        co_return res;
+    }
+    const bool serde = format == cloud_storage::manifest_format::serde;
+    if (serde) {
+        _binary_manifest_stale = true;
+    } else {
+        _json_manifest_stale = true;
+    }
+    auto& stale = serde ? _json_manifest_stale : _binary_manifest_stale;
+    if (stale) {
+        auto path = manifest().get_manifest_path(
+          serde ? cloud_storage::manifest_format::json
+                : cloud_storage::manifest_format::serde);
+        vlog(ctxlog.debug, "Removing stale manifest {}", path);
+        auto del = co_await _remote.delete_object(
+          get_bucket_name(), cloud_storage_clients::object_key(path()), fib);
+        stale = del != cloud_storage::upload_result::success;
+    }
+    co_return res;
 }
 
 remote_segment_path
@@ -687,6 +749,7 @@ ntp_archiver::segment_path_for_candidate(const upload_candidate& candidate) {
 // from offset to offset (by record batch boundary)
 ss::future<cloud_storage::upload_result> ntp_archiver::upload_segment(
   upload_candidate candidate,
+  model::offset_delta delta,
   std::optional<std::reference_wrapper<retry_chain_node>> source_rtc) {
     vassert(
       candidate.remote_sources.empty(),
@@ -706,25 +769,106 @@ ss::future<cloud_storage::upload_result> ntp_archiver::upload_segment(
       [this]() { return upload_should_abort(); },
     };
 
+    // The segment index is built from a copy of the stream which is being
+    // uploaded so the segment is only read once. Every upload attempt
+    // builds its own index.
+    struct index_builder {
+        ss::lw_shared_ptr<cloud_storage::offset_index> ix;
+        ss::future<bool> done;
+    };
+    std::vector<index_builder> builders;
+
     auto reset_func =
-      [this,
-       candidate]() -> ss::future<std::unique_ptr<storage::stream_provider>> {
+      [this, &candidate, &builders, &ctxlog, delta]()
+      -> ss::future<std::unique_ptr<storage::stream_provider>> {
+        storage::concat_segment_reader_view reader(
+          candidate.sources,
+          candidate.file_offset,
+          candidate.final_file_offset,
+          _conf->upload_io_priority);
+        auto [upload_stream, index_stream] = input_stream_fanout<2>(
+          reader.take_stream(), 1);
+        auto ix = ss::make_lw_shared<cloud_storage::offset_index>(
+          candidate.starting_offset,
+          candidate.starting_offset - delta,
+          0,
+          cloud_storage::remote_segment_sampling_step_bytes);
+        auto parser = cloud_storage::make_remote_segment_index_builder(
+          std::move(index_stream),
+          *ix,
+          delta,
+          cloud_storage::remote_segment_sampling_step_bytes);
+        auto done = parser->consume()
+                      .finally([parser] { return parser->close(); })
+                      .then_wrapped([&ctxlog](auto f) {
+                          try {
+                              auto res = f.get();
+                              if (res.has_error()) {
+                                  vlog(
+                                    ctxlog.warn,
+                                    "Failed to build segment index: {}",
+                                    res.error().message());
+                                  return false;
+                              }
+                              return true;
+                          } catch (...) {
+                              vlog(
+                                ctxlog.warn,
+                                "Failed to build segment index: {}",
+                                std::current_exception());
+                              return false;
+                          }
+                      });
+        builders.push_back(
+          index_builder{.ix = std::move(ix), .done = std::move(done)});
         return ss::make_ready_future<std::unique_ptr<storage::stream_provider>>(
-          std::make_unique<storage::concat_segment_reader_view>(
-            candidate.sources,
-            candidate.file_offset,
-            candidate.final_file_offset,
-            _conf->upload_io_priority));
+          std::make_unique<storage::segment_reader_handle>(
+            std::move(upload_stream)));
     };
 
-    co_return co_await _remote.upload_segment(
-      get_bucket_name(),
-      path,
-      candidate.content_length,
-      reset_func,
-      fib,
-      lazy_abort_source,
-      _segment_tags);
+    auto result = cloud_storage::upload_result::failed;
+    std::exception_ptr error;
+    try {
+        result = co_await _remote.upload_segment(
+          get_bucket_name(),
+          path,
+          candidate.content_length,
+          reset_func,
+          fib,
+          lazy_abort_source,
+          _segment_tags);
+    } catch (...) {
+        error = std::current_exception();
+    }
+
+    // Only the index of the last attempt matches the uploaded segment
+    bool index_ready = false;
+    for (auto& b : builders) {
+        index_ready = co_await std::move(b.done);
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+
+    if (result == cloud_storage::upload_result::success && index_ready) {
+        // The index is an optimization, the readers download the whole
+        // segment if it's missing. Its failure doesn't fail the upload.
+        auto index_path = cloud_storage::generate_remote_index_path(path);
+        auto index_res = co_await _remote.upload_object(
+          get_bucket_name(),
+          cloud_storage_clients::object_key(index_path()),
+          builders.back().ix->to_iobuf(),
+          fib,
+          _segment_tags);
+        if (index_res != cloud_storage::upload_result::success) {
+            vlog(
+              ctxlog.warn,
+              "Failed to upload segment index {}: {}",
+              index_path,
+              index_res);
+        }
+    }
+    co_return result;
 }
 
 std::optional<ss::sstring> ntp_archiver::upload_should_abort() {
@@ -845,7 +989,6 @@ ntp_archiver::schedule_single_upload(const upload_context& upload_ctx) {
           .name = std::nullopt,
           .delta = std::nullopt,
           .stop = ss::stop_iteration::yes,
-          .segment_read_locks = {},
         };
     }
 
@@ -860,13 +1003,26 @@ ntp_archiver::schedule_single_upload(const upload_context& upload_ctx) {
                               ot_state->from_log_offset(upload.final_offset));
 
     // The upload is successful only if both segment and tx_range are uploaded.
-    std::vector<ss::future<cloud_storage::upload_result>> all_uploads;
-    all_uploads.emplace_back(upload_segment(upload));
-    if (upload_ctx.upload_kind == segment_upload_kind::non_compacted) {
-        all_uploads.emplace_back(upload_tx(upload));
-    }
+    auto start_upload = [this, upload, delta, kind = upload_ctx.upload_kind] {
+        std::vector<ss::future<cloud_storage::upload_result>> all_uploads;
+        all_uploads.emplace_back(upload_segment(upload, delta));
+        if (kind == segment_upload_kind::non_compacted) {
+            all_uploads.emplace_back(upload_tx(upload));
+        }
+        return aggregate_upload_results(std::move(all_uploads));
+    };
 
-    auto upl_fut = aggregate_upload_results(std::move(all_uploads));
+    ss::future<cloud_storage::upload_result> upl_fut
+      = upload_ctx.upload_window
+          ? ss::with_semaphore(
+              *upload_ctx.upload_window, 1, std::move(start_upload))
+              .finally([w = upload_ctx.upload_window] {})
+          : start_upload();
+    // The read locks protect the segments from being deleted while they're
+    // uploaded. They're released as soon as the upload completes rather than
+    // when all uploads of the batch complete, so a large catch-up batch
+    // doesn't block the housekeeping of the segments which are uploaded.
+    upl_fut = std::move(upl_fut).finally([locks = std::move(locks)] {});
 
     auto is_compacted = first_source->is_compacted_segment()
                         && first_source->finished_self_compaction();
@@ -889,7 +1045,6 @@ ntp_archiver::schedule_single_upload(const upload_context& upload_ctx) {
       },
       .name = upload.exposed_name, .delta = offset - base,
       .stop = ss::stop_iteration::no,
-      .segment_read_locks = std::move(locks),
     };
 }
 
@@ -938,7 +1093,23 @@ ss::future<std::vector<ntp_archiver::scheduled_upload>>
 ntp_archiver::schedule_uploads(std::vector<upload_context> loop_contexts) {
     std::vector<scheduled_upload> scheduled_uploads;
     auto uploads_remaining = _concurrency;
+    ss::lw_shared_ptr<ssx::semaphore> upload_window;
+    if (_upload_catchup && _catchup_batch_size() > _concurrency) {
+        // The partition lags behind. Select a larger batch of candidates
+        // and upload them through a bounded window. The uploaded segments
+        // are added to the manifest in order by a single STM command
+        // instead of one command per '_concurrency' segments.
+        vlog(
+          _rtclog.debug,
+          "catch-up mode, scheduling up to {} uploads, {} concurrently",
+          _catchup_batch_size(),
+          _catchup_concurrency());
+        uploads_remaining = _catchup_batch_size();
+        upload_window = ss::make_lw_shared<ssx::semaphore>(
+          _catchup_concurrency(), "archive/catchup");
+    }
     for (auto& ctx : loop_contexts) {
+        ctx.upload_window = upload_window;
         if (uploads_remaining <= 0) {
             vlog(
               _rtclog.info,
@@ -985,6 +1156,11 @@ ntp_archiver::schedule_uploads(std::vector<upload_context> loop_contexts) {
           ctx.uploads.begin(), ctx.uploads.end(), [](const auto& upload) {
               return upload.result.has_value();
           });
+        if (ctx.upload_kind == segment_upload_kind::non_compacted) {
+            // If all upload slots were used there is likely more data
+            // to upload
+            _upload_catchup = uploads_remaining == 0;
+        }
         vlog(
           _rtclog.debug,
           "scheduled {} uploads for upload kind: {}, uploads remaining: "
@@ -1307,7 +1483,10 @@ ss::future<> ntp_archiver::housekeeping() {
             auto units = co_await ss::get_units(_mutex, 1, _as);
             const auto retention_updated_manifest = co_await apply_retention();
             const auto gc_updated_manifest = co_await garbage_collect();
-            if (retention_updated_manifest || gc_updated_manifest) {
+            const auto spillover_updated_manifest = co_await apply_spillover();
+            if (
+              retention_updated_manifest || gc_updated_manifest
+              || spillover_updated_manifest) {
                 co_await upload_manifest();
             }
         }
@@ -1330,7 +1509,29 @@ ss::future<ntp_archiver::manifest_updated> ntp_archiver::apply_retention() {
     }
 
     auto next_start_offset = retention_calculator->next_start_offset();
-    if (next_start_offset) {
+    if (
+      next_start_offset && manifest().get_archive_start_offset().has_value()
+      && *next_start_offset > *manifest().get_archive_start_offset()) {
+        vlog(
+          _rtclog.debug,
+          "{} Removing spillover manifests below {} to satisfy retention "
+          "policy",
+          retention_calculator->strategy_name(),
+          *next_start_offset);
+        updated = co_await drop_spillover_manifests(*next_start_offset);
+    }
+    if (next_start_offset && !manifest().get_spillover_map().empty()) {
+        // The start offset of the manifest can only be advanced once all
+        // spillover manifests are removed, otherwise the log would have a
+        // gap between the last spillover manifest and the manifest.
+        vlog(
+          _rtclog.debug,
+          "{} Retention policies are met by removing spillover manifests",
+          retention_calculator->strategy_name());
+    } else if (
+      next_start_offset
+      && *next_start_offset
+           > manifest().get_start_offset().value_or(model::offset{})) {
         vlog(
           _rtclog.debug,
           "{} Advancing start offset to {} satisfy retention policy",
@@ -1441,6 +1642,149 @@ ss::future<ntp_archiver::manifest_updated> ntp_archiver::garbage_collect() {
     co_return updated;
 }
 
+ss::future<ntp_archiver::manifest_updated> ntp_archiver::apply_spillover() {
+    manifest_updated updated = manifest_updated::no;
+
+    const auto max_segments = _spillover_manifest_size();
+    if (
+      !may_begin_uploads() || !max_segments.has_value() || *max_segments == 0
+      || !_parent.feature_table().is_active(
+        features::feature::cloud_storage_manifest_format_v2)
+      || !_parent.feature_table().is_active(
+        features::feature::cloud_storage_manifest_spillover)) {
+        co_return updated;
+    }
+
+    while (manifest().size() > *max_segments && may_begin_uploads()) {
+        if (
+          manifest().get_start_offset()
+          != manifest().begin()->second.base_offset) {
+            // Segments below the start offset have to be garbage
+            // collected first.
+            break;
+        }
+        auto spillover = manifest().make_spillover_manifest(*max_segments);
+        auto spillover_meta = spillover.make_manifest_metadata();
+        vlog(
+          _rtclog.info,
+          "Moving {} segments with offset range {}-{} to spillover manifest",
+          spillover.size(),
+          spillover_meta.base_offset,
+          spillover_meta.committed_offset);
+
+        retry_chain_node fib(
+          _conf->manifest_upload_timeout,
+          _conf->cloud_storage_initial_backoff,
+          &_rtcnode);
+        auto res = co_await _remote.upload_spillover_manifest(
+          get_bucket_name(), spillover, fib, _manifest_tags);
+        if (res != cloud_storage::upload_result::success) {
+            vlog(
+              _rtclog.warn,
+              "Failed to upload spillover manifest {}: {}",
+              spillover.get_spillover_manifest_path(spillover_meta),
+              res);
+            break;
+        }
+
+        auto sync_timeout = config::shard_local_cfg()
+                              .cloud_storage_metadata_sync_timeout_ms.value();
+        auto deadline = ss::lowres_clock::now() + sync_timeout;
+        auto builder = _parent.archival_meta_stm()->batch_start(deadline, _as);
+        builder.spillover(spillover_meta);
+        auto error = co_await builder.replicate();
+        if (error) {
+            vlog(
+              _rtclog.warn,
+              "Failed to replicate spillover command: {}",
+              error.message());
+            break;
+        }
+        updated = manifest_updated::yes;
+    }
+
+    co_return updated;
+}
+
+ss::future<ntp_archiver::manifest_updated>
+ntp_archiver::drop_spillover_manifests(model::offset next_start_offset) {
+    manifest_updated updated = manifest_updated::no;
+    while (!manifest().get_spillover_map().empty() && may_begin_uploads()) {
+        auto spillover_meta = *manifest().get_spillover_map().begin();
+        if (spillover_meta.committed_offset >= next_start_offset) {
+            break;
+        }
+        auto path = manifest().get_spillover_manifest_path(spillover_meta);
+
+        // The segments referenced by the spillover manifest have to be
+        // garbage collected so the manifest is downloaded before its
+        // metadata is removed.
+        retry_chain_node fib(
+          _conf->manifest_upload_timeout,
+          _conf->cloud_storage_initial_backoff,
+          &_rtcnode);
+        cloud_storage::partition_manifest spillover(
+          _ntp, manifest().get_revision_id());
+        auto res = co_await _remote.download_manifest(
+          get_bucket_name(), path, spillover, fib);
+        fragmented_vector<cloud_storage::segment_meta> segments;
+        if (res == cloud_storage::download_result::success) {
+            for (const auto& s : spillover) {
+                segments.push_back(s.second);
+            }
+        } else if (res == cloud_storage::download_result::notfound) {
+            vlog(
+              _rtclog.warn,
+              "Spillover manifest {} not found, the segments it references "
+              "will not be deleted",
+              path);
+        } else {
+            vlog(
+              _rtclog.warn,
+              "Failed to download spillover manifest {}: {}",
+              path,
+              res);
+            break;
+        }
+
+        vlog(
+          _rtclog.info,
+          "Removing spillover manifest {} with offset range {}-{} and {} "
+          "segments",
+          path,
+          spillover_meta.base_offset,
+          spillover_meta.committed_offset,
+          segments.size());
+        auto sync_timeout = config::shard_local_cfg()
+                              .cloud_storage_metadata_sync_timeout_ms.value();
+        auto deadline = ss::lowres_clock::now() + sync_timeout;
+        auto builder = _parent.archival_meta_stm()->batch_start(deadline, _as);
+        builder.drop_spillover(spillover_meta, std::move(segments));
+        auto error = co_await builder.replicate();
+        if (error) {
+            vlog(
+              _rtclog.warn,
+              "Failed to replicate drop spillover command: {}",
+              error.message());
+            break;
+        }
+        updated = manifest_updated::yes;
+
+        // The spillover manifest is no longer referenced, its segments are
+        // removed by the garbage collection.
+        auto del = co_await _remote.delete_object(
+          get_bucket_name(), cloud_storage_clients::object_key{path()}, fib);
+        if (del != cloud_storage::upload_result::success) {
+            vlog(
+              _rtclog.warn,
+              "Failed to delete spillover manifest {}: {}",
+              path,
+              del);
+        }
+    }
+    co_return updated;
+}
+
 ss::future<cloud_storage::upload_result>
 ntp_archiver::delete_segment(const remote_segment_path& path) {
     _as.check();
@@ -1460,6 +1804,11 @@ ntp_archiver::delete_segment(const remote_segment_path& path) {
           _conf->bucket_name,
           cloud_storage_clients::object_key{tx_range_manifest_path},
           fib);
+        auto index_path = cloud_storage::generate_remote_index_path(path);
+        co_await _remote.delete_object(
+          get_bucket_name(),
+          cloud_storage_clients::object_key{index_path()},
+          fib);
     }
 
     co_return res;
@@ -1576,7 +1925,7 @@ ss::future<bool> ntp_archiver::do_upload_local(
 
     // Upload segments and tx-manifest in parallel
     std::vector<ss::future<cloud_storage::upload_result>> futures;
-    futures.emplace_back(upload_segment(upload, source_rtc));
+    futures.emplace_back(upload_segment(upload, delta, source_rtc));
     futures.emplace_back(upload_tx(upload, source_rtc));
     auto upl_res = co_await aggregate_upload_results(std::move(futures));
 
@@ -146,6 +146,12 @@ public:
     /// that have been replaced with their compacted equivalent.
     ss::future<manifest_updated> garbage_collect();
 
+    /// \brief Move the oldest segments of the manifest to the spillover
+    /// manifests if the manifest grew above the configured limit. Every
+    /// spillover manifest is uploaded before the segments are removed from
+    /// the manifest.
+    ss::future<manifest_updated> apply_spillover();
+
     virtual ~ntp_archiver() = default;
 
     /**
@@ -262,9 +268,6 @@ private:
         /// case the upload is not started but the method might be called
         /// again anyway.
         ss::stop_iteration stop;
-        /// Protects the underlying segment(s) from being deleted while the
-        /// upload is in flight.
-        std::vector<ss::rwlock::holder> segment_read_locks;
         segment_upload_kind upload_kind;
     };
 
@@ -286,6 +289,9 @@ private:
         allow_reuploads_t allow_reuploads;
         /// Collection of uploads scheduled so far
         std::vector<scheduled_upload> uploads{};
+        /// Limits the number of concurrent uploads in the catch-up mode,
+        /// not set if all scheduled uploads are started immediately
+        ss::lw_shared_ptr<ssx::semaphore> upload_window{};
 
         /// Schedules a single upload, adds it to upload collection and
         /// progresses the start offset
@@ -326,12 +332,19 @@ private:
 
     /// Upload individual segment to S3.
     ///
+    /// The segment index, which is used by the readers to download only the
+    /// chunks of the segment they need, is built while the segment is
+    /// uploaded and is uploaded after it. Failure to upload the index
+    /// doesn't fail the segment upload.
+    ///
     /// \param candidate is an upload candidate
+    /// \param delta is the offset delta at the beginning of the segment
     /// \param source_rtc is a retry_chain_node of the caller, if it's set
     ///        to nullopt own retry chain of the ntp_archiver is used
     /// \return error code
     ss::future<cloud_storage::upload_result> upload_segment(
       upload_candidate candidate,
+      model::offset_delta delta,
       std::optional<std::reference_wrapper<retry_chain_node>> source_rtc
       = std::nullopt);
 
@@ -377,6 +390,13 @@ private:
     ss::future<cloud_storage::upload_result>
     delete_segment(const remote_segment_path& path);
 
+    /// Remove the spillover manifests which end below the new start
+    /// offset. Segments of the removed spillover manifests are added
+    /// to the garbage collection backlog and the spillover manifests
+    /// are deleted from S3.
+    ss::future<manifest_updated>
+    drop_spillover_manifests(model::offset next_start_offset);
+
     void update_probe();
 
     /// Return true if archival metadata can be replicated.
@@ -419,6 +439,12 @@ private:
     config::binding<size_t> _max_segments_pending_deletion;
     simple_time_jitter<ss::lowres_clock> _backoff_jitter{100ms};
     size_t _concurrency{4};
+    // Set when the last upload iteration used all available upload slots,
+    // in this case the next iteration schedules a larger batch of uploads
+    // to catch up with the log.
+    bool _upload_catchup{false};
+    config::binding<size_t> _catchup_batch_size;
+    config::binding<size_t> _catchup_concurrency;
     ss::lowres_clock::time_point _last_upload_time;
 
     // Used during leadership transfer: instructs the archiver to
@@ -451,6 +477,17 @@ private:
     // NTP level adjacent segment merging job
     std::unique_ptr<housekeeping_job> _local_segment_merger;
     config::binding<bool> _segment_merging_enabled;
+
+    config::binding<bool> _binary_manifest_enabled;
+    // Only one manifest object should exist in the bucket. Once the manifest
+    // is uploaded in one format the object in the other format is stale and
+    // has to be removed, otherwise it could shadow the fresh one. Any replica
+    // could have uploaded the other format while it was the leader so both
+    // flags start set. Deleting a missing object is not an error.
+    bool _binary_manifest_stale{true};
+    bool _json_manifest_stale{true};
+
+    config::binding<std::optional<size_t>> _spillover_manifest_size;
 };
 
 } // namespace archival
@@ -78,10 +78,18 @@ std::optional<retention_calculator> retention_calculator::factory(
           model::timestamp::now().value()
           - ntp_config.retention_duration()->count()};
 
+        // The oldest data is stored in the spillover manifests
+        std::optional<model::timestamp> oldest_timestamp;
+        if (!manifest.get_spillover_map().empty()) {
+            oldest_timestamp
+              = manifest.get_spillover_map().begin()->max_timestamp;
+        } else if (manifest.size() > 0) {
+            oldest_timestamp = manifest.begin()->second.max_timestamp;
+        }
+
         if (
-          manifest.size() > 0
-          && manifest.begin()->second.max_timestamp
-               < oldest_allowed_timestamp) {
+          oldest_timestamp.has_value()
+          && *oldest_timestamp < oldest_allowed_timestamp) {
             strats.push_back(
               std::make_unique<time_based_strategy>(oldest_allowed_timestamp));
         }
@@ -101,15 +109,35 @@ retention_calculator::retention_calculator(
   , _strategies(std::move(strategies)) {}
 
 std::optional<model::offset> retention_calculator::next_start_offset() {
+    auto done = [this](const cloud_storage::segment_meta& meta) {
+        return std::all_of(
+          _strategies.begin(), _strategies.end(), [&](auto& strat) {
+              return strat->done(meta);
+          });
+    };
+
+    // The spillover manifests contain the oldest part of the log. They can
+    // only be removed as a whole so every spillover manifest is treated as
+    // a single segment.
+    for (const auto& meta : _manifest.get_spillover_map()) {
+        if (done(meta)) {
+            return meta.base_offset;
+        }
+    }
+
     auto it = std::find_if(
-      _manifest.begin(), _manifest.end(), [this](const auto& entry) -> bool {
-          return std::all_of(
-            _strategies.begin(), _strategies.end(), [&](auto& strat) {
-                return strat->done(entry.second);
-            });
+      _manifest.begin(), _manifest.end(), [&done](const auto& entry) -> bool {
+          return done(entry.second);
       });
 
     if (it == _manifest.end()) {
+        if (_manifest.size() == 0) {
+            auto last = _manifest.get_spillover_map().last_segment();
+            if (!last.has_value()) {
+                return std::nullopt;
+            }
+            return model::next_offset(last->committed_offset);
+        }
         return model::next_offset(std::prev(it)->second.committed_offset);
     }
 
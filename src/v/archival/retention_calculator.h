@@ -37,6 +37,9 @@ public:
     static std::optional<retention_calculator> factory(
       const cloud_storage::partition_manifest&, const storage::ntp_config&);
 
+    /// Compute the next start offset of the cloud log. If the offset is
+    /// below the start of the manifest the spillover manifests below it
+    /// have to be removed.
     std::optional<model::offset> next_start_offset();
 
     std::optional<ss::sstring> strategy_name() const;
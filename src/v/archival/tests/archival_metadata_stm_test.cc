@@ -333,7 +333,7 @@ FIXTURE_TEST(
     BOOST_REQUIRE_EQUAL(backlog.size(), 1);
     auto name = cloud_storage::generate_local_segment_name(
       backlog[0].base_offset, backlog[0].segment_term);
-    BOOST_REQUIRE(pm.get(name) != nullptr);
+    BOOST_REQUIRE(pm.get(name).has_value());
     BOOST_REQUIRE(backlog[0] == lw_segment_meta::convert(*pm.get(name)));
 
     // Truncate the STM, next segment should be added to the backlog
@@ -346,7 +346,7 @@ FIXTURE_TEST(
     for (const auto& it : backlog) {
         auto name = cloud_storage::generate_local_segment_name(
           it.base_offset, it.segment_term);
-        BOOST_REQUIRE(pm.get(name) != nullptr);
+        BOOST_REQUIRE(pm.get(name).has_value());
         BOOST_REQUIRE(it == lw_segment_meta::convert(*pm.get(name)));
     }
 }
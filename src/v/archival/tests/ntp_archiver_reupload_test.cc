@@ -311,7 +311,8 @@ FIXTURE_TEST(test_upload_compacted_segments, reupload_fixture) {
     // Upload two non compacted segments, no segment is compacted yet.
     auto expected = archival::ntp_archiver::batch_result{{2, 0, 0}, {0, 0, 0}};
     upload_and_verify(archiver.value(), expected);
-    BOOST_REQUIRE_EQUAL(get_requests().size(), 3);
+    // The first manifest upload removes a stale manifest.bin
+    BOOST_REQUIRE_EQUAL(get_requests().size(), 4);
 
     auto manifest = verify_manifest_request(*part);
     verify_segment_request("0-1-v1.log", manifest);
@@ -382,7 +383,8 @@ FIXTURE_TEST(test_upload_compacted_segments_concat, reupload_fixture) {
     // Upload two non compacted segments, no segment is compacted yet.
     archival::ntp_archiver::batch_result expected{{2, 0, 0}, {0, 0, 0}};
     upload_and_verify(archiver.value(), expected);
-    BOOST_REQUIRE_EQUAL(get_requests().size(), 3);
+    // The first manifest upload removes a stale manifest.bin
+    BOOST_REQUIRE_EQUAL(get_requests().size(), 4);
 
     auto manifest = verify_manifest_request(*part);
     verify_segment_request("0-1-v1.log", manifest);
@@ -443,7 +445,8 @@ FIXTURE_TEST(
 
     archival::ntp_archiver::batch_result expected{{0, 0, 0}, {1, 0, 0}};
     upload_and_verify(archiver.value(), expected);
-    BOOST_REQUIRE_EQUAL(get_requests().size(), 2);
+    // The first manifest upload removes a stale manifest.bin
+    BOOST_REQUIRE_EQUAL(get_requests().size(), 3);
 
     std::stringstream st;
     stm_manifest.serialize(st);
@@ -482,7 +485,8 @@ FIXTURE_TEST(test_upload_compacted_segments_fill_gap, reupload_fixture) {
     archival::ntp_archiver::batch_result expected{{0, 0, 0}, {1, 0, 0}};
     upload_and_verify(archiver.value(), expected);
 
-    BOOST_REQUIRE_EQUAL(get_requests().size(), 2);
+    // The first manifest upload removes a stale manifest.bin
+    BOOST_REQUIRE_EQUAL(get_requests().size(), 3);
 
     verify_segment_request("0-1-v1.log", stm_manifest);
 
@@ -522,7 +526,8 @@ FIXTURE_TEST(test_upload_compacted_segments_ends_in_gap, reupload_fixture) {
     archival::ntp_archiver::batch_result expected{{0, 0, 0}, {1, 0, 0}};
     upload_and_verify(archiver.value(), expected);
 
-    BOOST_REQUIRE_EQUAL(get_requests().size(), 2);
+    // The first manifest upload removes a stale manifest.bin
+    BOOST_REQUIRE_EQUAL(get_requests().size(), 3);
 
     verify_segment_request("0-1-v1.log", stm_manifest);
 
@@ -561,7 +566,8 @@ FIXTURE_TEST(test_upload_compacted_segments_begins_in_gap, reupload_fixture) {
     archival::ntp_archiver::batch_result expected{{0, 0, 0}, {1, 0, 0}};
     upload_and_verify(archiver.value(), expected);
 
-    BOOST_REQUIRE_EQUAL(get_requests().size(), 2);
+    // The first manifest upload removes a stale manifest.bin
+    BOOST_REQUIRE_EQUAL(get_requests().size(), 3);
 
     verify_segment_request("251-1-v1.log", stm_manifest);
 
@@ -589,7 +595,8 @@ FIXTURE_TEST(test_upload_both_compacted_and_non_compacted, reupload_fixture) {
     archival::ntp_archiver::batch_result expected{{2, 0, 0}, {0, 0, 0}};
     upload_and_verify(archiver.value(), expected);
 
-    BOOST_REQUIRE_EQUAL(get_requests().size(), 3);
+    // The first manifest upload removes a stale manifest.bin
+    BOOST_REQUIRE_EQUAL(get_requests().size(), 4);
 
     auto manifest = verify_manifest_request(*part);
     verify_segment_request("0-1-v1.log", manifest);
@@ -655,7 +662,8 @@ FIXTURE_TEST(test_both_uploads_with_one_failing, reupload_fixture) {
     archival::ntp_archiver::batch_result expected{{2, 0, 0}, {0, 0, 0}};
     upload_and_verify(archiver.value(), expected);
 
-    BOOST_REQUIRE_EQUAL(get_requests().size(), 3);
+    // The first manifest upload removes a stale manifest.bin
+    BOOST_REQUIRE_EQUAL(get_requests().size(), 4);
 
     auto manifest = verify_manifest_request(*part);
     verify_segment_request("0-1-v1.log", manifest);
@@ -731,7 +739,8 @@ FIXTURE_TEST(test_upload_when_compaction_disabled, reupload_fixture) {
 
     auto expected = archival::ntp_archiver::batch_result{{2, 0, 0}, {0, 0, 0}};
     upload_and_verify(archiver.value(), expected);
-    BOOST_REQUIRE_EQUAL(get_requests().size(), 3);
+    // The first manifest upload removes a stale manifest.bin
+    BOOST_REQUIRE_EQUAL(get_requests().size(), 4);
 
     auto manifest = verify_manifest_request(*part);
     verify_segment_request("0-1-v1.log", manifest);
@@ -777,7 +786,8 @@ FIXTURE_TEST(test_upload_when_reupload_disabled, reupload_fixture) {
 
     auto expected = archival::ntp_archiver::batch_result{{2, 0, 0}, {0, 0, 0}};
     upload_and_verify(archiver.value(), expected);
-    BOOST_REQUIRE_EQUAL(get_requests().size(), 3);
+    // The first manifest upload removes a stale manifest.bin
+    BOOST_REQUIRE_EQUAL(get_requests().size(), 4);
 
     auto manifest = verify_manifest_request(*part);
     verify_segment_request("0-1-v1.log", manifest);
@@ -836,7 +846,8 @@ FIXTURE_TEST(test_upload_limit, reupload_fixture) {
     archival::ntp_archiver::batch_result expected{{4, 0, 0}, {0, 0, 0}};
     upload_and_verify(archiver.value(), expected);
 
-    BOOST_REQUIRE_EQUAL(get_requests().size(), 5);
+    // The first manifest upload removes a stale manifest.bin
+    BOOST_REQUIRE_EQUAL(get_requests().size(), 6);
 
     auto manifest = load_manifest(
       get_targets().find(manifest_url)->second.content);
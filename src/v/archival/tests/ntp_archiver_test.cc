@@ -14,6 +14,7 @@
 #include "archival/tests/service_fixture.h"
 #include "bytes/iobuf.h"
 #include "cloud_storage/remote.h"
+#include "cloud_storage/remote_segment_index.h"
 #include "cloud_storage/types.h"
 #include "model/metadata.h"
 #include "net/types.h"
@@ -137,7 +138,8 @@ FIXTURE_TEST(test_upload_segments, archiver_fixture) {
     for (auto [url, req] : get_targets()) {
         vlog(test_log.info, "{} {}", req._method, req._url);
     }
-    BOOST_REQUIRE_EQUAL(get_requests().size(), 3);
+    // The first manifest upload removes a stale manifest.bin
+    BOOST_REQUIRE_EQUAL(get_requests().size(), 4);
 
     cloud_storage::partition_manifest manifest;
     {
@@ -182,6 +184,59 @@ FIXTURE_TEST(test_upload_segments, archiver_fixture) {
     }
 }
 
+// NOLINTNEXTLINE
+FIXTURE_TEST(test_upload_segments_catchup, archiver_fixture) {
+    // The first iteration uploads the regular number of segments (4) and
+    // switches the archiver to the catch-up mode. The second iteration
+    // uploads the rest of the backlog in a single batch.
+    auto& cfg = config::shard_local_cfg();
+    cfg.cloud_storage_upload_catchup_batch_size.set_value(size_t{8});
+    cfg.cloud_storage_upload_catchup_concurrency.set_value(size_t{2});
+    auto reset_cfg = ss::defer([&cfg] {
+        cfg.cloud_storage_upload_catchup_batch_size.reset();
+        cfg.cloud_storage_upload_catchup_concurrency.reset();
+    });
+
+    std::vector<segment_desc> segments;
+    for (int i = 0; i < 10; i++) {
+        segments.push_back(
+          {manifest_ntp, model::offset(i * 1000), model::term_id(1)});
+    }
+    init_storage_api_local(segments);
+    wait_for_partition_leadership(manifest_ntp);
+    auto part = app.partition_manager.local().get(manifest_ntp);
+    tests::cooperative_spin_wait_with_timeout(10s, [part]() mutable {
+        return part->last_stable_offset() >= model::offset(9000);
+    }).get();
+
+    part->stop_archiver().get();
+    listen();
+    auto [arch_conf, remote_conf] = get_configurations();
+    cloud_storage::remote remote(
+      remote_conf.connection_limit,
+      remote_conf.client_config,
+      remote_conf.cloud_credentials_source);
+    archival::ntp_archiver archiver(get_ntp_conf(), arch_conf, remote, *part);
+    auto action = ss::defer([&archiver] { archiver.stop().get(); });
+
+    auto res = upload_next_with_retries(archiver).get0();
+    BOOST_REQUIRE_EQUAL(res.non_compacted_upload_result.num_succeeded, 4);
+    BOOST_REQUIRE_EQUAL(res.non_compacted_upload_result.num_failed, 0);
+
+    res = upload_next_with_retries(archiver).get0();
+    BOOST_REQUIRE_EQUAL(res.non_compacted_upload_result.num_succeeded, 6);
+    BOOST_REQUIRE_EQUAL(res.non_compacted_upload_result.num_failed, 0);
+
+    // Segments are added to the manifest in order
+    const auto& stm_manifest = part->archival_meta_stm()->manifest();
+    BOOST_REQUIRE_EQUAL(stm_manifest.size(), segments.size());
+    auto it = stm_manifest.begin();
+    for (const auto& segment : segments) {
+        BOOST_REQUIRE_EQUAL(segment.base_offset, it->second.base_offset);
+        ++it;
+    }
+}
+
 // NOLINTNEXTLINE
 FIXTURE_TEST(test_retention, archiver_fixture) {
     /*
@@ -280,6 +335,19 @@ FIXTURE_TEST(test_retention, archiver_fixture) {
                                != req_end;
 
         BOOST_REQUIRE(segment_deleted == deletion_expected);
+
+        // The segment index is removed along with the segment
+        auto index_url = cloud_storage::generate_remote_index_path(url);
+        auto [ix_begin, ix_end] = get_targets().equal_range(
+          "/" + index_url().string());
+        auto index_deleted = std::find_if(
+                               ix_begin,
+                               ix_end,
+                               [](auto entry) {
+                                   return entry.second._method == "DELETE";
+                               })
+                             != ix_end;
+        BOOST_REQUIRE(index_deleted == deletion_expected);
     }
 }
 
@@ -734,7 +802,8 @@ FIXTURE_TEST(test_upload_segments_leadership_transfer, archiver_fixture) {
     for (auto req : get_requests()) {
         vlog(test_log.info, "{} {}", req._method, req._url);
     }
-    BOOST_REQUIRE_EQUAL(get_requests().size(), 3);
+    // The first manifest upload removes a stale manifest.bin
+    BOOST_REQUIRE_EQUAL(get_requests().size(), 4);
 
     cloud_storage::partition_manifest manifest;
     {
@@ -945,7 +1014,8 @@ static void test_partial_upload_impl(
     BOOST_REQUIRE_EQUAL(compacted_result.num_failed, 0);
 
     test.log_requests();
-    BOOST_REQUIRE_EQUAL(test.get_requests().size(), 2);
+    // The first manifest upload removes a stale manifest.bin
+    BOOST_REQUIRE_EQUAL(test.get_requests().size(), 3);
 
     {
         auto [begin, end] = test.get_targets().equal_range(manifest_url);
@@ -131,3 +131,34 @@ SEASTAR_THREAD_TEST_CASE(test_retention_strategies) {
         }
     };
 }
+
+SEASTAR_THREAD_TEST_CASE(test_retention_with_spillover) {
+    temporary_dir tmp_dir("retention_strategy_test");
+    auto data_path = tmp_dir.get_path();
+
+    ntp_config config{{"test_ns", "test_topic", 0}, {data_path}};
+    config.set_overrides(
+      {.retention_bytes = tristate<size_t>{1024 * 2},
+       .retention_time = tristate<std::chrono::milliseconds>{}});
+
+    cloud_storage::partition_manifest m;
+    populate_manifest(
+      m,
+      {{0, 9, 1024},
+       {10, 19, 1024},
+       {20, 29, 1024},
+       {30, 39, 1024},
+       {40, 49, 1024}});
+    // Segments 0-19 are moved to the spillover manifest
+    auto spillover = m.make_spillover_manifest(2).make_manifest_metadata();
+    BOOST_REQUIRE(m.spillover(spillover));
+    BOOST_REQUIRE_EQUAL(m.cloud_log_size(), 1024 * 5);
+
+    // The spillover manifest is removed as a whole, after that the
+    // manifest itself is truncated.
+    auto retention_calculator = retention_calculator::factory(m, config);
+    BOOST_REQUIRE(retention_calculator.has_value());
+    auto next_so = retention_calculator->next_start_offset();
+    BOOST_REQUIRE(next_so.has_value());
+    BOOST_REQUIRE_EQUAL(*next_so, model::offset{30});
+}
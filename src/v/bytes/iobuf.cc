@@ -12,6 +12,7 @@
 #include "bytes/details/io_allocation_size.h"
 #include "bytes/iostream.h"
 #include "bytes/scattered_message.h"
+#include "units.h"
 #include "vassert.h"
 
 #include <seastar/core/bitops.hh>
@@ -56,6 +57,26 @@ write_iobuf_to_output_stream(iobuf buf, ss::output_stream<char>& output) {
     });
 }
 
+/*
+ * Buffers handed out by the socket are attached to the iobuf as fragments,
+ * without a copy, once they are large enough. iobuf::append(temporary_buffer)
+ * copies any buffer that fits in the last allocation, which for large
+ * payloads meant copying almost every receive buffer after the first one.
+ * Small buffers are still packed so that they don't pin the socket buffer
+ * they were carved from.
+ */
+static constexpr size_t min_shared_receive_buffer = 8_KiB;
+
+static void append_received(iobuf& b, ss::temporary_buffer<char> buf) {
+    if (buf.size() < min_shared_receive_buffer) {
+        b.append(std::move(buf));
+        return;
+    }
+    // intrusive list manages the lifetime
+    b.append_take_ownership(
+      new iobuf::fragment(std::move(buf), iobuf::fragment::full{}));
+}
+
 ss::future<iobuf> read_iobuf_exactly(ss::input_stream<char>& in, size_t n) {
     return ss::do_with(iobuf{}, n, [&in](iobuf& b, size_t& n) {
         return ss::do_until(
@@ -68,7 +89,7 @@ ss::future<iobuf> read_iobuf_exactly(ss::input_stream<char>& in, size_t n) {
                                return;
                            }
                            n -= buf.size();
-                           b.append(std::move(buf));
+                           append_received(b, std::move(buf));
                        });
                  })
           .then([&b] { return std::move(b); });
@@ -10,6 +10,7 @@
 #include "bytes/hash.h"
 #include "bytes/iostream.h"
 #include "bytes/tests/utils.h"
+#include "units.h"
 
 #include <seastar/testing/thread_test_case.hh>
 
@@ -39,6 +40,33 @@ SEASTAR_THREAD_TEST_CASE(test_reading_some_bytes) {
     BOOST_REQUIRE_EQUAL(read_buf.size_bytes(), 16);
 };
 
+SEASTAR_THREAD_TEST_CASE(test_reading_large_buffers_without_copy) {
+    static constexpr size_t chunk_size = 32_KiB;
+    static constexpr size_t chunks = 4;
+    iobuf src;
+    for (size_t i = 0; i < chunks; ++i) {
+        auto chunk = ss::temporary_buffer<char>(chunk_size);
+        std::fill_n(chunk.get_write(), chunk.size(), static_cast<char>(i));
+        iobuf part;
+        part.append(std::move(chunk));
+        src.append_fragments(std::move(part));
+    }
+    auto expected = src.share(0, src.size_bytes());
+    auto is = make_iobuf_input_stream(std::move(src));
+
+    auto read_buf = read_iobuf_exactly(is, chunks * chunk_size).get0();
+    BOOST_REQUIRE_EQUAL(read_buf, expected);
+    BOOST_REQUIRE_EQUAL(
+      static_cast<size_t>(std::distance(read_buf.begin(), read_buf.end())),
+      chunks);
+    auto expected_it = expected.begin();
+    for (auto& frag : read_buf) {
+        // same backing memory, i.e. not copied
+        BOOST_REQUIRE(frag.get() == expected_it->get());
+        ++expected_it;
+    }
+}
+
 SEASTAR_THREAD_TEST_CASE(test_bytes_conversion) {
     static constexpr std::string_view key = "magic_key";
     iobuf buf;
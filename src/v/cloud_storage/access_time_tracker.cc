@@ -11,106 +11,131 @@
 #include "cloud_storage/access_time_tracker.h"
 
 #include "serde/serde.h"
-#include "units.h"
 
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/smp.hh>
 
-#include <absl/container/btree_map.h>
+#include <iterator>
 
-#include <exception>
-#include <variant>
-
-namespace absl {
+namespace cloud_storage {
 
-template<class Key, class Value>
-void write(iobuf& out, const btree_map<Key, Value>& btree) {
-    using serde::write;
-    write(out, static_cast<uint64_t>(btree.size()));
-    for (auto it : btree) {
-        write(out, it.first);
-        write(out, it.second);
-    }
+static uint32_t to_seconds(std::chrono::system_clock::time_point ts) {
+    return std::chrono::time_point_cast<std::chrono::seconds>(ts)
+      .time_since_epoch()
+      .count();
 }
 
-template<class Key, class Value>
-void read_nested(
-  iobuf_parser& in,
-  btree_map<Key, Value>& btree,
-  size_t const bytes_left_limit) {
-    using serde::read_nested;
-    uint64_t sz;
-    read_nested(in, sz, bytes_left_limit);
-    for (auto i = 0UL; i < sz; i++) {
-        Key key;
-        Value value;
-        read_nested(in, key, bytes_left_limit);
-        read_nested(in, value, bytes_left_limit);
-        btree.insert({key, value});
+uint64_t access_time_tracker::add(
+  std::string_view key,
+  std::chrono::system_clock::time_point ts,
+  uint64_t size) {
+    auto seconds = to_seconds(ts);
+    uint64_t prev_size = 0;
+    entry* e = nullptr;
+    if (auto it = _index.find(key); it != _index.end()) {
+        e = it->second.get();
+        prev_size = e->size;
+        e->_hook.unlink();
+    } else {
+        auto p = std::make_unique<entry>();
+        p->path = ss::sstring(key.data(), key.size());
+        e = p.get();
+        _index.emplace(std::string_view(e->path), std::move(p));
     }
-}
-
-} // namespace absl
-
-namespace cloud_storage {
-
-void access_time_tracker::add_timestamp(
-  std::string_view key, std::chrono::system_clock::time_point ts) {
-    uint32_t seconds = std::chrono::time_point_cast<std::chrono::seconds>(ts)
-                         .time_since_epoch()
-                         .count();
-    uint32_t hash = xxhash_32(key.data(), key.size());
-    _table.data[hash] = seconds;
+    e->atime_sec = seconds;
+    e->size = size;
+    _total_size = _total_size - prev_size + size;
+
+    // Normally the timestamp is the current time and the entry goes
+    // to the tail of the list. Older timestamps are only used when the
+    // tracker is rebuilt so the linear search is fine.
+    auto pos = _lru.end();
+    while (pos != _lru.begin() && std::prev(pos)->atime_sec > seconds) {
+        --pos;
+    }
+    _lru.insert(pos, *e);
     _dirty = true;
+    return prev_size;
 }
 
-void access_time_tracker::remove_timestamp(std::string_view key) noexcept {
-    try {
-        uint32_t hash = xxhash_32(key.data(), key.size());
-        _table.data.erase(hash);
-        _dirty = true;
-    } catch (...) {
-        vassert(
-          false,
-          "Can't remove key {} from access_time_tracker, exception: {}",
-          key,
-          std::current_exception());
+uint64_t access_time_tracker::remove(std::string_view key) noexcept {
+    auto it = _index.find(key);
+    if (it == _index.end()) {
+        return 0;
     }
-}
-
-void access_time_tracker::remove_others(const access_time_tracker& t) {
-    table_t tmp;
-    for (auto it : _table.data) {
-        if (t._table.data.contains(it.first)) {
-            tmp.data.insert(it);
-        }
-    }
-    _table = std::move(tmp);
+    auto size = it->second->size;
+    _total_size -= size;
+    // The key references the path stored in the entry, the hook
+    // is unlinked automatically when the entry is destroyed.
+    _index.erase(it);
+    _dirty = true;
+    return size;
 }
 
 std::optional<std::chrono::system_clock::time_point>
 access_time_tracker::estimate_timestamp(std::string_view key) const {
-    uint32_t hash = xxhash_32(key.data(), key.size());
-    auto it = _table.data.find(hash);
-    if (it == _table.data.end()) {
+    auto it = _index.find(key);
+    if (it == _index.end()) {
         return std::nullopt;
     }
-    auto seconds = std::chrono::seconds(it->second);
+    auto seconds = std::chrono::seconds(it->second->atime_sec);
     std::chrono::system_clock::time_point ts(seconds);
     return ts;
 }
 
-iobuf access_time_tracker::to_iobuf() {
+std::vector<file_list_item> access_time_tracker::lru_entries(
+  uint64_t size_limit,
+  const std::function<bool(std::string_view)>& skip) const {
+    std::vector<file_list_item> res;
+    uint64_t total = 0;
+    for (auto it = _lru.begin(); it != _lru.end() && total < size_limit;
+         ++it) {
+        if (skip(it->path)) {
+            continue;
+        }
+        total += it->size;
+        res.push_back(
+          {.access_time = std::chrono::system_clock::time_point(
+             std::chrono::seconds(it->atime_sec)),
+           .path = it->path,
+           .size = it->size});
+    }
+    return res;
+}
+
+iobuf access_time_tracker::to_iobuf(bool complete) {
+    table_t table{.complete = complete};
+    table.data.reserve(_index.size());
+    for (const auto& e : _lru) {
+        table.data.push_back(
+          {.path = e.path, .atime_sec = e.atime_sec, .size = e.size});
+    }
     _dirty = false;
-    return serde::to_iobuf(_table);
+    return serde::to_iobuf(std::move(table));
 }
 
-void access_time_tracker::from_iobuf(iobuf b) {
+bool access_time_tracker::from_iobuf(iobuf b) {
     iobuf_parser parser(std::move(b));
-    _table = serde::read<table_t>(parser);
+    auto table = serde::read<table_t>(parser);
+    clear();
+    for (const auto& m : table.data) {
+        add(
+          m.path,
+          std::chrono::system_clock::time_point(
+            std::chrono::seconds(m.atime_sec)),
+          m.size);
+    }
     _dirty = false;
+    return table.complete;
 }
 
 bool access_time_tracker::is_dirty() const { return _dirty; }
 
+void access_time_tracker::clear() {
+    _lru.clear();
+    _index.clear();
+    _total_size = 0;
+    _dirty = true;
+}
+
 } // namespace cloud_storage
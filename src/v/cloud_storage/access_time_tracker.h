@@ -11,63 +11,128 @@
 #pragma once
 
 #include "bytes/iobuf.h"
-#include "hashing/xx.h"
 #include "seastarx.h"
 #include "serde/envelope.h"
+#include "utils/intrusive_list_helpers.h"
 
 #include <seastar/core/future.hh>
+#include <seastar/core/sstring.hh>
 
-#include <absl/container/btree_map.h>
+#include <absl/container/flat_hash_map.h>
 
 #include <chrono>
+#include <functional>
+#include <memory>
 #include <string_view>
+#include <vector>
 
 namespace cloud_storage {
 
-/// Access time tracker maintains map from filename hash to
-/// the timestamp that represents the time when the file was
-/// accessed last.
+struct file_list_item {
+    std::chrono::system_clock::time_point access_time;
+    ss::sstring path;
+    uint64_t size;
+};
+
+/// Access time tracker is an index of the files stored in the
+/// cache directory. It maintains a map from the file name to the
+/// size of the file and the time when the file was accessed last.
 ///
-/// It is possible to have conflicts. In case of conflict
-/// 'add_timestamp' method will overwrite another key. For that
-/// key we will observe larger access time. When one of the
-/// conflicted entries will be deleted another will be deleted
-/// as well. This is OK because the code in the
-/// 'cloud_storage/cache_service' is ready for that.
+/// The entries are also linked in LRU order which makes it possible
+/// to find eviction candidates without sorting or walking the cache
+/// directory. The index is persisted by the cache service and used
+/// on startup instead of the directory walk if it's known to be
+/// complete.
 class access_time_tracker {
     using timestamp_t = uint32_t;
+
+    /// Serialized representation of the entry
+    struct file_metadata
+      : serde::
+          envelope<file_metadata, serde::version<0>, serde::compat_version<0>> {
+        ss::sstring path;
+        timestamp_t atime_sec{0};
+        uint64_t size{0};
+    };
+
     struct table_t
-      : serde::envelope<table_t, serde::version<0>, serde::compat_version<0>> {
-        absl::btree_map<uint32_t, timestamp_t> data;
+      : serde::envelope<table_t, serde::version<1>, serde::compat_version<1>> {
+        /// Entries ordered from least recently used to most recently used
+        std::vector<file_metadata> data;
+        /// Set if the table describes full content of the cache
+        bool complete{false};
+    };
+
+    struct entry {
+        ss::sstring path;
+        timestamp_t atime_sec{0};
+        uint64_t size{0};
+        intrusive_list_hook _hook;
     };
 
 public:
-    /// Add access time to the container.
-    void add_timestamp(
-      std::string_view key, std::chrono::system_clock::time_point ts);
+    access_time_tracker() = default;
+    access_time_tracker(const access_time_tracker&) = delete;
+    access_time_tracker& operator=(const access_time_tracker&) = delete;
+    access_time_tracker(access_time_tracker&&) = delete;
+    access_time_tracker& operator=(access_time_tracker&&) = delete;
+    ~access_time_tracker() = default;
+
+    /// Add file to the container or update access time and size of
+    /// the existing file.
+    ///
+    /// \return previous size of the file or 0 if it wasn't tracked
+    uint64_t add(
+      std::string_view key,
+      std::chrono::system_clock::time_point ts,
+      uint64_t size);
 
     /// Remove key from the container.
-    void remove_timestamp(std::string_view) noexcept;
+    ///
+    /// \return size of the removed file or 0 if it wasn't tracked
+    uint64_t remove(std::string_view) noexcept;
 
-    /// Return access time estimate (it can differ if there is a conflict
-    /// on file name hash).
+    /// Return last access time of the file
     std::optional<std::chrono::system_clock::time_point>
     estimate_timestamp(std::string_view key) const;
 
-    iobuf to_iobuf();
-    void from_iobuf(iobuf b);
+    /// Collect least recently used files until their total size reaches
+    /// 'size_limit'. Files for which 'skip' returns true are not collected
+    /// and not counted. The result is ordered by access time.
+    std::vector<file_list_item> lru_entries(
+      uint64_t size_limit,
+      const std::function<bool(std::string_view)>& skip) const;
+
+    /// Serialize the tracker.
+    ///
+    /// \param complete should be set if the tracker describes full content
+    ///        of the cache directory and can be used without the walk
+    iobuf to_iobuf(bool complete = false);
+
+    /// Deserialize the tracker.
+    ///
+    /// \return true if the serialized tracker was complete
+    bool from_iobuf(iobuf b);
 
     /// Returns true if tracker has new data which wasn't serialized
     /// to disk.
     bool is_dirty() const;
 
-    /// Remove every key which isn't present in 't'
-    void remove_others(const access_time_tracker& t);
+    /// Remove all entries
+    void clear();
 
-    size_t size() const { return _table.data.size(); }
+    /// Number of tracked files
+    size_t size() const { return _index.size(); }
+
+    /// Total size of tracked files in bytes
+    uint64_t total_size() const { return _total_size; }
 
 private:
-    table_t _table;
+    using lru_list = intrusive_list<entry, &entry::_hook>;
+
+    absl::flat_hash_map<std::string_view, std::unique_ptr<entry>> _index;
+    lru_list _lru;
+    uint64_t _total_size{0};
     bool _dirty{false};
 };
 
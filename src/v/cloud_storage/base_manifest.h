@@ -29,6 +29,14 @@ enum class manifest_type {
     tx_range,
 };
 
+/// Encoding of the manifest object
+enum class manifest_format {
+    /// Human readable json document
+    json,
+    /// Versioned serde envelope, partition manifests only (manifest.bin)
+    serde,
+};
+
 class base_manifest {
 public:
     virtual ~base_manifest() = default;
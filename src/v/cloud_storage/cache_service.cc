@@ -11,8 +11,11 @@
 #include "bytes/iostream.h"
 #include "cloud_storage/access_time_tracker.h"
 #include "cloud_storage/logger.h"
+#include "hashing/xx.h"
+#include "ssx/sformat.h"
 #include "ssx/future-util.h"
 #include "storage/segment.h"
+#include "utils/directory_walker.h"
 #include "utils/gate_guard.h"
 #include "vassert.h"
 #include "vlog.h"
@@ -25,11 +28,14 @@
 #include <seastar/core/sstring.hh>
 #include <seastar/util/defer.hh>
 
+#include <absl/container/flat_hash_set.h>
+
 #include <cloud_storage/cache_service.h>
 
 #include <algorithm>
 #include <exception>
 #include <filesystem>
+#include <functional>
 #include <stdexcept>
 #include <string_view>
 
@@ -61,9 +67,80 @@ static constexpr ss::lowres_clock::duration min_clean_up_interval = 5000ms;
 cache::cache(std::filesystem::path cache_dir, size_t max_cache_size) noexcept
   : _cache_dir(std::move(cache_dir))
   , _max_cache_size(max_cache_size)
+  , _quota(
+      max_cache_size / ss::smp::count
+      + (ss::this_shard_id() == 0 ? max_cache_size % ss::smp::count : 0))
   , _cnt(0)
   , _total_cleaned(0) {}
 
+/// Chunks of a segment hydrated with chunk reads are stored in the
+/// '<segment>_chunks' directory.
+static constexpr std::string_view chunks_dir_suffix{"_chunks/"};
+
+static bool is_sidecar_file(std::string_view path) {
+    return path.ends_with(".tx") || path.ends_with(".index");
+}
+
+static bool is_chunk_file(std::string_view path) {
+    auto pos = path.rfind(chunks_dir_suffix);
+    return pos != std::string_view::npos
+           && path.find('/', pos + chunks_dir_suffix.size())
+                == std::string_view::npos;
+}
+
+/// Returns the path of the segment the file belongs to, or the path itself
+/// if it isn't a .tx, .index or a chunk file.
+static std::string_view segment_path(std::string_view path) {
+    for (std::string_view ext : {".tx", ".index"}) {
+        if (path.ends_with(ext)) {
+            path.remove_suffix(ext.size());
+            return path;
+        }
+    }
+    if (is_chunk_file(path)) {
+        return path.substr(0, path.rfind(chunks_dir_suffix));
+    }
+    return path;
+}
+
+static ss::sstring chunks_dir(std::string_view segment) {
+    return ssx::sformat("{}_chunks", segment);
+}
+
+ss::shard_id cache::owner_shard(std::string_view path) {
+    // The .tx, .index and chunk files are owned by the same shard as the
+    // segment they belong to, they're evicted together.
+    path = segment_path(path);
+    return xxhash_64(path.data(), path.size()) % ss::smp::count;
+}
+
+static bool is_tracker_file(std::string_view path) {
+    auto filename = std::filesystem::path(path).filename();
+    return std::string_view(filename.native())
+      .starts_with(access_time_tracker_file_name);
+}
+
+bool cache::skip_eviction(std::string_view path) const {
+    if (is_tracker_file(path)) {
+        return true;
+    }
+    // Doesn't make sense to demote these independent of the segment
+    // they refer to: we will clear them out along with the main log
+    // segment file if it exists. Segments hydrated in chunks have no
+    // segment file, their .tx and .index files are evicted with the
+    // last chunk or on their own.
+    return is_sidecar_file(path)
+           && _access_time_tracker.estimate_timestamp(segment_path(path))
+                .has_value();
+}
+
+static ss::sstring tracker_file_name(ss::shard_id shard) {
+    // The number of shards is a part of the name because the
+    // ownership of the files depends on it.
+    return ssx::sformat(
+      "{}_{}_{}", access_time_tracker_file_name, shard, ss::smp::count);
+}
+
 ss::future<>
 cache::recursive_delete_empty_directory(const std::string_view& key) {
     gate_guard guard{_gate};
@@ -103,13 +180,25 @@ cache::recursive_delete_empty_directory(const std::string_view& key) {
     }
 }
 
-uint64_t cache::get_total_cleaned() { return _total_cleaned; }
+ss::future<uint64_t> cache::get_total_cleaned() {
+    return container().map_reduce0(
+      [](cache& c) { return c._total_cleaned; }, uint64_t{0}, std::plus<>());
+}
 
-ss::future<> cache::consume_cache_space(size_t sz) {
-    vassert(ss::this_shard_id() == 0, "This method can only run on shard 0");
-    _current_cache_size += sz;
+void cache::update_cache_size() {
+    _current_cache_size = _access_time_tracker.total_size();
     probe.set_size(_current_cache_size);
-    if (_current_cache_size > _max_cache_size) {
+    probe.set_num_files(_access_time_tracker.size());
+}
+
+ss::future<> cache::track_access(ss::sstring path, uint64_t size) {
+    vassert(
+      ss::this_shard_id() == owner_shard(path),
+      "File {} is not owned by this shard",
+      path);
+    _access_time_tracker.add(path, std::chrono::system_clock::now(), size);
+    update_cache_size();
+    if (_current_cache_size > _quota) {
         if (ss::lowres_clock::now() - _last_clean_up > min_clean_up_interval) {
             auto units = ss::try_get_units(_cleanup_sm, 1);
             if (units) {
@@ -120,29 +209,40 @@ ss::future<> cache::consume_cache_space(size_t sz) {
     }
 }
 
+void cache::track_removal(std::string_view path) {
+    vassert(
+      ss::this_shard_id() == owner_shard(path),
+      "File {} is not owned by this shard",
+      path);
+    _access_time_tracker.remove(path);
+    update_cache_size();
+}
+
 ss::future<> cache::clean_up_at_start() {
     gate_guard guard{_gate};
     auto [cache_size, candidates_for_deletion, empty_dirs]
       = co_await _walker.walk(_cache_dir.native(), _access_time_tracker);
-    probe.set_size(cache_size);
-    probe.set_num_files(candidates_for_deletion.size());
 
-    // The state of the _access_time_tracker and the actual content of the
-    // cache directory might diverge over time (if the user removes segment
-    // files manually). We need to take this into account.
-    access_time_tracker tmp;
-    for (const auto& it : candidates_for_deletion) {
-        tmp.add_timestamp(
-          it.path, std::chrono::system_clock::time_point::min());
+    // The walk returns actual content of the cache directory which is used
+    // to rebuild the access time trackers of all shards.
+    std::vector<std::vector<file_list_item>> owned_files(ss::smp::count);
+    absl::flat_hash_set<ss::sstring> tracker_files;
+    for (ss::shard_id shard = 0; shard < ss::smp::count; shard++) {
+        tracker_files.insert(tracker_file_name(shard));
     }
-    _access_time_tracker.remove_others(tmp);
-    _current_cache_size = cache_size;
 
     for (const auto& file_item : candidates_for_deletion) {
         auto filepath_to_remove = file_item.path;
 
         // delete only tmp files that are left from previous RedPanda run
-        if (std::string_view(filepath_to_remove).ends_with(tmp_extension)) {
+        // and the trackers saved with different number of shards
+        auto filename = std::filesystem::path(filepath_to_remove).filename();
+        bool stale_tracker = is_tracker_file(filepath_to_remove)
+                             && !tracker_files.contains(
+                               ss::sstring(filename.native()));
+        if (
+          std::string_view(filepath_to_remove).ends_with(tmp_extension)
+          || stale_tracker) {
             try {
                 co_await recursive_delete_empty_directory(filepath_to_remove);
                 _total_cleaned += file_item.size;
@@ -153,8 +253,29 @@ ss::future<> cache::clean_up_at_start() {
                   filepath_to_remove,
                   e.what());
             }
+        } else if (!is_tracker_file(filepath_to_remove)) {
+            owned_files[owner_shard(file_item.path)].push_back(file_item);
         }
     }
+    co_await container().invoke_on_all([&owned_files](cache& c) {
+        // The timestamps are preserved for the files which were already
+        // tracked by the owner.
+        auto files = owned_files[ss::this_shard_id()];
+        for (auto& file_item : files) {
+            file_item.access_time = c._access_time_tracker
+                                      .estimate_timestamp(file_item.path)
+                                      .value_or(file_item.access_time);
+        }
+        std::sort(files.begin(), files.end(), [](auto& a, auto& b) {
+            return a.access_time < b.access_time;
+        });
+        c._access_time_tracker.clear();
+        for (const auto& file_item : files) {
+            c._access_time_tracker.add(
+              file_item.path, file_item.access_time, file_item.size);
+        }
+        c.update_cache_size();
+    });
 
     for (const auto& path : empty_dirs) {
         try {
@@ -177,122 +298,188 @@ ss::future<> cache::clean_up_at_start() {
 }
 
 ss::future<> cache::clean_up_cache() {
-    vassert(ss::this_shard_id() == 0, "Method can only be invoked on shard 0");
     gate_guard guard{_gate};
-    auto [current_cache_size, candidates_for_deletion, _]
-      = co_await _walker.walk(_cache_dir.native(), _access_time_tracker);
-    _current_cache_size = current_cache_size;
-    probe.set_size(_current_cache_size);
-    probe.set_num_files(candidates_for_deletion.size());
 
-    // Updating the access time tracker in case if some files were removed
-    // from cache directory by the user manually.
-    access_time_tracker tmp;
-    for (const auto& it : candidates_for_deletion) {
-        tmp.add_timestamp(
-          it.path, std::chrono::system_clock::time_point::min());
+    if (_current_cache_size >= _quota) {
+        co_await borrow_quota();
     }
-    _access_time_tracker.remove_others(tmp);
-
-    uint64_t deleted_size = 0;
-    if (_current_cache_size >= _max_cache_size) {
+    if (_current_cache_size >= _quota) {
         auto size_to_delete
           = _current_cache_size
-            - (_max_cache_size * (long double)_cache_size_low_watermark);
+            - (_quota * (long double)_cache_size_low_watermark);
+        co_await evict(size_to_delete);
+        _last_clean_up = ss::lowres_clock::now();
+    }
+}
 
-        // Sort by atime for the subsequent LRU trimming loop
-        std::sort(
-          candidates_for_deletion.begin(),
-          candidates_for_deletion.end(),
-          [](auto& a, auto& b) { return a.access_time < b.access_time; });
+ss::future<> cache::borrow_quota() {
+    // Borrow enough to get below the low watermark
+    auto wanted = [this]() -> uint64_t {
+        auto target = static_cast<uint64_t>(
+          _current_cache_size / (long double)_cache_size_low_watermark);
+        return target > _quota ? target - _quota : 0;
+    };
+    // The first round takes only free quota of other shards. The second
+    // round makes them evict files which are older than the least recently
+    // used file of this shard to approximate the global LRU order.
+    std::optional<std::chrono::system_clock::time_point> older_than;
+    for (int round = 0; round < 2 && wanted() > 0; round++) {
+        if (round > 0) {
+            auto lru = _access_time_tracker.lru_entries(
+              1, [this](std::string_view p) { return skip_eviction(p); });
+            if (lru.empty()) {
+                break;
+            }
+            older_than = lru.front().access_time;
+        }
+        for (ss::shard_id i = 1; i < ss::smp::count && wanted() > 0; i++) {
+            auto shard = (ss::this_shard_id() + i) % ss::smp::count;
+            auto released = co_await container().invoke_on(
+              shard, [amount = wanted(), older_than](cache& c) {
+                  return c.release_quota(amount, older_than);
+              });
+            _quota += released;
+        }
+    }
+    vlog(
+      cst_log.debug,
+      "Cache quota {}, cache size {}",
+      _quota,
+      _current_cache_size);
+}
 
-        size_t i_to_delete = 0;
-        while (i_to_delete < candidates_for_deletion.size()
-               && deleted_size < size_to_delete) {
-            auto filename_to_remove = candidates_for_deletion[i_to_delete].path;
+ss::future<uint64_t> cache::release_quota(
+  uint64_t amount,
+  std::optional<std::chrono::system_clock::time_point> older_than) {
+    gate_guard guard{_gate};
+    auto free_quota = [this]() -> uint64_t {
+        return _quota > _current_cache_size ? _quota - _current_cache_size
+                                            : 0;
+    };
+    if (older_than && free_quota() < amount) {
+        // Don't wait if the eviction is already running on this shard,
+        // it might be waiting for the quota from the caller.
+        auto units = ss::try_get_units(_cleanup_sm, 1);
+        if (units) {
+            co_await evict(amount - free_quota(), older_than);
+        }
+    }
+    auto released = std::min(amount, free_quota());
+    _quota -= released;
+    co_return released;
+}
 
-            // skip tmp files since someone may be writing to it
-            if (std::string_view(filename_to_remove).ends_with(tmp_extension)) {
-                i_to_delete++;
-                continue;
-            }
+ss::future<uint64_t> cache::evict(
+  uint64_t size_to_delete,
+  std::optional<std::chrono::system_clock::time_point> older_than) {
+    uint64_t deleted_size = 0;
 
-            // Doesn't make sense to demote these independent of the segment
-            // they refer to: we will clear them out along with the main log
-            // segment file if they exist.
-            if (
-              std::string_view(filename_to_remove).ends_with(".tx")
-              || std::string_view(filename_to_remove).ends_with(".index")) {
-                i_to_delete++;
-                continue;
-            }
+    // The candidates are collected upfront because the tracker
+    // can be updated while the files are being deleted.
+    auto candidates_for_deletion = _access_time_tracker.lru_entries(
+      size_to_delete,
+      [this](std::string_view p) { return skip_eviction(p); });
+    if (older_than) {
+        auto it = std::find_if(
+          candidates_for_deletion.begin(),
+          candidates_for_deletion.end(),
+          [&older_than](const file_list_item& f) {
+              return f.access_time >= *older_than;
+          });
+        candidates_for_deletion.erase(it, candidates_for_deletion.end());
+    }
 
-            try {
-                auto tx_file = fmt::format("{}.tx", filename_to_remove);
-                auto index_file = fmt::format("{}.index", filename_to_remove);
-
-                try {
-                    auto sz = co_await ss::file_size(tx_file);
-                    co_await ss::remove_file(tx_file);
-                    deleted_size += sz;
-                } catch (std::filesystem::filesystem_error& e) {
-                    if (e.code() != std::errc::no_such_file_or_directory) {
-                        throw;
-                    }
-                }
+    auto remove_sidecars =
+      [this](std::string_view segment) -> ss::future<uint64_t> {
+        auto tx_size = co_await remove_if_exists(
+          ssx::sformat("{}.tx", segment));
+        auto index_size = co_await remove_if_exists(
+          ssx::sformat("{}.index", segment));
+        co_return tx_size + index_size;
+    };
 
-                try {
-                    auto sz = co_await ss::file_size(index_file);
-                    co_await ss::remove_file(index_file);
-                    deleted_size += sz;
-                } catch (std::filesystem::filesystem_error& e) {
-                    if (e.code() != std::errc::no_such_file_or_directory) {
-                        throw;
-                    }
+    size_t deleted_files = 0;
+    for (const auto& file_item : candidates_for_deletion) {
+        const auto& filename_to_remove = file_item.path;
+        try {
+            if (is_chunk_file(filename_to_remove)) {
+                deleted_size += co_await remove_if_exists(filename_to_remove);
+                // The chunk directory is deleted together with the last
+                // chunk, the .tx and .index files go with it unless the
+                // segment file is in the cache.
+                auto segment = segment_path(filename_to_remove);
+                if (
+                  !_access_time_tracker.estimate_timestamp(segment)
+                  && !co_await ss::file_exists(chunks_dir(segment))) {
+                    deleted_size += co_await remove_sidecars(segment);
                 }
-
-                co_await recursive_delete_empty_directory(filename_to_remove);
-                deleted_size += candidates_for_deletion[i_to_delete].size;
-                // Remove key if possible to make sure there is no resource
-                // leak
-                _access_time_tracker.remove_timestamp(
-                  std::string_view(filename_to_remove));
-            } catch (const ss::gate_closed_exception&) {
-                // We are shutting down, stop iterating and propagate
-                throw;
-            } catch (const std::exception& e) {
-                vlog(
-                  cst_log.error,
-                  "Cache eviction couldn't delete {}: {}.",
-                  filename_to_remove,
-                  e.what());
+            } else if (is_sidecar_file(filename_to_remove)) {
+                deleted_size += co_await remove_if_exists(filename_to_remove);
+            } else {
+                deleted_size += co_await remove_sidecars(filename_to_remove);
+                deleted_size += co_await remove_if_exists(filename_to_remove);
+                deleted_size += co_await remove_chunks(filename_to_remove);
             }
-            i_to_delete++;
+            deleted_files++;
+        } catch (const ss::gate_closed_exception&) {
+            // We are shutting down, stop iterating and propagate
+            throw;
+        } catch (const std::exception& e) {
+            vlog(
+              cst_log.error,
+              "Cache eviction couldn't delete {}: {}.",
+              filename_to_remove,
+              e.what());
         }
-        _total_cleaned += deleted_size;
-        _current_cache_size -= deleted_size;
-        vlog(
-          cst_log.debug,
-          "Cache eviction deleted {} files of total size {}.",
-          i_to_delete,
-          deleted_size);
+    }
+    _total_cleaned += deleted_size;
+    update_cache_size();
+    vlog(
+      cst_log.debug,
+      "Cache eviction deleted {} files of total size {}.",
+      deleted_files,
+      deleted_size);
+    co_return deleted_size;
+}
 
-        probe.set_size(_current_cache_size);
-        probe.set_num_files(candidates_for_deletion.size() - i_to_delete);
+ss::future<uint64_t> cache::remove_if_exists(const ss::sstring& path) {
+    try {
+        co_await recursive_delete_empty_directory(path);
+    } catch (std::filesystem::filesystem_error& e) {
+        if (e.code() != std::errc::no_such_file_or_directory) {
+            throw;
+        }
     }
+    co_return _access_time_tracker.remove(path);
+}
 
-    _last_clean_up = ss::lowres_clock::now();
+ss::future<uint64_t> cache::remove_chunks(ss::sstring segment) {
+    auto dir = chunks_dir(segment);
+    if (!co_await ss::file_exists(dir)) {
+        co_return 0;
+    }
+    std::vector<ss::sstring> chunks;
+    co_await directory_walker::walk(
+      dir, [&dir, &chunks](ss::directory_entry de) {
+          chunks.push_back(ssx::sformat("{}/{}", dir, de.name));
+          return ss::now();
+      });
+    uint64_t removed_size = 0;
+    for (const auto& chunk : chunks) {
+        removed_size += co_await remove_if_exists(chunk);
+    }
+    co_return removed_size;
 }
 
-ss::future<> cache::load_access_time_tracker() {
+ss::future<bool> cache::load_access_time_tracker() {
     ss::gate::holder guard{_gate};
-    vassert(ss::this_shard_id() == 0, "Method can only be invoked on shard 0");
-    auto source = _cache_dir / access_time_tracker_file_name;
+    auto source = _cache_dir / tracker_file_name(ss::this_shard_id());
     auto present = co_await ss::file_exists(source.native());
     if (!present) {
         vlog(cst_log.info, "Access time tracker doesn't exist at '{}'", source);
-        co_return;
+        co_return false;
     }
+    bool complete = false;
     vlog(
       cst_log.info, "Trying to hydrate access time tracker from '{}'", source);
     if (auto cache_item = co_await get(source); cache_item.has_value()) {
@@ -311,7 +498,7 @@ ss::future<> cache::load_access_time_tracker() {
             co_await ss::copy(inp_stream, out_stream).finally([&inp_stream] {
                 return inp_stream.close();
             });
-            _access_time_tracker.from_iobuf(std::move(state));
+            complete = _access_time_tracker.from_iobuf(std::move(state));
         } catch (...) {
             vlog(
               cst_log.warn,
@@ -324,23 +511,28 @@ ss::future<> cache::load_access_time_tracker() {
         vlog(
           cst_log.info, "Access time tracker is not available at '{}'", source);
     }
+    co_return complete;
 }
 
-ss::future<> cache::save_access_time_tracker() {
-    ss::gate::holder guard{_gate};
-    vassert(ss::this_shard_id() == 0, "Method can only be invoked on shard 0");
-    auto source = _cache_dir / access_time_tracker_file_name;
+ss::future<> cache::save_access_time_tracker(bool complete) {
+    // The tracker file is not tracked itself. The final save happens on
+    // shutdown after the gate is closed so it doesn't use the gate.
+    auto source = _cache_dir / tracker_file_name(ss::this_shard_id());
     auto index_stream = make_iobuf_input_stream(
-      _access_time_tracker.to_iobuf());
+      _access_time_tracker.to_iobuf(complete));
     vlog(
       cst_log.debug,
       "current access_time_tracker size: {}",
       _access_time_tracker.size());
-    co_await put(source.native(), index_stream);
+    co_await write_file(
+      source.native(),
+      index_stream,
+      priority_manager::local().shadow_indexing_priority(),
+      default_write_buffer_size,
+      default_writebehind);
 }
 
 ss::future<> cache::maybe_save_access_time_tracker() {
-    vassert(ss::this_shard_id() == 0, "Method can only be invoked on shard 0");
     if (_access_time_tracker.is_dirty() && !_gate.is_closed()) {
         co_await save_access_time_tracker();
     }
@@ -353,27 +545,54 @@ ss::future<> cache::start() {
       _cache_dir);
 
     if (ss::this_shard_id() == 0) {
-        // access time tracker has to be initialized before
+        // access time trackers have to be initialized before
         // cleanup
-        co_await load_access_time_tracker();
-        co_await clean_up_at_start();
+        auto complete = co_await container().map_reduce0(
+          [](cache& c) { return c.load_access_time_tracker(); },
+          true,
+          std::logical_and<>());
+        if (complete) {
+            // The trackers were saved on clean shutdown, no need to walk
+            // the cache directory.
+            co_await container().invoke_on_all(
+              [](cache& c) { c.update_cache_size(); });
+            vlog(cst_log.info, "Using access time trackers of all shards");
+        } else {
+            co_await clean_up_at_start();
+        }
 
-        _tracker_timer.set_callback([this] {
-            ssx::spawn_with_gate(
-              _gate, [this] { return maybe_save_access_time_tracker(); });
+        co_await container().invoke_on_all([](cache& c) -> ss::future<> {
+            // Overwrite the 'complete' flag to make sure that the cache
+            // directory is walked on startup if we crash.
+            co_await c.save_access_time_tracker();
+
+            c._tracker_timer.set_callback([&c] {
+                ssx::spawn_with_gate(
+                  c._gate, [&c] { return c.maybe_save_access_time_tracker(); });
+            });
+            c._tracker_timer.arm_periodic(access_timer_period);
         });
-        _tracker_timer.arm_periodic(access_timer_period);
     }
 }
 
 ss::future<> cache::stop() {
     vlog(cst_log.debug, "Stopping archival cache service");
     _tracker_timer.cancel();
-    if (ss::this_shard_id() == 0) {
-        co_await save_access_time_tracker();
-    }
     co_await _walker.stop();
-    co_await _gate.close();
+    // In-flight puts and their access tracking have to finish before the
+    // tracker is saved as complete, otherwise the files they add would be
+    // missing from the tracker after restart. A put on any shard can add
+    // a file owned by this shard so the gates of all shards are closed
+    // before the tracker is saved.
+    co_await container().invoke_on_all([](cache& c) { return c.close(); });
+    co_await save_access_time_tracker(true);
+}
+
+ss::future<> cache::close() {
+    if (!_closed.has_value()) {
+        _closed = ss::shared_future<>(_gate.close());
+    }
+    return _closed->get_future();
 }
 
 ss::future<std::optional<cache_item>> cache::get(std::filesystem::path key) {
@@ -381,22 +600,9 @@ ss::future<std::optional<cache_item>> cache::get(std::filesystem::path key) {
     vlog(cst_log.debug, "Trying to get {} from archival cache.", key.native());
     probe.get();
     ss::file cache_file;
+    auto source = (_cache_dir / key).lexically_normal().native();
     try {
-        auto source = (_cache_dir / key).native();
         cache_file = co_await ss::open_file_dma(source, ss::open_flags::ro);
-
-        // Bump access time of the file
-        if (ss::this_shard_id() == 0) {
-            _access_time_tracker.add_timestamp(
-              source, std::chrono::system_clock::now());
-        } else {
-            ssx::spawn_with_gate(_gate, [this, source] {
-                return container().invoke_on(0, [source](cache& c) {
-                    c._access_time_tracker.add_timestamp(
-                      source, std::chrono::system_clock::now());
-                });
-            });
-        }
     } catch (std::filesystem::filesystem_error& e) {
         if (e.code() == std::errc::no_such_file_or_directory) {
             probe.miss_get();
@@ -408,6 +614,14 @@ ss::future<std::optional<cache_item>> cache::get(std::filesystem::path key) {
 
     auto data_size = co_await cache_file.size();
     probe.cached_get();
+
+    // Bump access time of the file
+    ssx::spawn_with_gate(_gate, [this, source, data_size] {
+        return container().invoke_on(
+          owner_shard(source), [source, data_size](cache& c) {
+              return c.track_access(source, data_size);
+          });
+    });
     co_return std::optional(cache_item{std::move(cache_file), data_size});
 }
 
@@ -421,6 +635,26 @@ ss::future<> cache::put(
     vlog(cst_log.debug, "Trying to put {} to archival cache.", key.native());
     probe.put();
 
+    auto written = co_await write_file(
+      std::move(key), data, io_priority, write_buffer_size, write_behind);
+
+    // Bump access time of the file and account for its size
+    ssx::spawn_with_gate(
+      _gate,
+      [this, dest = std::move(written.first), put_size = written.second] {
+          return container().invoke_on(
+            owner_shard(dest), [dest, put_size](cache& c) {
+                return c.track_access(dest, put_size);
+            });
+      });
+}
+
+ss::future<std::pair<ss::sstring, uint64_t>> cache::write_file(
+  std::filesystem::path key,
+  ss::input_stream<char>& data,
+  ss::io_priority_class io_priority,
+  size_t write_buffer_size,
+  unsigned int write_behind) {
     std::filesystem::path normal_cache_dir = _cache_dir.lexically_normal();
     std::filesystem::path normal_key_path
       = std::filesystem::path(normal_cache_dir / key).lexically_normal();
@@ -497,34 +731,33 @@ ss::future<> cache::put(
     options.io_priority_class = io_priority;
     auto out = co_await ss::make_file_output_stream(tmp_cache_file, options);
 
-    co_await ss::copy(data, out)
-      .then([&out]() { return out.flush(); })
-      .finally([&out]() { return out.close(); });
-
     // commit write transaction
     auto src = (dir_path / tmp_filename).native();
     auto dest = (dir_path / filename).native();
 
-    auto put_size = co_await ss::file_size(src);
+    uint64_t put_size = 0;
+    std::exception_ptr ex;
+    try {
+        co_await ss::copy(data, out)
+          .then([&out]() { return out.flush(); })
+          .finally([&out]() { return out.close(); });
 
-    co_await ss::rename_file(src, dest);
+        put_size = co_await ss::file_size(src);
 
-    // Bump access time of the file
-    if (ss::this_shard_id() == 0) {
-        _access_time_tracker.add_timestamp(
-          dest, std::chrono::system_clock::now());
-        ssx::spawn_with_gate(_gate, [this, dest, put_size] {
-            return consume_cache_space(put_size);
-        });
-    } else {
-        ssx::spawn_with_gate(_gate, [this, dest, put_size] {
-            return container().invoke_on(0, [dest, put_size](cache& c) {
-                c._access_time_tracker.add_timestamp(
-                  dest, std::chrono::system_clock::now());
-                return c.consume_cache_space(put_size);
-            });
-        });
+        co_await ss::rename_file(src, dest);
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    if (ex) {
+        // The tmp file is not tracked by the access time tracker and
+        // the cache directory is not walked on clean restart, so it
+        // has to be removed here.
+        vlog(
+          cst_log.warn, "Failed to put {} to archival cache: {}", dest, ex);
+        co_await ss::remove_file(src).handle_exception([](auto) {});
+        std::rethrow_exception(ex);
     }
+    co_return std::make_pair(ss::sstring(dest), put_size);
 }
 
 ss::future<cache_element_status>
@@ -543,15 +776,24 @@ cache::is_cached(const std::filesystem::path& key) {
     }
 }
 
+ss::future<bool>
+cache::has_free_space(const std::filesystem::path& key, uint64_t size) {
+    gate_guard guard{_gate};
+    auto path = (_cache_dir / key).lexically_normal().native();
+    co_return co_await container().invoke_on(
+      owner_shard(path),
+      [size](cache& c) { return c._current_cache_size + size <= c._quota; });
+}
+
 ss::future<> cache::invalidate(const std::filesystem::path& key) {
     gate_guard guard{_gate};
     vlog(
       cst_log.debug,
       "Trying to invalidate {} from archival cache.",
       key.native());
+    auto path = (_cache_dir / key).lexically_normal().native();
     try {
-        _access_time_tracker.remove_timestamp(key.native());
-        co_await recursive_delete_empty_directory((_cache_dir / key).native());
+        co_await recursive_delete_empty_directory(path);
     } catch (std::filesystem::filesystem_error& e) {
         if (e.code() == std::errc::no_such_file_or_directory) {
             vlog(
@@ -559,11 +801,20 @@ ss::future<> cache::invalidate(const std::filesystem::path& key) {
               "Could not invalidate {} from archival cache: {}",
               key.native(),
               e.what());
-            co_return;
         } else {
             throw;
         }
     }
+    co_await container().invoke_on(
+      owner_shard(path), [path](cache& c) {
+          c.track_removal(path);
+          if (is_sidecar_file(path) || is_chunk_file(path)) {
+              return ss::now();
+          }
+          // The chunks are useless without the segment
+          return c.remove_chunks(path).then(
+            [&c](uint64_t) { c.update_cache_size(); });
+      });
 };
 
 } // namespace cloud_storage
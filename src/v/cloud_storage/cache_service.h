@@ -22,8 +22,10 @@
 #include <seastar/core/gate.hh>
 #include <seastar/core/io_priority_class.hh>
 #include <seastar/core/iostream.hh>
+#include <seastar/core/shared_future.hh>
 
 #include <filesystem>
+#include <optional>
 #include <set>
 #include <string_view>
 
@@ -43,6 +45,13 @@ struct cache_item {
 enum class cache_element_status { available, not_available, in_progress };
 std::ostream& operator<<(std::ostream& o, cache_element_status);
 
+/// Cloud storage cache
+///
+/// Every file in the cache directory is owned by one shard which is
+/// chosen by the hash of the file name. The owner tracks access time and
+/// size of the file and evicts it. The maximum cache size is split between
+/// the shards. The shard which runs out of its quota borrows free quota
+/// from other shards before evicting its own files.
 class cache : public ss::peering_sharded_service<cache> {
 public:
     /// C-tor.
@@ -83,49 +92,130 @@ public:
     ss::future<cache_element_status>
     is_cached(const std::filesystem::path& key);
 
+    /// Check if 'size' bytes can be stored under the key without evicting
+    /// anything from the cache. Used to avoid speculative downloads which
+    /// would push out the data that is being read.
+    ss::future<bool>
+    has_free_space(const std::filesystem::path& key, uint64_t size);
+
     /// Remove element from cache by key
     ss::future<> invalidate(const std::filesystem::path& key);
 
-    // Total cleaned is exposed for better testability of eviction
-    uint64_t get_total_cleaned();
+    // Total cleaned by all shards is exposed for better testability of
+    // eviction
+    ss::future<uint64_t> get_total_cleaned();
 
 private:
     /// Load access time tracker from file
-    ss::future<> load_access_time_tracker();
+    ///
+    /// \return true if the tracker was saved on clean shutdown and
+    ///         describes full content of the cache directory
+    ss::future<bool> load_access_time_tracker();
 
     /// Save access time tracker to file
-    ss::future<> save_access_time_tracker();
+    ///
+    /// \param complete is set on clean shutdown when no more files
+    ///        can be added to the cache directory
+    ss::future<> save_access_time_tracker(bool complete = false);
+
+    /// Write the content of the stream to the cache directory using a tmp
+    /// file. The file is not tracked.
+    ///
+    /// \return full path of the file and its size
+    ss::future<std::pair<ss::sstring, uint64_t>> write_file(
+      std::filesystem::path key,
+      ss::input_stream<char>& data,
+      ss::io_priority_class io_priority,
+      size_t write_buffer_size,
+      unsigned int write_behind);
 
     /// Save access time tracker state to the file if needed
     ss::future<> maybe_save_access_time_tracker();
 
-    /// Triggers directory walker, creates a list of files to delete and deletes
-    /// them until cache size <= _cache_size_low_watermark * max_cache_size
+    /// Borrows quota from other shards if possible, otherwise takes least
+    /// recently used files from the access time tracker and deletes them
+    /// until cache size <= _cache_size_low_watermark * _quota
     ss::future<> clean_up_cache();
 
-    /// Triggers directory walker, creates a list of files to delete and deletes
-    /// only tmp files that are left from previous Red Panda run
+    /// Takes free quota from other shards. If it's not enough other shards
+    /// are asked to evict files which are older than the files of this
+    /// shard.
+    ss::future<> borrow_quota();
+
+    /// This method is called by the shard which borrows the quota.
+    ///
+    /// \param amount is the amount of quota the caller needs
+    /// \param older_than if set, files older than this are evicted if there
+    ///        is not enough free quota
+    /// \return the amount of quota given to the caller
+    ss::future<uint64_t> release_quota(
+      uint64_t amount,
+      std::optional<std::chrono::system_clock::time_point> older_than);
+
+    /// Deletes least recently used files owned by this shard
+    ///
+    /// \param size_to_delete is a number of bytes to delete
+    /// \param older_than if set, only files accessed earlier are deleted
+    /// \return the number of deleted bytes
+    ss::future<uint64_t> evict(
+      uint64_t size_to_delete,
+      std::optional<std::chrono::system_clock::time_point> older_than
+      = std::nullopt);
+
+    /// Triggers directory walker, rebuilds the access time trackers of all
+    /// shards and deletes tmp files that are left from previous Red Panda run
     ss::future<> clean_up_at_start();
 
+    /// Returns the shard which owns the file
+    static ss::shard_id owner_shard(std::string_view path);
+
+    /// Returns true if the file can't be evicted on its own
+    bool skip_eviction(std::string_view path) const;
+
+    /// Deletes the file if it exists and stops tracking it
+    ///
+    /// \return size of the file if it was tracked by this shard
+    ss::future<uint64_t> remove_if_exists(const ss::sstring& path);
+
+    /// Deletes the chunks of a segment hydrated with chunk reads, they're
+    /// owned by the same shard as the segment.
+    ///
+    /// \return total size of the deleted chunks
+    ss::future<uint64_t> remove_chunks(ss::sstring segment);
+
     /// Deletes a file and then recursively goes up and deletes a directory
     /// until it meet a non-empty directory.
     ///
     /// \param key if a path to a file what should be deleted
     ss::future<> recursive_delete_empty_directory(const std::string_view& key);
 
-    /// This method is called on shard 0 by other shards to report disk
-    /// space changes.
-    ss::future<> consume_cache_space(size_t);
+    /// This method is called on the owner shard by other shards to report
+    /// that the file was written or read. The cache is trimmed if needed.
+    ss::future<> track_access(ss::sstring path, uint64_t size);
+
+    /// This method is called on the owner shard by other shards to report
+    /// that the file was removed.
+    void track_removal(std::string_view path);
+
+    /// Update cache size and metrics using the access time tracker
+    void update_cache_size();
+
+    /// Close the gate. Every shard calls this on every other shard
+    /// during shutdown so the method can be called many times.
+    ss::future<> close();
 
     std::filesystem::path _cache_dir;
     size_t _max_cache_size;
+    /// Part of the max cache size available to this shard
+    uint64_t _quota;
 
     ss::gate _gate;
+    std::optional<ss::shared_future<>> _closed;
     uint64_t _cnt;
     static constexpr double _cache_size_low_watermark{0.8};
     cloud_storage::recursive_directory_walker _walker;
     uint64_t _total_cleaned;
-    /// Current size of the cache directory (only used on shard 0)
+    /// Total size of the files owned by this shard
     uint64_t _current_cache_size{0};
     ssx::semaphore _cleanup_sm{1, "cloud/cache"};
     std::set<std::filesystem::path> _files_in_progress;
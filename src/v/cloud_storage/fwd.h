@@ -13,6 +13,7 @@
 namespace cloud_storage {
 
 class cache;
+class offset_index;
 class partition_recovery_manager;
 class remote;
 class remote_partition;
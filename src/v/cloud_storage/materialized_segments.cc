@@ -184,6 +184,10 @@ ssx::semaphore_units materialized_segments::get_segment_units() {
     return _segment_units.take(1).units;
 }
 
+bool materialized_segments::has_free_segment_units() const {
+    return _segment_units.available_units() > 0;
+}
+
 void materialized_segments::trim_readers(size_t target_free) {
     vlog(
       cst_log.debug,
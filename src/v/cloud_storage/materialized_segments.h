@@ -61,6 +61,11 @@ public:
 
     ssx::semaphore_units get_segment_units();
 
+    /// True if a segment can be materialized without trimming other
+    /// segments. Speculative materialization (read-ahead) shouldn't
+    /// push out segments used by the readers.
+    bool has_free_segment_units() const;
+
     /// Wait until any evicted items in the _eviction_list have been removed.
     ss::future<> flush_evicted();
 
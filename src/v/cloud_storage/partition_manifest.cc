@@ -10,6 +10,7 @@
 
 #include "cloud_storage/partition_manifest.h"
 
+#include "absl/container/btree_map.h"
 #include "bytes/iobuf_istreambuf.h"
 #include "bytes/iobuf_ostreambuf.h"
 #include "bytes/iostream.h"
@@ -24,6 +25,7 @@
 #include "model/timestamp.h"
 #include "ssx/sformat.h"
 #include "storage/fs_utils.h"
+#include "utils/delta_for.h"
 #include "utils/to_string.h"
 #include "vlog.h"
 
@@ -36,6 +38,8 @@
 #include <rapidjson/error/en.h>
 
 #include <algorithm>
+#include <array>
+#include <cctype>
 #include <charconv>
 #include <iterator>
 #include <memory>
@@ -131,7 +135,7 @@ get_partition_manifest_path_components(const std::filesystem::path& path) {
             }
             break;
         case ix_file_name:
-            if (p != "manifest.json") {
+            if (p != "manifest.json" && p != "manifest.bin") {
                 return std::nullopt;
             }
             break;
@@ -208,23 +212,84 @@ segment_meta partition_manifest::lw_segment_meta::convert(
     };
 }
 
+partition_manifest::const_iterator::const_iterator(
+  const segment_meta_cstore& segments, size_t index)
+  : _segments(&segments)
+  , _index(index) {}
+
+partition_manifest::const_iterator::const_iterator(
+  const segment_meta_cstore& segments, segment_meta_cstore::const_iterator it)
+  : _segments(&segments)
+  , _index(it == segments.end() ? segments.size() : it.index())
+  , _it(std::move(it)) {}
+
+partition_manifest::const_iterator::const_iterator(const const_iterator& other)
+  : _segments(other._segments)
+  , _index(other._index) {}
+
+partition_manifest::const_iterator&
+partition_manifest::const_iterator::operator=(const const_iterator& other) {
+    if (this != &other) {
+        _segments = other._segments;
+        _index = other._index;
+        _it.reset();
+        _value.reset();
+    }
+    return *this;
+}
+
+partition_manifest::const_iterator::const_iterator(
+  const_iterator&& other) noexcept
+  : _segments(other._segments)
+  , _index(other._index)
+  , _it(std::move(other._it)) {}
+
+partition_manifest::const_iterator&
+partition_manifest::const_iterator::operator=(const_iterator&& other) noexcept {
+    _segments = other._segments;
+    _index = other._index;
+    _it = std::move(other._it);
+    _value.reset();
+    return *this;
+}
+
+const std::pair<const partition_manifest::key, partition_manifest::value>&
+partition_manifest::const_iterator::dereference() const {
+    if (!_value.has_value()) {
+        if (!_it.has_value()) {
+            _it = _segments->at_index(_index);
+        }
+        const auto& meta = **_it;
+        _value.emplace(meta.base_offset, meta);
+    }
+    return _value.value();
+}
+
+void partition_manifest::const_iterator::increment() {
+    if (_it.has_value()) {
+        ++(*_it);
+    }
+    ++_index;
+    _value.reset();
+}
+
+void partition_manifest::const_iterator::decrement() {
+    // The column store can only be scanned forward, the position will
+    // be looked up by index on access.
+    _it.reset();
+    --_index;
+    _value.reset();
+}
+
 partition_manifest::partition_manifest()
   : _ntp()
   , _rev()
-  , _mem_tracker(ss::make_shared<util::mem_tracker>(""))
-  , _segments(util::mem_tracked::map<absl::btree_map, key, value>(_mem_tracker))
   , _last_offset(0) {}
 
 partition_manifest::partition_manifest(
-  model::ntp ntp,
-  model::initial_revision_id rev,
-  ss::shared_ptr<util::mem_tracker> partition_mem_tracker)
+  model::ntp ntp, model::initial_revision_id rev)
   : _ntp(std::move(ntp))
   , _rev(rev)
-  , _mem_tracker(
-      partition_mem_tracker ? partition_mem_tracker->create_child("manifest")
-                            : ss::make_shared<util::mem_tracker>(""))
-  , _segments(util::mem_tracked::map<absl::btree_map, key, value>(_mem_tracker))
   , _last_offset(0) {}
 
 // NOTE: the methods that generate remote paths use the xxhash function
@@ -238,7 +303,9 @@ partition_manifest::partition_manifest(
 // backend and other S3 API implementations might benefit from that.
 
 remote_manifest_path generate_partition_manifest_path(
-  const model::ntp& ntp, model::initial_revision_id rev) {
+  const model::ntp& ntp,
+  model::initial_revision_id rev,
+  manifest_format format) {
     // NOTE: the idea here is to split all possible hash values into
     // 16 bins. Every bin should have lowest 28-bits set to 0.
     // As result, for segment names all prefixes are possible, but
@@ -248,14 +315,41 @@ remote_manifest_path generate_partition_manifest_path(
     constexpr uint32_t bitmask = 0xF0000000;
     auto path = ssx::sformat("{}_{}", ntp.path(), rev());
     uint32_t hash = bitmask & xxhash_32(path.data(), path.size());
-    return remote_manifest_path(
-      fmt::format("{:08x}/meta/{}_{}/manifest.json", hash, ntp.path(), rev()));
+    auto ext = format == manifest_format::serde ? "bin" : "json";
+    return remote_manifest_path(fmt::format(
+      "{:08x}/meta/{}_{}/manifest.{}", hash, ntp.path(), rev(), ext));
 }
 
 remote_manifest_path partition_manifest::get_manifest_path() const {
     return generate_partition_manifest_path(_ntp, _rev);
 }
 
+remote_manifest_path
+partition_manifest::get_manifest_path(manifest_format format) const {
+    return generate_partition_manifest_path(_ntp, _rev, format);
+}
+
+remote_manifest_path generate_spillover_manifest_path(
+  const model::ntp& ntp,
+  model::initial_revision_id rev,
+  const segment_meta& spillover_meta) {
+    // The spillover manifests are placed next to the partition manifest
+    // and share its prefix. The spillover manifest is never updated so
+    // its offset range can be used to make the name unique.
+    auto path = generate_partition_manifest_path(
+      ntp, rev, manifest_format::serde);
+    return remote_manifest_path(fmt::format(
+      "{}.{}.{}",
+      path(),
+      spillover_meta.base_offset(),
+      spillover_meta.committed_offset()));
+}
+
+remote_manifest_path partition_manifest::get_spillover_manifest_path(
+  const segment_meta& spillover_meta) const {
+    return generate_spillover_manifest_path(_ntp, _rev, spillover_meta);
+}
+
 const model::ntp& partition_manifest::get_ntp() const { return _ntp; }
 
 const model::offset partition_manifest::get_last_offset() const {
@@ -282,7 +376,7 @@ partition_manifest::get_start_kafka_offset() const {
     if (_start_offset != model::offset{}) {
         auto iter = _segments.find(_start_offset);
         if (iter != _segments.end()) {
-            auto delta = iter->second.delta_offset;
+            auto delta = iter->delta_offset;
             return _start_offset - delta;
         } else {
             throw std::runtime_error(fmt_with_ctx(
@@ -304,7 +398,7 @@ partition_manifest::segment_containing(kafka::offset o) const {
     // To find a segment by its kafka offset we can simply query
     // manifest by log offset and then traverse forward until we
     // find a matching segment.
-    auto it = _segments.lower_bound(kafka::offset_cast(o));
+    const_iterator it(_segments, _segments.lower_bound(kafka::offset_cast(o)));
     // We need to find first element which has greater kafka offset than
     // the target and step back. It is possible to have a segment that
     // doesn't have data batches. This scan has to skip segments like that.
@@ -319,7 +413,7 @@ partition_manifest::segment_containing(kafka::offset o) const {
             // 'o', return its previous segment.
             return std::prev(it);
         }
-        it = std::next(it);
+        ++it;
     }
     // All segments had base kafka offsets lower than 'o'.
     auto back = std::prev(it);
@@ -395,22 +489,19 @@ partition_manifest::first_addressable_segment() const {
         return end();
     }
 
-    return _segments.find(_start_offset);
+    return find(_start_offset);
 }
 
 partition_manifest::const_iterator partition_manifest::begin() const {
-    return _segments.begin();
+    return const_iterator(_segments, 0);
 }
 
 partition_manifest::const_iterator partition_manifest::end() const {
-    return _segments.end();
+    return const_iterator(_segments, _segments.size());
 }
 
 std::optional<segment_meta> partition_manifest::last_segment() const {
-    if (_segments.empty()) {
-        return std::nullopt;
-    }
-    return _segments.rbegin()->second;
+    return _segments.last_segment();
 }
 
 bool partition_manifest::empty() const { return _segments.size() == 0; }
@@ -418,19 +509,24 @@ bool partition_manifest::empty() const { return _segments.size() == 0; }
 size_t partition_manifest::size() const { return _segments.size(); }
 
 size_t partition_manifest::segments_metadata_bytes() const {
-    return _mem_tracker->consumption();
+    return _segments.inflated_actual_size().second;
 }
 
 uint64_t partition_manifest::cloud_log_size() const {
+    uint64_t archive_size = 0;
+    for (const auto& meta : _spillover_manifests) {
+        archive_size += meta.size_bytes;
+    }
+
     auto start_iter = find(_start_offset);
 
     // No addresable segments
     if (start_iter == end()) {
-        return 0;
+        return archive_size;
     }
 
     return std::transform_reduce(
-      start_iter, end(), uint64_t{0}, std::plus{}, [](const auto& seg) {
+      start_iter, end(), archive_size, std::plus{}, [](const auto& seg) {
           return seg.second.size_bytes;
       });
 }
@@ -452,14 +548,14 @@ void partition_manifest::delete_replaced_segments() { _replaced.clear(); }
 
 bool partition_manifest::advance_start_offset(model::offset new_start_offset) {
     if (new_start_offset > _start_offset && !_segments.empty()) {
-        auto it = _segments.upper_bound(new_start_offset);
-        if (it == _segments.begin()) {
+        const_iterator it(_segments, _segments.upper_bound(new_start_offset));
+        if (it == begin()) {
             return false;
         }
         it = std::prev(it);
         if (it->second.committed_offset < new_start_offset) {
             auto n = std::next(it);
-            if (n == _segments.end()) {
+            if (n == end()) {
                 // The whole offset range is supposed to be truncated
                 _start_offset = new_start_offset;
             } else {
@@ -491,30 +587,63 @@ size_t partition_manifest::replaced_segments_count() const {
     return _replaced.size();
 }
 
+template<class Pred>
+void partition_manifest::remove_segments_if(Pred pred) {
+    // The column store is append only so the segments can only be
+    // removed from the middle by rebuilding it.
+    segment_meta_cstore segments;
+    for (const auto& meta : _segments) {
+        if (!pred(meta)) {
+            segments.insert(meta);
+        }
+    }
+    _segments = std::move(segments);
+}
+
 void partition_manifest::move_aligned_offset_range(
   model::offset begin_inclusive, model::offset end_inclusive) {
-    auto it = _segments.lower_bound(begin_inclusive);
-    while (it != _segments.end()
-           // The segment is considered replaced only if all its
-           // offsets are covered by new segment's offset range
-           && it->second.base_offset >= begin_inclusive
-           && it->second.committed_offset <= end_inclusive) {
-        _replaced.push_back(lw_segment_meta::convert(it->second));
-        it = _segments.erase(it);
+    std::optional<model::offset> last_replaced;
+    auto end_it = _segments.end();
+    for (auto it = _segments.lower_bound(begin_inclusive); it != end_it;
+         ++it) {
+        // The segment is considered replaced only if all its
+        // offsets are covered by new segment's offset range
+        if (
+          it->base_offset < begin_inclusive
+          || it->committed_offset > end_inclusive) {
+            break;
+        }
+        _replaced.push_back(lw_segment_meta::convert(*it));
+        last_replaced = it->base_offset;
+    }
+    if (last_replaced.has_value()) {
+        remove_segments_if([&](const segment_meta& m) {
+            return m.base_offset >= begin_inclusive
+                   && m.base_offset <= *last_replaced;
+        });
     }
 }
 
 bool partition_manifest::add(
   const partition_manifest::key& key, const segment_meta& meta) {
+    vassert(
+      key == meta.base_offset,
+      "Segment key {} doesn't match its base offset {}",
+      key,
+      meta.base_offset);
     if (_start_offset == model::offset{} && _segments.empty()) {
         // This can happen if this is the first time we add something
         // to the manifest or if all data was removed previously.
         _start_offset = meta.base_offset;
     }
     move_aligned_offset_range(meta.base_offset, meta.committed_offset);
-    auto [it, ok] = _segments.insert(std::make_pair(key, meta));
-    if (ok && it->second.ntp_revision == model::initial_revision_id{}) {
-        it->second.ntp_revision = _rev;
+    bool ok = !_segments.contains(meta.base_offset);
+    if (ok) {
+        auto m = meta;
+        if (m.ntp_revision == model::initial_revision_id{}) {
+            m.ntp_revision = _rev;
+        }
+        _segments.insert(m);
     }
     _last_offset = std::max(meta.committed_offset, _last_offset);
     if (meta.is_compacted) {
@@ -552,13 +681,19 @@ partition_manifest::truncate(model::offset starting_rp_offset) {
 
 partition_manifest partition_manifest::truncate() {
     partition_manifest removed(_ntp, _rev);
-    for (auto it : _segments) {
-        if (it.second.committed_offset < _start_offset) {
-            removed.add(it.first, it.second);
+    std::optional<model::offset> new_head;
+    auto end_it = _segments.end();
+    for (auto it = _segments.begin(); it != end_it; ++it) {
+        if (it->committed_offset >= _start_offset) {
+            new_head = it->base_offset;
+            break;
         }
+        removed.add(it->base_offset, *it);
     }
-    for (auto s : removed._segments) {
-        _segments.erase(s.first);
+    if (!new_head.has_value()) {
+        _segments = segment_meta_cstore{};
+    } else if (!removed.empty()) {
+        _segments.prefix_truncate(*new_head);
     }
     if (_segments.empty()) {
         // start offset only makes sense if we have segments
@@ -568,16 +703,16 @@ partition_manifest partition_manifest::truncate() {
     return removed;
 }
 
-const partition_manifest::segment_meta*
+std::optional<partition_manifest::segment_meta>
 partition_manifest::get(const partition_manifest::key& key) const {
     auto it = _segments.find(key);
     if (it == _segments.end()) {
-        return nullptr;
+        return std::nullopt;
     }
-    return &it->second;
+    return *it;
 }
 
-const partition_manifest::segment_meta*
+std::optional<partition_manifest::segment_meta>
 partition_manifest::get(const segment_name& name) const {
     auto maybe_key = parse_segment_name(name);
     if (!maybe_key) {
@@ -589,16 +724,204 @@ partition_manifest::get(const segment_name& name) const {
 
 partition_manifest::const_iterator
 partition_manifest::find(model::offset o) const {
-    auto it = _segments.lower_bound(o);
-    if (it == _segments.end() || it->second.base_offset != o) {
-        return end();
+    return const_iterator(_segments, _segments.find(o));
+}
+
+const segment_meta_cstore& partition_manifest::get_spillover_map() const {
+    return _spillover_manifests;
+}
+
+std::optional<model::offset>
+partition_manifest::get_archive_start_offset() const {
+    if (_spillover_manifests.empty()) {
+        return std::nullopt;
+    }
+    return _spillover_manifests.begin()->base_offset;
+}
+
+std::optional<kafka::offset>
+partition_manifest::get_archive_start_kafka_offset() const {
+    if (_spillover_manifests.empty()) {
+        return std::nullopt;
     }
-    return it;
+    return _spillover_manifests.begin()->base_kafka_offset();
 }
 
-std::insert_iterator<partition_manifest::segment_map>
-partition_manifest::get_insert_iterator() {
-    return std::inserter(_segments, _segments.begin());
+// NOTE: every spillover manifest references a large number of segments so
+// the list of spillover manifests is short and can be scanned linearly.
+
+std::optional<segment_meta>
+partition_manifest::find_spillover(model::offset o) const {
+    for (const auto& meta : _spillover_manifests) {
+        if (meta.base_offset > o) {
+            break;
+        }
+        if (meta.committed_offset >= o) {
+            return meta;
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<segment_meta>
+partition_manifest::find_spillover(kafka::offset o) const {
+    for (const auto& meta : _spillover_manifests) {
+        if (meta.base_kafka_offset() > o) {
+            break;
+        }
+        if (meta.committed_kafka_offset() >= o) {
+            return meta;
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<segment_meta>
+partition_manifest::spillover_timequery(model::timestamp t) const {
+    for (const auto& meta : _spillover_manifests) {
+        if (meta.max_timestamp >= t) {
+            return meta;
+        }
+    }
+    return std::nullopt;
+}
+
+partition_manifest
+partition_manifest::make_spillover_manifest(size_t num_segments) const {
+    partition_manifest res(_ntp, _rev);
+    for (const auto& meta : _segments) {
+        if (res.size() == num_segments) {
+            break;
+        }
+        res.add(meta.base_offset, meta);
+    }
+    res._insync_offset = _insync_offset;
+    return res;
+}
+
+segment_meta partition_manifest::make_manifest_metadata() const {
+    vassert(
+      !_segments.empty(),
+      "Can't describe the offset range of the empty manifest {}",
+      _ntp);
+    const auto first = *_segments.begin();
+    const auto last = _segments.last_segment().value();
+    size_t size_bytes = 0;
+    auto max_timestamp = last.max_timestamp;
+    for (const auto& meta : _segments) {
+        size_bytes += meta.size_bytes;
+        max_timestamp = std::max(max_timestamp, meta.max_timestamp);
+    }
+    return segment_meta{
+      .is_compacted = false,
+      .size_bytes = size_bytes,
+      .base_offset = first.base_offset,
+      .committed_offset = last.committed_offset,
+      .base_timestamp = first.base_timestamp,
+      .max_timestamp = max_timestamp,
+      .delta_offset = first.delta_offset,
+      .ntp_revision = _rev,
+      .archiver_term = last.archiver_term,
+      .segment_term = first.segment_term,
+      .delta_offset_end = last.delta_offset_end,
+      .sname_format = segment_name_format::v2,
+    };
+}
+
+bool partition_manifest::spillover(const segment_meta& spillover_meta) {
+    auto last_spillover = _spillover_manifests.last_segment();
+    if (
+      last_spillover.has_value()
+      && last_spillover->committed_offset >= spillover_meta.base_offset) {
+        vlog(
+          cst_log.error,
+          "{} spillover manifest {} overlaps with the previous one {}",
+          _ntp,
+          spillover_meta,
+          *last_spillover);
+        return false;
+    }
+    if (
+      _start_offset != model::offset{}
+      && _start_offset > spillover_meta.base_offset
+      && _start_offset <= spillover_meta.committed_offset) {
+        vlog(
+          cst_log.error,
+          "{} spillover manifest {} contains start offset {}",
+          _ntp,
+          spillover_meta,
+          _start_offset);
+        return false;
+    }
+    if (!_segments.empty()) {
+        if (_segments.begin()->base_offset < spillover_meta.base_offset) {
+            vlog(
+              cst_log.error,
+              "{} spillover manifest {} doesn't start at the beginning of the "
+              "manifest {}",
+              _ntp,
+              spillover_meta,
+              _segments.begin()->base_offset);
+            return false;
+        }
+        // The range has to end on the segment boundary
+        auto it = _segments.upper_bound(spillover_meta.committed_offset);
+        auto ix = it == _segments.end() ? _segments.size() : it.index();
+        if (
+          ix > 0
+          && _segments.at_index(ix - 1)->committed_offset
+               != spillover_meta.committed_offset) {
+            vlog(
+              cst_log.error,
+              "{} spillover manifest {} is not aligned with segment {}",
+              _ntp,
+              spillover_meta,
+              *_segments.at_index(ix - 1));
+            return false;
+        }
+        if (it == _segments.end()) {
+            _segments = segment_meta_cstore{};
+            _start_offset = model::offset{};
+        } else {
+            auto new_head = it->base_offset;
+            _segments.prefix_truncate(new_head);
+            if (_start_offset != model::offset{}) {
+                _start_offset = std::max(_start_offset, new_head);
+            }
+        }
+    }
+    _spillover_manifests.insert(spillover_meta);
+    return true;
+}
+
+bool partition_manifest::drop_spillover(
+  const segment_meta& spillover_meta,
+  const fragmented_vector<segment_meta>& segments) {
+    if (
+      _spillover_manifests.empty()
+      || _spillover_manifests.begin()->base_offset
+           != spillover_meta.base_offset
+      || _spillover_manifests.begin()->committed_offset
+           != spillover_meta.committed_offset) {
+        vlog(
+          cst_log.error,
+          "{} spillover manifest {} is not the first one, archive start "
+          "offset: {}",
+          _ntp,
+          spillover_meta,
+          get_archive_start_offset());
+        return false;
+    }
+    if (_spillover_manifests.size() == 1) {
+        _spillover_manifests = segment_meta_cstore{};
+    } else {
+        _spillover_manifests.prefix_truncate(
+          _spillover_manifests.at_index(1)->base_offset);
+    }
+    for (const auto& meta : segments) {
+        _replaced.push_back(lw_segment_meta::convert(meta));
+    }
+    return true;
 }
 
 //@formatter:off
@@ -656,9 +979,6 @@ struct partition_manifest_handler
       BaseReaderHandler<rapidjson::UTF8<>, partition_manifest_handler> {
     using key_string = ss::basic_sstring<char, uint32_t, 31>;
 
-    explicit partition_manifest_handler(ss::shared_ptr<util::mem_tracker> mt)
-      : _manifest_mem_tracker(std::move(mt)) {}
-
     bool StartObject() {
         switch (_state) {
         case state::expect_manifest_start:
@@ -875,11 +1195,7 @@ struct partition_manifest_handler
                 segment_name_format::v1)};
             if (_state == state::expect_segment_meta_key) {
                 if (!_segments) {
-                    _segments = std::make_unique<segment_map>(
-                      util::mem_tracked::map<
-                        absl::btree_map,
-                        partition_manifest::key,
-                        partition_manifest::value>(_manifest_mem_tracker));
+                    _segments = std::make_unique<segment_map>();
                 }
                 _segments->insert(
                   std::make_pair(_segment_key.base_offset, _meta));
@@ -994,7 +1310,9 @@ struct partition_manifest_handler
         terminal_state,
     } _state{state::expect_manifest_start};
 
-    using segment_map = partition_manifest::segment_map;
+    // Segments are not guaranteed to be sorted in the json document
+    using segment_map
+      = absl::btree_map<partition_manifest::key, partition_manifest::value>;
     using replaced_segments_list = partition_manifest::replaced_segments_list;
 
     key_string _manifest_key;
@@ -1033,8 +1351,6 @@ struct partition_manifest_handler
     std::optional<model::offset_delta> _delta_offset_end;
     std::optional<segment_name_format> _meta_sname_format;
 
-    ss::shared_ptr<util::mem_tracker> _manifest_mem_tracker;
-
     void check_that_required_meta_fields_are_present() {
         if (!_size_bytes) {
             throw std::runtime_error(fmt_with_ctx(
@@ -1102,15 +1418,341 @@ struct partition_manifest_handler
     }
 };
 
+namespace {
+
+/// Number of segments encoded or decoded between the scheduling points
+/// of the binary manifest serialization (multiple of the row size)
+constexpr size_t binary_segments_per_yield = 512;
+
+static_assert(binary_segments_per_yield % ::details::FOR_buffer_depth == 0);
+
+/// The json manifest is an object so its first meaningful character is
+/// the opening brace. The serde encoded manifest starts with the envelope
+/// version byte which can't be confused with it.
+bool is_json_manifest(const iobuf& buf) {
+    for (const auto& frag : buf) {
+        for (char c : std::string_view(frag.get(), frag.size())) {
+            if (std::isspace(static_cast<unsigned char>(c)) == 0) {
+                return c == '{';
+            }
+        }
+    }
+    return true;
+}
+
+/// Column of the segment metadata in the binary manifest. Complete rows
+/// are delta-FOR encoded, the values of the last incomplete row are
+/// stored as is.
+struct manifest_column
+  : serde::envelope<
+      manifest_column,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    int64_t initial_value;
+    uint32_t num_rows;
+    iobuf rows;
+    std::vector<int64_t> tail;
+};
+
+/// Binary partition manifest (manifest.bin)
+///
+/// The segment metadata is stored column by column in the order of
+/// the segment_meta fields. New fields can only be added to the end
+/// of the envelope and as new columns.
+///
+/// Version 1 adds the metadata of the spillover manifests which is
+/// stored in the same columnar format as the segment metadata.
+struct partition_manifest_binary
+  : serde::envelope<
+      partition_manifest_binary,
+      serde::version<1>,
+      serde::compat_version<0>> {
+    model::ntp ntp;
+    model::initial_revision_id revision;
+    model::offset last_offset;
+    model::offset start_offset;
+    model::offset last_uploaded_compacted_offset;
+    model::offset insync_offset;
+    uint64_t num_segments;
+    std::vector<manifest_column> columns;
+    std::vector<segment_meta> replaced;
+    uint64_t num_spillover_manifests{0};
+    std::vector<manifest_column> spillover_columns;
+};
+
+constexpr size_t segment_meta_num_columns = 12;
+
+using segment_meta_row = std::array<int64_t, segment_meta_num_columns>;
+
+segment_meta_row to_row(const segment_meta& m) {
+    return {
+      static_cast<int64_t>(m.is_compacted),
+      static_cast<int64_t>(m.size_bytes),
+      m.base_offset(),
+      m.committed_offset(),
+      m.base_timestamp.value(),
+      m.max_timestamp.value(),
+      m.delta_offset(),
+      m.ntp_revision(),
+      m.archiver_term(),
+      m.segment_term(),
+      m.delta_offset_end(),
+      static_cast<int64_t>(m.sname_format),
+    };
+}
+
+segment_meta from_row(const segment_meta_row& r) {
+    return segment_meta{
+      .is_compacted = r[0] != 0,
+      .size_bytes = static_cast<size_t>(r[1]),
+      .base_offset = model::offset(r[2]),
+      .committed_offset = model::offset(r[3]),
+      .base_timestamp = model::timestamp(r[4]),
+      .max_timestamp = model::timestamp(r[5]),
+      .delta_offset = model::offset_delta(r[6]),
+      .ntp_revision = model::initial_revision_id(r[7]),
+      .archiver_term = model::term_id(r[8]),
+      .segment_term = model::term_id(r[9]),
+      .delta_offset_end = model::offset_delta(r[10]),
+      .sname_format = static_cast<segment_name_format>(r[11]),
+    };
+}
+
+/// Builds a single manifest_column from the sequence of values
+class column_encoder {
+    using encoder_t = deltafor_encoder<int64_t>;
+
+public:
+    void add(int64_t value) {
+        if (!_encoder.has_value()) {
+            _encoder.emplace(value);
+        }
+        _row.at(_pos++) = value;
+        if (_pos == _row.size()) {
+            _encoder->add(_row);
+            _pos = 0;
+        }
+    }
+
+    manifest_column finish() && {
+        manifest_column col{
+          .initial_value = 0,
+          .num_rows = 0,
+          .tail = std::vector<int64_t>(_row.begin(), _row.begin() + _pos),
+        };
+        if (_encoder.has_value()) {
+            col.initial_value = _encoder->get_initial_value();
+            col.num_rows = _encoder->get_row_count();
+            col.rows = _encoder->share();
+        }
+        return col;
+    }
+
+private:
+    std::optional<encoder_t> _encoder;
+    encoder_t::row_t _row{};
+    size_t _pos{0};
+};
+
+using segment_meta_encoders
+  = std::array<column_encoder, segment_meta_num_columns>;
+
+void encode_segment(segment_meta_encoders& encoders, const segment_meta& m) {
+    auto row = to_row(m);
+    for (size_t c = 0; c < segment_meta_num_columns; c++) {
+        encoders.at(c).add(row.at(c));
+    }
+}
+
+std::vector<manifest_column> finish_columns(segment_meta_encoders& encoders) {
+    std::vector<manifest_column> columns;
+    columns.reserve(segment_meta_num_columns);
+    for (auto& enc : encoders) {
+        columns.push_back(std::move(enc).finish());
+    }
+    return columns;
+}
+
+/// Decodes the segment metadata stored in manifest columns
+class columns_decoder {
+public:
+    columns_decoder(
+      const remote_manifest_path& path,
+      uint64_t num_segments,
+      std::vector<manifest_column>& columns)
+      : _num_rows(num_segments / ::details::FOR_buffer_depth)
+      , _tail_size(num_segments % ::details::FOR_buffer_depth)
+      , _columns(columns) {
+        if (columns.size() != segment_meta_num_columns) {
+            throw std::runtime_error(fmt_with_ctx(
+              fmt::format,
+              "Binary partition manifest {} has {} columns, expected {}",
+              path,
+              columns.size(),
+              segment_meta_num_columns));
+        }
+        _decoders.reserve(segment_meta_num_columns);
+        for (auto& col : columns) {
+            if (col.num_rows != _num_rows || col.tail.size() != _tail_size) {
+                throw std::runtime_error(fmt_with_ctx(
+                  fmt::format,
+                  "Binary partition manifest {} column size mismatch, {} "
+                  "rows and {} trailing values, expected {} segments",
+                  path,
+                  col.num_rows,
+                  col.tail.size(),
+                  num_segments));
+            }
+            _decoders.emplace_back(
+              col.initial_value, col.num_rows, std::move(col.rows));
+        }
+    }
+
+    size_t num_rows() const { return _num_rows; }
+
+    /// Decode next complete row of every column
+    void read_row(segment_meta_cstore& segments) {
+        std::array<deltafor_decoder<int64_t>::row_t, segment_meta_num_columns>
+          rows{};
+        for (size_t c = 0; c < segment_meta_num_columns; c++) {
+            _decoders[c].read(rows.at(c));
+        }
+        for (size_t i = 0; i < ::details::FOR_buffer_depth; i++) {
+            segment_meta_row row{};
+            for (size_t c = 0; c < segment_meta_num_columns; c++) {
+                row.at(c) = rows.at(c).at(i);
+            }
+            segments.insert(from_row(row));
+        }
+    }
+
+    /// Decode values of the last incomplete row
+    void read_tail(segment_meta_cstore& segments) {
+        for (size_t i = 0; i < _tail_size; i++) {
+            segment_meta_row row{};
+            for (size_t c = 0; c < segment_meta_num_columns; c++) {
+                row.at(c) = _columns[c].tail[i];
+            }
+            segments.insert(from_row(row));
+        }
+    }
+
+private:
+    size_t _num_rows;
+    size_t _tail_size;
+    std::vector<manifest_column>& _columns;
+    std::vector<deltafor_decoder<int64_t>> _decoders;
+};
+
+} // namespace
+
+ss::future<iobuf> partition_manifest::serialize_binary() const {
+    auto iso = _insync_offset;
+    segment_meta_encoders encoders;
+    size_t ix = 0;
+    while (ix < _segments.size()) {
+        {
+            // The iterator can't be used across the scheduling point
+            // because the manifest can be updated concurrently.
+            auto it = _segments.at_index(ix);
+            auto end = _segments.end();
+            for (size_t i = 0; i < binary_segments_per_yield && it != end;
+                 ++i, ++it, ++ix) {
+                encode_segment(encoders, *it);
+            }
+        }
+        co_await ss::maybe_yield();
+        if (iso != _insync_offset) {
+            throw std::runtime_error(fmt_with_ctx(
+              fmt::format,
+              "Manifest changed during serialization, in sync offset moved "
+              "from {} to {}",
+              iso,
+              _insync_offset));
+        }
+    }
+
+    partition_manifest_binary bin{
+      .ntp = _ntp,
+      .revision = _rev,
+      .last_offset = _last_offset,
+      .start_offset = _start_offset,
+      .last_uploaded_compacted_offset = _last_uploaded_compacted_offset,
+      .insync_offset = _insync_offset,
+      .num_segments = ix,
+      .columns = finish_columns(encoders),
+      .num_spillover_manifests = _spillover_manifests.size(),
+    };
+    bin.replaced.reserve(_replaced.size());
+    for (const auto& lw : _replaced) {
+        bin.replaced.push_back(lw_segment_meta::convert(lw));
+    }
+    segment_meta_encoders spillover_encoders;
+    for (const auto& meta : _spillover_manifests) {
+        encode_segment(spillover_encoders, meta);
+    }
+    bin.spillover_columns = finish_columns(spillover_encoders);
+    co_return serde::to_iobuf(std::move(bin));
+}
+
+ss::future<> partition_manifest::update_binary(iobuf buf) {
+    iobuf_parser parser(std::move(buf));
+    auto bin = serde::read<partition_manifest_binary>(parser);
+    const auto path = get_manifest_path(manifest_format::serde);
+
+    segment_meta_cstore segments;
+    columns_decoder decoder(path, bin.num_segments, bin.columns);
+    for (size_t r = 0; r < decoder.num_rows(); r++) {
+        decoder.read_row(segments);
+        if (
+          (r + 1) * ::details::FOR_buffer_depth % binary_segments_per_yield
+          == 0) {
+            co_await ss::maybe_yield();
+        }
+    }
+    decoder.read_tail(segments);
+
+    segment_meta_cstore spillover;
+    if (bin.num_spillover_manifests != 0) {
+        // Manifests encoded before version 1 have no spillover columns
+        columns_decoder spillover_decoder(
+          path, bin.num_spillover_manifests, bin.spillover_columns);
+        for (size_t r = 0; r < spillover_decoder.num_rows(); r++) {
+            spillover_decoder.read_row(spillover);
+        }
+        spillover_decoder.read_tail(spillover);
+    }
+
+    replaced_segments_list replaced;
+    replaced.reserve(bin.replaced.size());
+    for (const auto& meta : bin.replaced) {
+        replaced.push_back(lw_segment_meta::convert(meta));
+    }
+
+    _ntp = std::move(bin.ntp);
+    _rev = bin.revision;
+    _last_offset = bin.last_offset;
+    _start_offset = bin.start_offset;
+    _last_uploaded_compacted_offset = bin.last_uploaded_compacted_offset;
+    _insync_offset = bin.insync_offset;
+    _segments = std::move(segments);
+    _replaced = std::move(replaced);
+    _spillover_manifests = std::move(spillover);
+}
+
 ss::future<> partition_manifest::update(ss::input_stream<char> is) {
     iobuf result;
     auto os = make_iobuf_ref_output_stream(result);
     co_await ss::copy(is, os);
+    if (!is_json_manifest(result)) {
+        co_await update_binary(std::move(result));
+        co_return;
+    }
     iobuf_istreambuf ibuf(result);
     std::istream stream(&ibuf);
     json::IStreamWrapper wrapper(stream);
     rapidjson::Reader reader;
-    partition_manifest_handler handler(_mem_tracker);
+    partition_manifest_handler handler;
 
     if (reader.Parse(wrapper, handler)) {
         partition_manifest::update(std::move(handler));
@@ -1157,16 +1799,21 @@ void partition_manifest::update(partition_manifest_handler&& handler) {
     }
 
     if (handler._segments) {
-        _segments = std::move(*handler._segments);
+        _segments = segment_meta_cstore{};
+        for (const auto& [key, meta] : *handler._segments) {
+            _segments.insert(meta);
+        }
         if (handler._start_offset == std::nullopt && !_segments.empty()) {
             // Backward compatibility. Old manifest format doesn't have
             // start_offset field. In this case we need to set it implicitly.
-            _start_offset = _segments.begin()->second.base_offset;
+            _start_offset = _segments.begin()->base_offset;
         }
     }
     if (handler._replaced) {
         _replaced = std::move(*handler._replaced);
     }
+    // The spillover manifests are only referenced by the binary manifest
+    _spillover_manifests = segment_meta_cstore{};
 }
 
 // This object is supposed to track state of the asynchronous
@@ -1227,6 +1874,18 @@ ss::future<serialized_json_stream> partition_manifest::serialize() const {
       .size_bytes = size_bytes};
 }
 
+ss::future<serialized_json_stream>
+partition_manifest::serialize(manifest_format format) const {
+    if (format == manifest_format::json) {
+        co_return co_await serialize();
+    }
+    auto serialized = co_await serialize_binary();
+    size_t size_bytes = serialized.size_bytes();
+    co_return serialized_json_stream{
+      .stream = make_iobuf_input_stream(std::move(serialized)),
+      .size_bytes = size_bytes};
+}
+
 void partition_manifest::serialize(std::ostream& out) const {
     serialization_cursor_ptr c = make_cursor(out);
     serialize_begin(c);
@@ -1382,27 +2041,27 @@ void partition_manifest::serialize_segments(
         // The method is called first time
         w.Key("segments");
         w.StartObject();
-        cursor->next_offset = _segments.begin()->second.base_offset;
+        cursor->next_offset = _segments.begin()->base_offset;
     }
     if (!_segments.empty()) {
         auto it = _segments.lower_bound(cursor->next_offset);
-        for (; it != _segments.end(); it++) {
-            const auto& [key, meta] = *it;
-            serialize_segment_meta(meta, cursor);
+        auto end_it = _segments.end();
+        for (; it != end_it; ++it) {
+            serialize_segment_meta(*it, cursor);
             cursor->segments_serialized++;
             if (cursor->segments_serialized >= cursor->max_segments_per_call) {
                 cursor->segments_serialized = 0;
-                it++;
+                ++it;
                 break;
             }
         }
-        if (it == _segments.end()) {
+        if (it == end_it) {
             cursor->next_offset = _last_offset;
         } else {
             // We hit the limit on number of serialized segment
             // metadata objects and 'it' points to the first segment
             // which is not serialized yet.
-            cursor->next_offset = it->second.base_offset;
+            cursor->next_offset = it->base_offset;
         }
     }
     if (cursor->next_offset == _last_offset && !_segments.empty()) {
@@ -1438,12 +2097,12 @@ void partition_manifest::serialize_end(serialization_cursor_ptr cursor) const {
 
 bool partition_manifest::delete_permanently(
   const partition_manifest::key& key) {
-    auto it = _segments.find(key);
-    if (it != _segments.end()) {
-        _segments.erase(it);
-        return true;
+    if (!_segments.contains(key)) {
+        return false;
     }
-    return false;
+    remove_segments_if(
+      [&key](const segment_meta& m) { return m.base_offset == key; });
+    return true;
 }
 
 partition_manifest::const_iterator
@@ -1452,8 +2111,8 @@ partition_manifest::segment_containing(model::offset o) const {
         return end();
     }
 
-    auto it = _segments.upper_bound(o);
-    if (it == _segments.begin()) {
+    const_iterator it(_segments, _segments.upper_bound(o));
+    if (it == begin()) {
         return end();
     }
 
@@ -1485,27 +2144,29 @@ partition_manifest::segment_containing(model::offset o) const {
  * 3. Do linear search backward or forward from the location
  *    we probed, to find the right segment.
  */
-std::optional<std::reference_wrapper<const partition_manifest::segment_meta>>
+std::optional<partition_manifest::segment_meta>
 partition_manifest::timequery(model::timestamp t) const {
     if (_segments.empty()) {
         return std::nullopt;
     }
 
-    auto base_t = _segments.begin()->second.base_timestamp;
-    auto max_t = _segments.rbegin()->second.max_timestamp;
-    auto base_offset = _segments.begin()->second.base_offset;
-    auto max_offset = _segments.rbegin()->second.committed_offset;
+    const auto first = *_segments.begin();
+    const auto last = _segments.last_segment().value();
+    auto base_t = first.base_timestamp;
+    auto max_t = last.max_timestamp;
+    auto base_offset = first.base_offset;
+    auto max_offset = last.committed_offset;
 
     // Fast handling of bounds/edge cases to simplify subsequent
     // arithmetic steps
     if (t < base_t) {
-        return _segments.begin()->second;
+        return first;
     } else if (t > max_t) {
         return std::nullopt;
     } else if (max_t == base_t) {
         // This is plausible in the case of a single segment with
         // a single batch using LogAppendTime.
-        return _segments.begin()->second;
+        return first;
     }
 
     // Single-offset case should have hit max_t==base_t above
@@ -1530,9 +2191,10 @@ partition_manifest::timequery(model::timestamp t) const {
 
     // 2. Convert offset guess into segment guess.  This is not a strictly
     // correct offset lookup, we just want something close.
-    auto segment_iter = _segments.lower_bound(interpolated_offset);
-    if (segment_iter == _segments.end()) {
-        segment_iter = --_segments.end();
+    const_iterator segment_iter(
+      _segments, _segments.lower_bound(interpolated_offset));
+    if (segment_iter == end()) {
+        segment_iter = std::prev(end());
     }
     vlog(
       cst_log.debug,
@@ -1545,7 +2207,7 @@ partition_manifest::timequery(model::timestamp t) const {
     if (segment_iter->second.base_timestamp < t) {
         // Our guess's base_timestamp is before the search point, so our
         // result must be this segment or a later one: search forward
-        for (; segment_iter != _segments.end(); ++segment_iter) {
+        for (; segment_iter != end(); ++segment_iter) {
             auto base_timestamp = segment_iter->second.base_timestamp;
             auto max_timestamp = segment_iter->second.max_timestamp;
             if (max_timestamp >= t) {
@@ -1565,7 +2227,7 @@ partition_manifest::timequery(model::timestamp t) const {
         vlog(
           cst_log.debug, "timequery t={} reverse {}", t, segment_iter->second);
 
-        while (segment_iter != _segments.begin()) {
+        while (segment_iter != begin()) {
             vlog(
               cst_log.debug,
               "timequery t={} reverse {}",
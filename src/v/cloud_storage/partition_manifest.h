@@ -10,17 +10,19 @@
 
 #pragma once
 
-#include "absl/container/btree_map.h"
 #include "cloud_storage/base_manifest.h"
+#include "cloud_storage/segment_meta_cstore.h"
 #include "cloud_storage/types.h"
 #include "model/metadata.h"
 #include "model/timestamp.h"
 #include "serde/serde.h"
-#include "utils/tracking_allocator.h"
 
 #include <seastar/core/shared_ptr.hh>
 
+#include <boost/iterator/iterator_facade.hpp>
+
 #include <deque>
+#include <optional>
 
 namespace cloud_storage {
 
@@ -65,8 +67,17 @@ remote_segment_path generate_remote_segment_path(
 /// Generate correct S3 segment name based on term and base offset
 segment_name generate_local_segment_name(model::offset o, model::term_id t);
 
-remote_manifest_path
-generate_partition_manifest_path(const model::ntp&, model::initial_revision_id);
+remote_manifest_path generate_partition_manifest_path(
+  const model::ntp&,
+  model::initial_revision_id,
+  manifest_format format = manifest_format::json);
+
+/// Path of the spillover manifest which contains the segments in the
+/// offset range of 'spillover_meta' (see partition_manifest::spillover)
+remote_manifest_path generate_spillover_manifest_path(
+  const model::ntp&,
+  model::initial_revision_id,
+  const segment_meta& spillover_meta);
 
 // This structure can be impelenented
 // to allow access to private fields of the manifest.
@@ -103,10 +114,47 @@ public:
     /// Segment key in the maifest
     using key = model::offset;
     using value = segment_meta;
-    using segment_map = util::mem_tracked::map_t<absl::btree_map, key, value>;
     using replaced_segments_list = std::vector<lw_segment_meta>;
-    using const_iterator = segment_map::const_iterator;
-    using const_reverse_iterator = segment_map::const_reverse_iterator;
+
+    /// Iterator over the segments of the manifest
+    ///
+    /// The segments are stored in the columnar format so the iterator
+    /// materializes the (base offset, segment_meta) pair on access. The
+    /// reference returned by the iterator is valid until the iterator
+    /// is changed or destroyed. Sequential forward scans reuse the
+    /// position in the column store, other movements seek by index.
+    class const_iterator
+      : public boost::iterator_facade<
+          const_iterator,
+          const std::pair<const key, value>,
+          boost::iterators::bidirectional_traversal_tag> {
+        friend class boost::iterator_core_access;
+
+    public:
+        const_iterator() = default;
+        const_iterator(const segment_meta_cstore& segments, size_t index);
+        const_iterator(
+          const segment_meta_cstore& segments,
+          segment_meta_cstore::const_iterator it);
+        const_iterator(const const_iterator& other);
+        const_iterator& operator=(const const_iterator& other);
+        const_iterator(const_iterator&& other) noexcept;
+        const_iterator& operator=(const_iterator&& other) noexcept;
+        ~const_iterator() = default;
+
+    private:
+        const std::pair<const key, value>& dereference() const;
+        void increment();
+        void decrement();
+        bool equal(const const_iterator& other) const {
+            return _index == other._index;
+        }
+
+        const segment_meta_cstore* _segments{nullptr};
+        size_t _index{0};
+        mutable std::optional<segment_meta_cstore::const_iterator> _it;
+        mutable std::optional<std::pair<const key, value>> _value;
+    };
 
     /// Generate segment name to use in the cloud
     static segment_name generate_remote_segment_name(const value& val);
@@ -120,29 +168,23 @@ public:
     /// Create empty manifest that supposed to be updated later
     partition_manifest();
 
-    /// Create manifest for specific ntp with memory tracked on a child tracker
-    /// of `partition_mem_tracker`.
+    /// Create manifest for specific ntp
     explicit partition_manifest(
-      model::ntp ntp,
-      model::initial_revision_id rev,
-      ss::shared_ptr<util::mem_tracker> partition_mem_tracker = nullptr);
+      model::ntp ntp, model::initial_revision_id rev);
 
     template<class segment_t>
     partition_manifest(
       model::ntp ntp,
       model::initial_revision_id rev,
-      ss::shared_ptr<util::mem_tracker> manifest_mem_tracker,
       model::offset so,
       model::offset lo,
       model::offset lco,
       model::offset insync,
       const fragmented_vector<segment_t>& segments,
-      const fragmented_vector<segment_t>& replaced)
+      const fragmented_vector<segment_t>& replaced,
+      const fragmented_vector<segment_meta>& spillover = {})
       : _ntp(std::move(ntp))
       , _rev(rev)
-      , _mem_tracker(std::move(manifest_mem_tracker))
-      , _segments(
-          util::mem_tracked::map<absl::btree_map, key, value>(_mem_tracker))
       , _last_offset(lo)
       , _start_offset(so)
       , _last_uploaded_compacted_offset(lco)
@@ -163,12 +205,20 @@ public:
               "can't parse name of the segment in the manifest '{}'",
               nm.name);
             nm.meta.segment_term = maybe_key->term;
-            _segments.insert(std::make_pair(nm.meta.base_offset, nm.meta));
+            _segments.insert(nm.meta);
+        }
+        for (const auto& meta : spillover) {
+            _spillover_manifests.insert(meta);
         }
     }
 
     /// Manifest object name in S3
     remote_manifest_path get_manifest_path() const override;
+    remote_manifest_path get_manifest_path(manifest_format format) const;
+
+    /// Spillover manifest object name in S3
+    remote_manifest_path
+    get_spillover_manifest_path(const segment_meta& spillover_meta) const;
 
     /// Get NTP
     const model::ntp& get_ntp() const;
@@ -198,8 +248,25 @@ public:
     model::initial_revision_id get_revision_id() const;
 
     /// Find the earliest segment that has max timestamp >= t
-    std::optional<std::reference_wrapper<const segment_meta>>
-    timequery(model::timestamp t) const;
+    std::optional<segment_meta> timequery(model::timestamp t) const;
+
+    /// Return metadata of the spillover manifests
+    ///
+    /// Every element describes the offset range of one spillover manifest,
+    /// its base_offset and committed_offset are the offsets of the first
+    /// and the last segment moved to the spillover manifest.
+    const segment_meta_cstore& get_spillover_map() const;
+
+    /// Get starting offset of the data moved to the spillover manifests
+    std::optional<model::offset> get_archive_start_offset() const;
+    std::optional<kafka::offset> get_archive_start_kafka_offset() const;
+
+    /// Find the spillover manifest which contains the offset
+    std::optional<segment_meta> find_spillover(model::offset o) const;
+    std::optional<segment_meta> find_spillover(kafka::offset o) const;
+
+    /// Find the earliest spillover manifest that has max timestamp >= t
+    std::optional<segment_meta> spillover_timequery(model::timestamp t) const;
 
     remote_segment_path generate_segment_path(const segment_meta&) const;
     remote_segment_path generate_segment_path(const lw_segment_meta&) const;
@@ -216,13 +283,13 @@ public:
     size_t size() const;
     bool empty() const;
 
-    // Return the tracked amount of memory associated with the segments in this
-    // manifest, or 0 if the memory is not being tracked.
+    // Return the amount of memory used by the segments metadata
     size_t segments_metadata_bytes() const;
 
     // Computes the size in bytes of all segments available to clients
-    // (i.e. all segments after and including the segment that starts at
-    // the current _start_offset).
+    // (i.e. all segments moved to the spillover manifests and all segments
+    // after and including the segment that starts at the current
+    // _start_offset).
     uint64_t cloud_log_size() const;
 
     /// Check if the manifest contains particular segment
@@ -230,6 +297,9 @@ public:
     bool contains(const segment_name& name) const;
 
     /// Add new segment to the manifest
+    ///
+    /// Segments are indexed by their base offset, the key has to be equal
+    /// to meta.base_offset.
     bool add(const key& key, const segment_meta& meta);
     bool add(const segment_name& name, const segment_meta& meta);
 
@@ -251,16 +321,50 @@ public:
     /// \returns true if start offset was moved
     bool advance_start_offset(model::offset start_offset);
 
+    /// \brief Create the spillover manifest
+    ///
+    /// \param num_segments is a number of segments (starting from the
+    ///        beginning of the manifest) to move to the spillover manifest
+    /// \return manifest that contains the first 'num_segments' segments
+    partition_manifest make_spillover_manifest(size_t num_segments) const;
+
+    /// Describe the offset range of the manifest using a single
+    /// segment_meta (used to reference the spillover manifest)
+    segment_meta make_manifest_metadata() const;
+
+    /// \brief Remove segments moved to the spillover manifest
+    ///
+    /// The segments covered by the offset range of 'spillover_meta'
+    /// are removed and the metadata of the spillover manifest is
+    /// stored instead. The range has to start at the beginning of the
+    /// manifest and end on a segment boundary.
+    /// \return true if the segments were removed
+    bool spillover(const segment_meta& spillover_meta);
+
+    /// \brief Remove the oldest spillover manifest
+    ///
+    /// The metadata of the spillover manifest is removed and the
+    /// segments it references are added to the list of replaced
+    /// segments so they can be garbage collected. The archive start
+    /// offset is moved to the next spillover manifest or to the start
+    /// of the manifest.
+    /// \param spillover_meta is a metadata of the first spillover manifest
+    /// \param segments are the segments of the spillover manifest
+    /// \return true if the spillover manifest was removed
+    bool drop_spillover(
+      const segment_meta& spillover_meta,
+      const fragmented_vector<segment_meta>& segments);
+
     /// Get segment if available or nullopt
-    const segment_meta* get(const key& key) const;
-    const segment_meta* get(const segment_name& name) const;
+    std::optional<segment_meta> get(const key& key) const;
+    std::optional<segment_meta> get(const segment_name& name) const;
     /// Find element of the manifest by offset
     const_iterator find(model::offset o) const;
 
-    /// Get insert iterator for segments set
-    std::insert_iterator<segment_map> get_insert_iterator();
-
     /// Update manifest file from input_stream (remote set)
+    ///
+    /// Both json and serde encoded manifests are accepted, the format
+    /// is detected using the first byte of the stream.
     ss::future<> update(ss::input_stream<char> is) override;
 
     /// Serialize manifest object
@@ -268,12 +372,19 @@ public:
     /// \return asynchronous input_stream with the serialized json
     ss::future<serialized_json_stream> serialize() const override;
 
+    /// Serialize manifest object using the specified format
+    ///
+    /// Metadata of the spillover manifests can only be encoded
+    /// using the serde format.
+    /// \return asynchronous input_stream with the serialized manifest
+    ss::future<serialized_json_stream> serialize(manifest_format format) const;
+
     /// Serialize manifest object
     ///
     /// \param out output stream that should be used to output the json
     void serialize(std::ostream& out) const;
 
-    /// Compare two manifests for equality. Don't compare the mem_tracker.
+    /// Compare two manifests for equality
     bool operator==(const partition_manifest& other) const {
         return _ntp == other._ntp && _rev == other._rev
                && _segments == other._segments
@@ -282,7 +393,8 @@ public:
                && _last_uploaded_compacted_offset
                     == other._last_uploaded_compacted_offset
                && _insync_offset == other._insync_offset
-               && _replaced == other._replaced;
+               && _replaced == other._replaced
+               && _spillover_manifests == other._spillover_manifests;
     }
 
     /// Remove segment record from manifest
@@ -315,17 +427,26 @@ public:
     /// after the call.
     void delete_replaced_segments();
 
-    ss::shared_ptr<util::mem_tracker> mem_tracker() { return _mem_tracker; }
-
 private:
     /// Update manifest content from json document that supposed to be generated
     /// from manifest.json file
     void update(partition_manifest_handler&& handler);
 
+    /// Update manifest content from the serde encoded manifest.bin
+    ss::future<> update_binary(iobuf buf);
+
+    /// Encode manifest content as a serde envelope
+    ss::future<iobuf> serialize_binary() const;
+
     /// Move segments from _segments to _replaced
     void move_aligned_offset_range(
       model::offset begin_inclusive, model::offset end_inclusive);
 
+    /// Rebuild _segments without the segments for which the predicate
+    /// returns true
+    template<class Pred>
+    void remove_segments_if(Pred pred);
+
     friend class serialization_cursor_data_source;
 
     struct serialization_cursor;
@@ -349,18 +470,15 @@ private:
 
     model::ntp _ntp;
     model::initial_revision_id _rev;
-
-    // Tracker of memory for this manifest.
-    // Currently only tracks memory allocated for `_segments`.
-    ss::shared_ptr<util::mem_tracker> _mem_tracker;
-
-    segment_map _segments;
+    segment_meta_cstore _segments;
     /// Collection of replaced but not yet removed segments
     replaced_segments_list _replaced;
     model::offset _last_offset;
     model::offset _start_offset;
     model::offset _last_uploaded_compacted_offset;
     model::offset _insync_offset;
+    /// Metadata of the spillover manifests
+    segment_meta_cstore _spillover_manifests;
 };
 
 } // namespace cloud_storage
@@ -16,6 +16,7 @@
 #include "cloud_storage/topic_manifest.h"
 #include "cloud_storage/types.h"
 #include "cluster/topic_recovery_status_frontend.h"
+#include "config/configuration.h"
 #include "hashing/xx.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
@@ -116,7 +117,12 @@ ss::future<log_recovery_result> partition_recovery_manager::download_log(
           result.completed,
           result.manifest.get_manifest_path());
         co_await cloud_storage::place_download_result(
-          _remote.local(), _bucket, ntp_cfg, result.completed, fib);
+          _remote.local(),
+          _bucket,
+          ntp_cfg,
+          result.completed,
+          result.downloaded_bytes,
+          fib);
     }
     co_return result;
 }
@@ -276,12 +282,58 @@ get_retention_policy(const storage::ntp_config::default_overrides& prop) {
     return std::monostate();
 }
 
-static auto build_offset_map(const partition_manifest& manifest) {
-    absl::btree_map<model::offset, segment_meta> offset_map;
+ss::future<partition_downloader::offset_map_t>
+partition_downloader::build_offset_map(
+  const partition_manifest& manifest,
+  std::optional<size_t> max_size,
+  std::optional<model::timestamp_clock::duration> retention_time) {
+    offset_map_t offset_map;
+    size_t total_size = 0;
     for (const auto& segm : manifest) {
         offset_map.insert_or_assign(segm.second.base_offset, segm.second);
+        total_size += segm.second.size_bytes;
+    }
+    std::vector<segment_meta> spillovers;
+    for (const auto& meta : manifest.get_spillover_map()) {
+        spillovers.push_back(meta);
     }
-    return offset_map;
+    auto time_threshold = retention_time.has_value()
+                            ? model::to_timestamp(
+                              model::timestamp_clock::now() - *retention_time)
+                            : model::timestamp::missing();
+    for (auto it = spillovers.rbegin(); it != spillovers.rend(); ++it) {
+        const auto& meta = *it;
+        if (max_size.has_value() && total_size >= *max_size) {
+            break;
+        }
+        if (
+          retention_time.has_value()
+          && (meta.max_timestamp == model::timestamp::missing()
+              || meta.max_timestamp < time_threshold)) {
+            break;
+        }
+        auto path = manifest.get_spillover_manifest_path(meta);
+        vlog(_ctxlog.info, "Downloading spillover manifest {}", path);
+        partition_manifest spillover(
+          manifest.get_ntp(), manifest.get_revision_id());
+        auto res = co_await _remote->download_manifest(
+          _bucket, path, spillover, _rtcnode);
+        if (res != download_result::success) {
+            // The log is restored starting from the end of the gap
+            vlog(
+              _ctxlog.warn,
+              "Failed to download spillover manifest {}: {}, older data "
+              "won't be restored",
+              path,
+              res);
+            break;
+        }
+        for (const auto& segm : spillover) {
+            offset_map.insert_or_assign(segm.second.base_offset, segm.second);
+            total_size += segm.second.size_bytes;
+        }
+    }
+    co_return offset_map;
 }
 
 // entry point for the whole thing
@@ -310,7 +362,8 @@ partition_downloader::download_log(const remote_manifest_path& manifest_key) {
         static constexpr auto one_week = one_day * 7;
         vlog(_ctxlog.info, "Default retention parameters are used.");
         part = co_await download_log_with_capped_time(
-          build_offset_map(mat.partition_manifest),
+          co_await build_offset_map(
+            mat.partition_manifest, std::nullopt, one_week),
           mat.partition_manifest,
           prefix,
           one_week);
@@ -322,7 +375,8 @@ partition_downloader::download_log(const remote_manifest_path& manifest_key) {
           "Size bound retention is used. Size limit: {} bytes.",
           r.bytes);
         part = co_await download_log_with_capped_size(
-          build_offset_map(mat.partition_manifest),
+          co_await build_offset_map(
+            mat.partition_manifest, r.bytes, std::nullopt),
           mat.partition_manifest,
           prefix,
           r.bytes);
@@ -334,7 +388,8 @@ partition_downloader::download_log(const remote_manifest_path& manifest_key) {
           "Time bound retention is used. Time limit: {}ms.",
           r.duration.count());
         part = co_await download_log_with_capped_time(
-          build_offset_map(mat.partition_manifest),
+          co_await build_offset_map(
+            mat.partition_manifest, std::nullopt, r.duration),
           mat.partition_manifest,
           prefix,
           r.duration);
@@ -347,6 +402,7 @@ partition_downloader::download_log(const remote_manifest_path& manifest_key) {
       .min_kafka_offset = part.range.min_offset,
       .max_kafka_offset = part.range.max_offset,
       .manifest = mat.partition_manifest,
+      .downloaded_bytes = _downloaded_bytes,
     };
     co_return result;
 }
@@ -386,6 +442,33 @@ void partition_downloader::update_downloaded_offsets(
     }
 }
 
+ss::future<std::vector<stream_stats>> partition_downloader::download_segments(
+  const std::vector<segment_meta>& segments, const download_part& part) {
+    std::vector<stream_stats> result;
+    co_await ss::max_concurrent_for_each(
+      segments,
+      config::shard_local_cfg().cloud_storage_recovery_download_concurrency(),
+      [this, &part, &result](const segment_meta& s) -> ss::future<> {
+          retry_chain_node fib(&_rtcnode);
+          retry_chain_logger dllog(cst_log, fib);
+          vlog(
+            dllog.debug,
+            "Starting download, base_offset: {}, term: {}, size: {}, fs "
+            "prefix: {}, dest: {}",
+            s.base_offset,
+            s.segment_term,
+            s.size_bytes,
+            part.part_prefix,
+            part.dest_prefix);
+          return download_segment_file(s, part).then([&result](auto stats) {
+              if (stats) {
+                  result.push_back(*stats);
+              }
+          });
+      });
+    co_return result;
+}
+
 ss::future<partition_downloader::download_part>
 partition_downloader::download_log_with_capped_size(
   offset_map_t offset_map,
@@ -410,48 +493,46 @@ partition_downloader::download_log_with_capped_size(
     auto offset_end = offset_map.rend();
     size_t total_size = 0;
     auto data_found = false;
+    auto concurrency = config::shard_local_cfg()
+                         .cloud_storage_recovery_download_concurrency();
 
     // operating on iterators across suspension points is a potentially unsafe
     // pattern. here the usage is safe since the backing data structure is local
     // to this coroutine
-    co_await ss::do_until(
-      [&] {
-          return offset_segment_it == offset_end
-                 || // no more segments to process
-                    // or processing this segment would exceed max_size
-                    // and some proper data is ready
-                 (data_found
-                  && (total_size + offset_segment_it->second.size_bytes >= max_size));
-      },
-      [&]() -> ss::future<> {
-          auto [_, s] = *offset_segment_it;
-          ++offset_segment_it;
-
-          retry_chain_node fib(&_rtcnode);
-          retry_chain_logger dllog(cst_log, fib);
-          vlog(
-            dllog.debug,
-            "Starting download, base-offset: {}, term: {}, size: {}, fs "
-            "prefix: {}, "
-            "destination: {}",
-            s.base_offset,
-            s.segment_term,
-            s.size_bytes,
-            dlpart.part_prefix,
-            dlpart.dest_prefix);
-          return download_segment_file(s, dlpart).then([&](auto offsets) {
-              if (!offsets || offsets->size_bytes == 0u) {
-                  return;
-              }
-              auto [min_offset, max_offset, size] = *offsets;
-              data_found = true;
-              total_size += size;
-              dloffsets.push_back({
-                .min_offset = min_offset,
-                .max_offset = max_offset,
-              });
-          });
-      });
+    while (offset_segment_it != offset_end // no more segments to process
+           // or processing this segment would exceed max_size
+           // and some proper data is ready
+           && !(
+             data_found
+             && total_size + offset_segment_it->second.size_bytes
+                  >= max_size)) {
+        // The segments are downloaded in batches. The size of the batch
+        // is estimated using the size of the segments in the manifest
+        // since the size of the downloaded data is not known in advance.
+        // The first segment of the batch is always downloaded.
+        std::vector<segment_meta> batch;
+        size_t estimated_size = total_size;
+        while (batch.size() < concurrency && offset_segment_it != offset_end) {
+            const auto& s = offset_segment_it->second;
+            if (!batch.empty() && estimated_size + s.size_bytes >= max_size) {
+                break;
+            }
+            estimated_size += s.size_bytes;
+            batch.push_back(s);
+            ++offset_segment_it;
+        }
+        for (const auto& stats : co_await download_segments(batch, dlpart)) {
+            if (stats.size_bytes == 0u) {
+                continue;
+            }
+            data_found = true;
+            total_size += stats.size_bytes;
+            dloffsets.push_back({
+              .min_offset = stats.min_offset,
+              .max_offset = stats.max_offset,
+            });
+        }
+    }
     update_downloaded_offsets(std::move(dloffsets), dlpart);
     if (!data_found) {
         // The segments didn't have data batches
@@ -524,35 +605,17 @@ partition_downloader::download_log_with_capped_time(
       }};
 
     auto data_found = false;
-
-    co_await ss::max_concurrent_for_each(
-      staged_downloads,
-      max_concurrency,
-      [this, &dlpart, &dloffsets, &data_found](
-        const segment_meta& s) -> ss::future<> {
-          retry_chain_node fib(&_rtcnode);
-          retry_chain_logger dllog(cst_log, fib);
-          vlog(
-            dllog.debug,
-            "Starting download, base_offset: {}, term: {}, fs prefix: {}, "
-            "dest: {}",
-            s.base_offset,
-            s.segment_term,
-            dlpart.part_prefix,
-            dlpart.dest_prefix);
-          return download_segment_file(s, dlpart).then(
-            [&dloffsets, &data_found](auto offsets) {
-                if (offsets) {
-                    dloffsets.push_back({
-                      .min_offset = offsets->min_offset,
-                      .max_offset = offsets->max_offset,
-                    });
-                    if (offsets->size_bytes > 0) {
-                        data_found = true;
-                    }
-                }
-            });
-      });
+    std::vector<segment_meta> segments(
+      staged_downloads.begin(), staged_downloads.end());
+    for (const auto& stats : co_await download_segments(segments, dlpart)) {
+        dloffsets.push_back({
+          .min_offset = stats.min_offset,
+          .max_offset = stats.max_offset,
+        });
+        if (stats.size_bytes > 0) {
+            data_found = true;
+        }
+    }
     update_downloaded_offsets(std::move(dloffsets), dlpart);
     if (!data_found) {
         // The segments didn't have data batches
@@ -581,8 +644,8 @@ partition_downloader::find_recovery_material(const remote_manifest_path& key) {
     recovery_material recovery_mat;
 
     partition_manifest tmp(_ntpc.ntp(), _remote_revision_id);
-    auto res = co_await _remote->download_manifest(
-      _bucket, tmp.get_manifest_path(), tmp, _rtcnode);
+    auto res = co_await _remote->download_partition_manifest(
+      _bucket, tmp, _rtcnode);
     if (res != download_result::success) {
         throw missing_partition_exception(tmp.get_manifest_path());
     }
@@ -696,6 +759,7 @@ partition_downloader::download_segment_file(
         co_return std::nullopt;
     }
 
+    _downloaded_bytes += stream_stats.size_bytes;
     co_return stream_stats;
 }
 
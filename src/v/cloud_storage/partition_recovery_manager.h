@@ -41,6 +41,8 @@ struct log_recovery_result {
     model::offset min_kafka_offset;
     model::offset max_kafka_offset;
     cloud_storage::partition_manifest manifest;
+    /// Size of the restored log segments
+    uint64_t downloaded_bytes{0};
 };
 
 /// Data recovery provider is used to download topic segments from S3 (or
@@ -101,8 +103,6 @@ private:
 /// Topic downloader is used to download topic segments from S3 (or compatible
 /// storage) during topic re-creation
 class partition_downloader {
-    static constexpr size_t max_concurrency = 1;
-
 public:
     partition_downloader(
       const storage::ntp_config& ntpc,
@@ -192,6 +192,23 @@ private:
 
     using offset_map_t = absl::btree_map<model::offset, segment_meta>;
 
+    /// Build the map of segments which could be used to restore the log.
+    /// Spillover manifests are downloaded newest first while the segments
+    /// from the manifest are not enough to satisfy the size limit or
+    /// while the spillover manifest has data newer than the time limit.
+    ss::future<offset_map_t> build_offset_map(
+      const partition_manifest& manifest,
+      std::optional<size_t> max_size,
+      std::optional<model::timestamp_clock::duration> retention_time);
+
+    /// Download segments concurrently. The number of concurrent downloads
+    /// is limited by the cloud_storage_recovery_download_concurrency
+    /// property.
+    ///
+    /// \return stats of the segments which were downloaded successfully
+    ss::future<std::vector<stream_stats>> download_segments(
+      const std::vector<segment_meta>& segments, const download_part& part);
+
     ss::future<download_part> download_log_with_capped_size(
       offset_map_t offset_map,
       const partition_manifest& manifest,
@@ -219,6 +236,8 @@ private:
     retry_chain_node _rtcnode;
     retry_chain_logger _ctxlog;
     storage::opt_abort_source_t _as;
+    /// Total size of the downloaded segments
+    uint64_t _downloaded_bytes{0};
 };
 
 } // namespace cloud_storage
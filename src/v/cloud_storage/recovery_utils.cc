@@ -21,18 +21,24 @@ namespace {
 // The top level path for all recovery state files on the cloud storage bucket
 constexpr std::string_view recovery_result_prefix{"recovery_state"};
 
-// The format for recovery state files, containing the NTP, a random UUID and
-// the boolean status
-// {recovery_result_prefix}/{ns}/{topic}/{partition}_{uuid}/{success:true|false}
-constexpr std::string_view recovery_result_format{"{}/{}/{}/{}_{}.{}"};
+// The format for recovery state files, containing the NTP, a random UUID,
+// the size of the downloaded data and the boolean status
+// {recovery_result_prefix}/{ns}/{topic}/{partition}_{uuid}_{bytes}.{success}
+constexpr std::string_view recovery_result_format{"{}/{}/{}/{}_{}_{}.{}"};
+
+// The format used before the size of the downloaded data was added, the
+// result files placed by the older nodes use it
+// {recovery_result_prefix}/{ns}/{topic}/{partition}_{uuid}.{success}
+constexpr std::string_view legacy_recovery_result_format{"{}/{}/{}/{}_{}.{}"};
 
 constexpr size_t max_delete_items_per_call{1000};
 
-// Matches the recovery_result_format. Example:
-// "recovery_state/test_ns/test_topic/0_<UUID>.true" OR
+// Matches both the recovery_result_format and the legacy format. Example:
+// "recovery_state/test_ns/test_topic/0_<UUID>_1024.true" OR
 // "recovery_state/test_ns/test_topic/0_<UUID>.false"
 const std::regex result_expr{fmt::format(
-  "{}/(.*?)/(.*?)/(\\d+)_(.*?).(true|false)", recovery_result_prefix)};
+  "{}/(.*?)/(.*?)/(\\d+)_(.*?)(?:_(\\d+))?.(true|false)",
+  recovery_result_prefix)};
 } // namespace
 
 namespace cloud_storage {
@@ -41,14 +47,16 @@ recovery_result::recovery_result(
   model::topic_namespace topic_namespace,
   model::partition_id partition_id,
   ss::sstring uuid,
-  bool result)
+  bool result,
+  std::optional<uint64_t> downloaded_bytes)
   : tp_ns(std::move(topic_namespace))
   , partition(partition_id)
   , uuid(std::move(uuid))
-  , result(result) {}
+  , result(result)
+  , downloaded_bytes(downloaded_bytes) {}
 
-ss::sstring
-generate_result_path(const storage::ntp_config& ntp_cfg, bool result) {
+ss::sstring generate_result_path(
+  const storage::ntp_config& ntp_cfg, bool result, uint64_t downloaded_bytes) {
     auto uuid = boost::uuids::random_generator()();
     return fmt::format(
       recovery_result_format,
@@ -57,6 +65,7 @@ generate_result_path(const storage::ntp_config& ntp_cfg, bool result) {
       ntp_cfg.ntp().tp.topic(),
       ntp_cfg.ntp().tp.partition,
       boost::uuids::to_string(uuid),
+      downloaded_bytes,
       result);
 }
 
@@ -65,9 +74,11 @@ ss::future<> place_download_result(
   cloud_storage_clients::bucket_name bucket,
   const storage::ntp_config& ntp_cfg,
   bool result_completed,
+  uint64_t downloaded_bytes,
   retry_chain_node& parent) {
     retry_chain_node fib{&parent};
-    auto result_path = generate_result_path(ntp_cfg, result_completed);
+    auto result_path = generate_result_path(
+      ntp_cfg, result_completed, downloaded_bytes);
     auto result = co_await remote.upload_object(
       bucket, cloud_storage_clients::object_key{result_path}, "", fib);
     if (result != upload_result::success) {
@@ -99,12 +110,17 @@ ss::future<std::vector<recovery_result>> gather_recovery_results(
         std::cmatch matches;
         if (std::regex_match(
               item.key.begin(), item.key.end(), matches, result_expr)) {
+            std::optional<uint64_t> downloaded_bytes;
+            if (matches[5].matched) {
+                downloaded_bytes = std::stoull(matches[5].str());
+            }
             results.emplace_back(
               model::topic_namespace{
                 model::ns{matches[1].str()}, model::topic{matches[2].str()}},
               model::partition_id{std::stoi(matches[3].str())},
               matches[4].str(),
-              matches[5].str() == "true");
+              matches[6].str() == "true",
+              downloaded_bytes);
         }
     }
     co_return results;
@@ -168,8 +184,19 @@ ss::future<> clear_recovery_results(
 }
 
 cloud_storage_clients::object_key make_result_path(const recovery_result& r) {
+    if (r.downloaded_bytes.has_value()) {
+        return cloud_storage_clients::object_key{fmt::format(
+          recovery_result_format,
+          recovery_result_prefix,
+          r.tp_ns.ns(),
+          r.tp_ns.tp(),
+          r.partition,
+          r.uuid,
+          *r.downloaded_bytes,
+          r.result)};
+    }
     return cloud_storage_clients::object_key{fmt::format(
-      recovery_result_format,
+      legacy_recovery_result_format,
       recovery_result_prefix,
       r.tp_ns.ns(),
       r.tp_ns.tp(),
@@ -29,13 +29,20 @@ struct recovery_result {
     model::partition_id partition;
     ss::sstring uuid;
     bool result;
+    /// Size of the downloaded segments, not set if the result was placed
+    /// by the node which doesn't report it
+    std::optional<uint64_t> downloaded_bytes;
 
     recovery_result(
-      model::topic_namespace, model::partition_id, ss::sstring, bool);
+      model::topic_namespace,
+      model::partition_id,
+      ss::sstring,
+      bool,
+      std::optional<uint64_t> downloaded_bytes = std::nullopt);
 };
 
-ss::sstring
-generate_result_path(const storage::ntp_config& ntp_cfg, bool result);
+ss::sstring generate_result_path(
+  const storage::ntp_config& ntp_cfg, bool result, uint64_t downloaded_bytes);
 
 /// \brief Uploads a result for a completed download by formatting using the
 /// recovery_result_format path, this is an empty file so that the list
@@ -45,6 +52,7 @@ ss::future<> place_download_result(
   cloud_storage_clients::bucket_name bucket,
   const storage::ntp_config& ntp_cfg,
   bool result_completed,
+  uint64_t downloaded_bytes,
   retry_chain_node& parent);
 
 /// \brief collects recovery results by listing the prefix on the bucket and
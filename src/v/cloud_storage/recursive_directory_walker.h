@@ -20,12 +20,6 @@
 
 namespace cloud_storage {
 
-struct file_list_item {
-    std::chrono::system_clock::time_point access_time;
-    ss::sstring path;
-    uint64_t size;
-};
-
 struct walk_result {
     uint64_t cache_size{0};
     std::vector<file_list_item> regular_files;
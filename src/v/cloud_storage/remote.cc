@@ -13,10 +13,13 @@
 #include "bytes/iostream.h"
 #include "cloud_storage/logger.h"
 #include "cloud_storage/materialized_segments.h"
+#include "cloud_storage/partition_manifest.h"
 #include "cloud_storage/remote_segment.h"
 #include "cloud_storage/types.h"
+#include "config/configuration.h"
 #include "model/metadata.h"
 #include "net/connection.h"
+#include "ssx/semaphore.h"
 #include "ssx/sformat.h"
 #include "utils/intrusive_list_helpers.h"
 #include "utils/retry_chain_node.h"
@@ -28,6 +31,7 @@
 #include <seastar/core/sleep.hh>
 #include <seastar/core/timed_out_error.hh>
 #include <seastar/core/weak_ptr.hh>
+#include <seastar/core/when_all.hh>
 
 #include <boost/beast/http/error.hpp>
 #include <boost/beast/http/field.hpp>
@@ -46,6 +50,9 @@ remote::remote(
   const cloud_storage_clients::client_configuration& conf,
   model::cloud_credentials_source cloud_credentials_source)
   : _pool(limit(), conf)
+  , _multipart_memory_limit(
+      config::shard_local_cfg().cloud_storage_multipart_upload_memory())
+  , _multipart_memory(_multipart_memory_limit, "cst/multipart-memory")
   , _auth_refresh_bg_op{_gate, _as, conf, cloud_credentials_source}
   , _materialized(std::make_unique<materialized_segments>())
   , _probe(
@@ -257,15 +264,86 @@ ss::future<download_result> remote::do_download_manifest(
     co_return *result;
 }
 
+ss::future<download_result> remote::download_partition_manifest(
+  const cloud_storage_clients::bucket_name& bucket,
+  partition_manifest& manifest,
+  retry_chain_node& parent,
+  bool expect_missing) {
+    // The archiver removes the manifest in the other format after upload,
+    // so only one of them is expected to exist.
+    auto preferred = config::shard_local_cfg()
+                         .cloud_storage_enable_binary_manifest()
+                       ? manifest_format::serde
+                       : manifest_format::json;
+    auto fallback = preferred == manifest_format::serde
+                      ? manifest_format::json
+                      : manifest_format::serde;
+    auto res = co_await do_download_manifest(
+      bucket, manifest.get_manifest_path(preferred), manifest, parent, true);
+    if (res != download_result::notfound) {
+        co_return res;
+    }
+    co_return co_await do_download_manifest(
+      bucket,
+      manifest.get_manifest_path(fallback),
+      manifest,
+      parent,
+      expect_missing);
+}
+
 ss::future<upload_result> remote::upload_manifest(
   const cloud_storage_clients::bucket_name& bucket,
   const base_manifest& manifest,
   retry_chain_node& parent,
+  const cloud_storage_clients::object_tag_formatter& tags) {
+    return do_upload_manifest(
+      bucket,
+      manifest.get_manifest_path(),
+      manifest.get_manifest_type(),
+      [&manifest] { return manifest.serialize(); },
+      parent,
+      tags);
+}
+
+ss::future<upload_result> remote::upload_manifest(
+  const cloud_storage_clients::bucket_name& bucket,
+  const partition_manifest& manifest,
+  manifest_format format,
+  retry_chain_node& parent,
+  const cloud_storage_clients::object_tag_formatter& tags) {
+    return do_upload_manifest(
+      bucket,
+      manifest.get_manifest_path(format),
+      manifest.get_manifest_type(),
+      [&manifest, format] { return manifest.serialize(format); },
+      parent,
+      tags);
+}
+
+ss::future<upload_result> remote::upload_spillover_manifest(
+  const cloud_storage_clients::bucket_name& bucket,
+  const partition_manifest& manifest,
+  retry_chain_node& parent,
+  const cloud_storage_clients::object_tag_formatter& tags) {
+    return do_upload_manifest(
+      bucket,
+      manifest.get_spillover_manifest_path(manifest.make_manifest_metadata()),
+      manifest.get_manifest_type(),
+      [&manifest] { return manifest.serialize(manifest_format::serde); },
+      parent,
+      tags);
+}
+
+ss::future<upload_result> remote::do_upload_manifest(
+  const cloud_storage_clients::bucket_name& bucket,
+  remote_manifest_path key,
+  manifest_type type,
+  manifest_serializer serialize,
+  retry_chain_node& parent,
   const cloud_storage_clients::object_tag_formatter& tags) {
     gate_guard guard{_gate};
     retry_chain_node fib(&parent);
     retry_chain_logger ctxlog(cst_log, fib);
-    auto key = manifest.get_manifest_path();
     auto path = cloud_storage_clients::object_key(key());
     auto lease = co_await _pool.acquire(fib.root_abort_source());
     auto permit = fib.retry();
@@ -274,13 +352,13 @@ ss::future<upload_result> remote::upload_manifest(
     while (!_gate.is_closed() && permit.is_allowed && !result.has_value()) {
         notify_external_subscribers(
           api_activity_notification::manifest_upload, parent);
-        auto [is, size] = co_await manifest.serialize();
+        auto [is, size] = co_await serialize();
         const auto res = co_await lease.client->put_object(
           bucket, path, size, std::move(is), tags, fib.get_timeout());
 
         if (res) {
             vlog(ctxlog.debug, "Successfuly uploaded manifest to {}", path);
-            switch (manifest.get_manifest_type()) {
+            switch (type) {
             case manifest_type::partition:
                 _probe.partition_manifest_upload();
                 break;
@@ -387,6 +465,21 @@ ss::future<upload_result> remote::upload_segment(
       "Uploading segment to path {}, length {}",
       segment_path,
       content_length);
+    auto path = cloud_storage_clients::object_key(segment_path());
+    auto multipart_threshold
+      = config::shard_local_cfg().cloud_storage_multipart_upload_threshold();
+    if (multipart_threshold && content_length > *multipart_threshold) {
+        notify_external_subscribers(
+          api_activity_notification::segment_upload, parent);
+        co_return co_await upload_segment_multipart(
+          bucket,
+          path,
+          content_length,
+          reset_str,
+          fib,
+          lazy_abort_source,
+          tags);
+    }
     std::optional<upload_result> result;
     while (!_gate.is_closed() && permit.is_allowed && !result) {
         auto lease = co_await _pool.acquire(fib.root_abort_source());
@@ -407,7 +500,6 @@ ss::future<upload_result> remote::upload_segment(
         }
 
         auto reader_handle = co_await reset_str();
-        auto path = cloud_storage_clients::object_key(segment_path());
         // Segment upload attempt
         auto res = co_await lease.client->put_object(
           bucket,
@@ -480,11 +572,278 @@ ss::future<upload_result> remote::upload_segment(
     co_return upload_result::timedout;
 }
 
+template<class T, class Func>
+ss::future<result<T, upload_result>> remote::retry_multipart_request(
+  std::string_view op,
+  const cloud_storage_clients::object_key& path,
+  retry_chain_node& parent,
+  lazy_abort_source& lazy_abort_source,
+  Func func) {
+    retry_chain_node fib(&parent);
+    retry_chain_logger ctxlog(cst_log, fib);
+    auto permit = fib.retry();
+    while (!_gate.is_closed() && permit.is_allowed) {
+        if (lazy_abort_source.abort_requested()) {
+            vlog(
+              ctxlog.warn,
+              "{}: cancelled {} of {}",
+              lazy_abort_source.abort_reason(),
+              op,
+              path);
+            co_return upload_result::cancelled;
+        }
+        auto lease = co_await _pool.acquire(fib.root_abort_source());
+        auto res = co_await func(*lease.client, fib.get_timeout());
+        if (res) {
+            co_return std::move(res.value());
+        }
+
+        lease.client->shutdown();
+        switch (res.error()) {
+        case cloud_storage_clients::error_outcome::none:
+            vassert(
+              false, "s3:error_outcome::none not expected on failure path");
+        case cloud_storage_clients::error_outcome::retry_slowdown:
+            [[fallthrough]];
+        case cloud_storage_clients::error_outcome::retry:
+            vlog(
+              ctxlog.debug,
+              "{} of {}, {} backoff required",
+              op,
+              path,
+              std::chrono::duration_cast<std::chrono::milliseconds>(
+                permit.delay));
+            _probe.upload_backoff();
+            co_await ss::sleep_abortable(permit.delay, fib.root_abort_source());
+            permit = fib.retry();
+            break;
+        case cloud_storage_clients::error_outcome::key_not_found:
+            [[fallthrough]];
+        case cloud_storage_clients::error_outcome::bucket_not_found:
+            [[fallthrough]];
+        case cloud_storage_clients::error_outcome::fail:
+            vlog(ctxlog.warn, "{} of {} failed", op, path);
+            co_return upload_result::failed;
+        }
+    }
+    vlog(ctxlog.warn, "{} of {}, backoff quota exceded", op, path);
+    co_return upload_result::timedout;
+}
+
+ss::future<result<cloud_storage_clients::client::multipart_part, upload_result>>
+remote::upload_part(
+  const cloud_storage_clients::bucket_name& bucket,
+  const cloud_storage_clients::object_key& path,
+  const ss::sstring& upload_id,
+  uint32_t part_number,
+  iobuf payload,
+  retry_chain_node& parent,
+  lazy_abort_source& lazy_abort_source) {
+    // Every attempt sends a zero-copy view of the payload, the payload itself
+    // is released when the part is uploaded.
+    co_return co_await retry_multipart_request<
+      cloud_storage_clients::client::multipart_part>(
+      "upload part",
+      path,
+      parent,
+      lazy_abort_source,
+      [&](cloud_storage_clients::client& client, auto timeout) {
+          return client.upload_part(
+            bucket,
+            path,
+            upload_id,
+            part_number,
+            payload.share(0, payload.size_bytes()),
+            timeout);
+      });
+}
+
+ss::future<upload_result> remote::upload_segment_multipart(
+  const cloud_storage_clients::bucket_name& bucket,
+  const cloud_storage_clients::object_key& path,
+  uint64_t content_length,
+  const reset_input_stream& reset_str,
+  retry_chain_node& fib,
+  lazy_abort_source& lazy_abort_source,
+  const cloud_storage_clients::object_tag_formatter& tags) {
+    using part_result
+      = result<cloud_storage_clients::client::multipart_part, upload_result>;
+    // S3 doesn't allow more parts in a single upload
+    static constexpr uint64_t max_parts = 10000;
+
+    retry_chain_logger ctxlog(cst_log, fib);
+    auto part_size = std::max<uint64_t>(
+      config::shard_local_cfg().cloud_storage_multipart_upload_part_size(),
+      (content_length + max_parts - 1) / max_parts);
+    auto concurrency
+      = config::shard_local_cfg().cloud_storage_multipart_upload_concurrency();
+    vlog(
+      ctxlog.debug,
+      "Uploading {} in parts of {} bytes, up to {} parts concurrently",
+      path,
+      part_size,
+      concurrency);
+
+    auto upload_id = co_await retry_multipart_request<ss::sstring>(
+      "create multipart upload",
+      path,
+      fib,
+      lazy_abort_source,
+      [&](cloud_storage_clients::client& client, auto timeout) {
+          return client.create_multipart_upload(bucket, path, tags, timeout);
+      });
+    if (!upload_id) {
+        _probe.failed_upload();
+        co_return upload_id.error();
+    }
+
+    // The parts are read from the segment sequentially. The semaphore
+    // limits the number of parts of this upload which are kept in memory
+    // while they're being uploaded, the total size of the parts of all
+    // uploads on the shard is limited by _multipart_memory.
+    ssx::semaphore parallelism(concurrency, "cst/multipart-upload");
+    std::vector<ss::future<part_result>> in_flight;
+    std::optional<upload_result> failure;
+    std::exception_ptr error;
+    auto reader_handle = co_await reset_str();
+    auto stream = reader_handle->take_stream();
+    try {
+        uint64_t offset = 0;
+        for (uint32_t part_number = 1; offset < content_length && !failure;
+             part_number++) {
+            auto units = co_await ss::get_units(parallelism, 1);
+            if (failure) {
+                break;
+            }
+            auto size = std::min(part_size, content_length - offset);
+            // A part which is larger than the limit takes all of the memory
+            auto memory = co_await ss::get_units(
+              _multipart_memory,
+              std::min(size, _multipart_memory_limit),
+              fib.root_abort_source());
+            if (failure) {
+                break;
+            }
+            auto payload = co_await read_iobuf_exactly(stream, size);
+            if (payload.size_bytes() != size) {
+                vlog(
+                  ctxlog.error,
+                  "Unexpected end of segment {} at {}, expected size {}",
+                  path,
+                  offset + payload.size_bytes(),
+                  content_length);
+                failure = upload_result::failed;
+                break;
+            }
+            offset += size;
+            in_flight.push_back(
+              upload_part(
+                bucket,
+                path,
+                upload_id.value(),
+                part_number,
+                std::move(payload),
+                fib,
+                lazy_abort_source)
+                .then_wrapped([&failure,
+                               units = std::move(units),
+                               memory = std::move(memory)](
+                                ss::future<part_result> f) mutable {
+                    // Stop reading the segment if any part has failed
+                    if (f.failed()) {
+                        failure = failure.value_or(upload_result::failed);
+                        return f;
+                    }
+                    auto res = f.get0();
+                    if (res.has_error()) {
+                        failure = failure.value_or(res.error());
+                    }
+                    return ss::make_ready_future<part_result>(std::move(res));
+                }));
+        }
+    } catch (...) {
+        error = std::current_exception();
+    }
+
+    auto results = co_await ss::when_all(in_flight.begin(), in_flight.end());
+    co_await stream.close();
+    co_await reader_handle->close();
+
+    std::vector<cloud_storage_clients::client::multipart_part> parts;
+    parts.reserve(results.size());
+    for (auto& f : results) {
+        if (f.failed()) {
+            auto e = f.get_exception();
+            if (!error) {
+                error = e;
+            }
+            continue;
+        }
+        auto res = f.get0();
+        if (res.has_value()) {
+            parts.push_back(std::move(res.value()));
+        }
+    }
+
+    if (failure || error) {
+        // Best effort, the parts of the incomplete uploads should also be
+        // removed by the bucket lifecycle policy.
+        try {
+            co_await retry_multipart_request<
+              cloud_storage_clients::client::no_response>(
+              "abort multipart upload",
+              path,
+              fib,
+              lazy_abort_source,
+              [&](cloud_storage_clients::client& client, auto timeout) {
+                  return client.abort_multipart_upload(
+                    bucket, path, upload_id.value(), timeout);
+              });
+        } catch (...) {
+            vlog(
+              ctxlog.warn,
+              "Failed to abort multipart upload of {}: {}",
+              path,
+              std::current_exception());
+        }
+        _probe.failed_upload();
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        vlog(
+          ctxlog.warn,
+          "Uploading segment {} to {}, {}, segment not uploaded",
+          path,
+          bucket,
+          *failure);
+        co_return *failure;
+    }
+
+    auto res = co_await retry_multipart_request<
+      cloud_storage_clients::client::no_response>(
+      "complete multipart upload",
+      path,
+      fib,
+      lazy_abort_source,
+      [&](cloud_storage_clients::client& client, auto timeout) {
+          return client.complete_multipart_upload(
+            bucket, path, upload_id.value(), parts, tags, timeout);
+      });
+    if (!res) {
+        _probe.failed_upload();
+        co_return res.error();
+    }
+    _probe.successful_upload();
+    _probe.register_upload_size(content_length);
+    co_return upload_result::success;
+}
+
 ss::future<download_result> remote::download_segment(
   const cloud_storage_clients::bucket_name& bucket,
   const remote_segment_path& segment_path,
   const try_consume_stream& cons_str,
-  retry_chain_node& parent) {
+  retry_chain_node& parent,
+  std::optional<cloud_storage_clients::http_byte_range> byte_range) {
     gate_guard guard{_gate};
     retry_chain_node fib(&parent);
     retry_chain_logger ctxlog(cst_log, fib);
@@ -492,13 +851,22 @@ ss::future<download_result> remote::download_segment(
     auto lease = co_await _pool.acquire(fib.root_abort_source());
 
     auto permit = fib.retry();
-    vlog(ctxlog.debug, "Download segment {}", path);
+    if (byte_range.has_value()) {
+        vlog(
+          ctxlog.debug,
+          "Download segment {}, byte range {}-{}",
+          path,
+          byte_range->first,
+          byte_range->second);
+    } else {
+        vlog(ctxlog.debug, "Download segment {}", path);
+    }
     std::optional<download_result> result;
     while (!_gate.is_closed() && permit.is_allowed && !result) {
         notify_external_subscribers(
           api_activity_notification::segment_download, parent);
         auto resp = co_await lease.client->get_object(
-          bucket, path, fib.get_timeout());
+          bucket, path, fib.get_timeout(), false, byte_range);
 
         if (resp) {
             vlog(ctxlog.debug, "Receive OK response from {}", path);
@@ -560,6 +928,36 @@ ss::future<download_result> remote::download_segment(
     }
     co_return *result;
 }
+ss::future<download_result> remote::download_index(
+  const cloud_storage_clients::bucket_name& bucket,
+  const remote_segment_path& index_path,
+  offset_index& ix,
+  retry_chain_node& parent) {
+    iobuf buffer;
+    auto res = co_await download_segment(
+      bucket,
+      index_path,
+      [&buffer](uint64_t, ss::input_stream<char> s) -> ss::future<uint64_t> {
+          auto os = make_iobuf_ref_output_stream(buffer);
+          co_await ss::copy(s, os).finally([&s] { return s.close(); });
+          co_return buffer.size_bytes();
+      },
+      parent);
+    if (res == download_result::success) {
+        try {
+            ix.from_iobuf(std::move(buffer));
+        } catch (...) {
+            vlog(
+              cst_log.warn,
+              "Failed to decode segment index {}: {}",
+              index_path,
+              std::current_exception());
+            co_return download_result::failed;
+        }
+    }
+    co_return res;
+}
+
 ss::future<download_result> remote::segment_exists(
   const cloud_storage_clients::bucket_name& bucket,
   const remote_segment_path& segment_path,
@@ -897,11 +1295,25 @@ ss::future<upload_result> remote::upload_object(
   const cloud_storage_clients::object_key& object_path,
   ss::sstring payload,
   retry_chain_node& parent) {
+    const cloud_storage_clients::object_tag_formatter tags{
+      {"rp-type", "recovery-lock"}};
+    iobuf buffer;
+    buffer.append(payload.data(), payload.size());
+    co_return co_await upload_object(
+      bucket, object_path, std::move(buffer), parent, tags);
+}
+
+ss::future<upload_result> remote::upload_object(
+  const cloud_storage_clients::bucket_name& bucket,
+  const cloud_storage_clients::object_key& object_path,
+  iobuf payload,
+  retry_chain_node& parent,
+  const cloud_storage_clients::object_tag_formatter& tags) {
     gate_guard guard{_gate};
     retry_chain_node fib(&parent);
     retry_chain_logger ctxlog(cst_log, fib);
     auto permit = fib.retry();
-    auto content_length = payload.size();
+    auto content_length = payload.size_bytes();
     vlog(
       ctxlog.debug,
       "Uploading object to path {}, length {}",
@@ -914,14 +1326,12 @@ ss::future<upload_result> remote::upload_object(
         auto path = cloud_storage_clients::object_key(object_path());
         vlog(ctxlog.debug, "Uploading object to path {}", object_path);
 
-        iobuf buffer;
-        buffer.append(payload.data(), payload.size());
         auto res = co_await lease.client->put_object(
           bucket,
           path,
           content_length,
-          make_iobuf_input_stream(std::move(buffer)),
-          {{"rp-type", "recovery-lock"}},
+          make_iobuf_input_stream(payload.copy()),
+          tags,
           fib.get_timeout());
 
         if (res) {
@@ -18,6 +18,7 @@
 #include "cloud_storage_clients/client.h"
 #include "cloud_storage_clients/client_pool.h"
 #include "model/metadata.h"
+#include "ssx/semaphore.h"
 #include "random/simple_time_jitter.h"
 #include "storage/segment_reader.h"
 #include "utils/intrusive_list_helpers.h"
@@ -218,6 +219,56 @@ public:
       const cloud_storage_clients::object_tag_formatter& tags
       = default_partition_manifest_tags);
 
+    /// \brief Upload partition manifest using the specified format
+    ///
+    /// The manifest is uploaded to manifest.json or manifest.bin depending
+    /// on the format.
+    /// \param bucket is a bucket name
+    /// \param manifest is a manifest to upload
+    /// \param format is an encoding of the uploaded manifest
+    /// \return future that returns success code
+    ss::future<upload_result> upload_manifest(
+      const cloud_storage_clients::bucket_name& bucket,
+      const partition_manifest& manifest,
+      manifest_format format,
+      retry_chain_node& parent,
+      const cloud_storage_clients::object_tag_formatter& tags
+      = default_partition_manifest_tags);
+
+    /// \brief Upload spillover manifest
+    ///
+    /// The spillover manifest contains the segments moved out of the
+    /// partition manifest. It's never updated after the upload and
+    /// always uses the binary format.
+    /// \param bucket is a bucket name
+    /// \param manifest is a spillover manifest to upload
+    /// \return future that returns success code
+    ss::future<upload_result> upload_spillover_manifest(
+      const cloud_storage_clients::bucket_name& bucket,
+      const partition_manifest& manifest,
+      retry_chain_node& parent,
+      const cloud_storage_clients::object_tag_formatter& tags
+      = default_partition_manifest_tags);
+
+    /// \brief Download partition manifest in any format
+    ///
+    /// The manifest is looked up in the format configured by the
+    /// cloud_storage_enable_binary_manifest property first. The other
+    /// format is only requested if the manifest is not found, so the
+    /// extra request is only made while the format is being changed.
+    /// The ntp and revision of the 'manifest' are used to find the
+    /// manifest in the bucket.
+    /// \param bucket is a bucket name
+    /// \param manifest is a manifest to download
+    /// \param expect_missing if set 'NoSuchKey' error is not logged at
+    ///        'warn' level
+    /// \return future that returns success code
+    ss::future<download_result> download_partition_manifest(
+      const cloud_storage_clients::bucket_name& bucket,
+      partition_manifest& manifest,
+      retry_chain_node& parent,
+      bool expect_missing = false);
+
     /// \brief Upload segment to S3
     ///
     /// The method uploads the segment while tolerating some errors. It can
@@ -244,10 +295,25 @@ public:
     /// segment's data
     /// \param name is a segment's name in S3
     /// \param manifest is a manifest that should have the segment metadata
+    /// \param byte_range is an optional range of bytes to download, the
+    ///        whole segment is downloaded if not set
     ss::future<download_result> download_segment(
       const cloud_storage_clients::bucket_name& bucket,
       const remote_segment_path& path,
       const try_consume_stream& cons_str,
+      retry_chain_node& parent,
+      std::optional<cloud_storage_clients::http_byte_range> byte_range
+      = std::nullopt);
+
+    /// \brief Download segment index from S3
+    ///
+    /// \param index_path is a path of the index object (see
+    ///        generate_remote_index_path)
+    /// \param ix is an index that should be populated
+    ss::future<download_result> download_index(
+      const cloud_storage_clients::bucket_name& bucket,
+      const remote_segment_path& index_path,
+      offset_index& ix,
       retry_chain_node& parent);
 
     /// Checks if the segment exists in the bucket
@@ -312,6 +378,19 @@ public:
       ss::sstring payload,
       retry_chain_node& parent);
 
+    /// \brief Upload small object to bucket with the provided tags
+    ///
+    /// \param bucket The bucket to upload to
+    /// \param object_path The path to upload to
+    /// \param payload The data to place in the bucket
+    /// \param tags The tags applied to the object
+    ss::future<upload_result> upload_object(
+      const cloud_storage_clients::bucket_name& bucket,
+      const cloud_storage_clients::object_key& object_path,
+      iobuf payload,
+      retry_chain_node& parent,
+      const cloud_storage_clients::object_tag_formatter& tags);
+
     ss::future<download_result> do_download_manifest(
       const cloud_storage_clients::bucket_name& bucket,
       const remote_manifest_path& key,
@@ -396,6 +475,51 @@ public:
       const model::ntp& ntp, model::initial_revision_id rev);
 
 private:
+    using manifest_serializer
+      = ss::noncopyable_function<ss::future<serialized_json_stream>()>;
+
+    /// Upload manifest produced by the 'serialize' function, the function
+    /// is invoked on every attempt
+    ss::future<upload_result> do_upload_manifest(
+      const cloud_storage_clients::bucket_name& bucket,
+      remote_manifest_path key,
+      manifest_type type,
+      manifest_serializer serialize,
+      retry_chain_node& parent,
+      const cloud_storage_clients::object_tag_formatter& tags);
+
+    /// Upload the segment in parts which are sent concurrently, every part
+    /// is retried individually
+    ss::future<upload_result> upload_segment_multipart(
+      const cloud_storage_clients::bucket_name& bucket,
+      const cloud_storage_clients::object_key& path,
+      uint64_t content_length,
+      const reset_input_stream& reset_str,
+      retry_chain_node& fib,
+      lazy_abort_source& lazy_abort_source,
+      const cloud_storage_clients::object_tag_formatter& tags);
+
+    ss::future<
+      result<cloud_storage_clients::client::multipart_part, upload_result>>
+    upload_part(
+      const cloud_storage_clients::bucket_name& bucket,
+      const cloud_storage_clients::object_key& path,
+      const ss::sstring& upload_id,
+      uint32_t part_number,
+      iobuf payload,
+      retry_chain_node& parent,
+      lazy_abort_source& lazy_abort_source);
+
+    /// Send a request of the multipart upload using a client from the pool
+    /// and retry it until it succeeds or the retry quota is exhausted
+    template<class T, class Func>
+    ss::future<result<T, upload_result>> retry_multipart_request(
+      std::string_view op,
+      const cloud_storage_clients::object_key& path,
+      retry_chain_node& parent,
+      lazy_abort_source& lazy_abort_source,
+      Func func);
+
     ss::future<> propagate_credentials(cloud_roles::credentials credentials);
     /// Notify all subscribers about segment or manifest upload/download
     void notify_external_subscribers(
@@ -404,6 +528,10 @@ private:
     cloud_storage_clients::client_pool _pool;
     ss::gate _gate;
     ss::abort_source _as;
+    // Limits the memory used by the parts of all multipart uploads on the
+    // shard
+    const size_t _multipart_memory_limit;
+    ssx::semaphore _multipart_memory;
     auth_refresh_bg_op _auth_refresh_bg_op;
     std::unique_ptr<materialized_segments> _materialized;
 
@@ -15,10 +15,13 @@
 #include "cloud_storage/offset_translation_layer.h"
 #include "cloud_storage/partition_manifest.h"
 #include "cloud_storage/remote_segment.h"
+#include "cloud_storage/remote_segment_index.h"
 #include "cloud_storage/topic_manifest.h"
 #include "cloud_storage/tx_range_manifest.h"
 #include "cloud_storage/types.h"
+#include "config/configuration.h"
 #include "model/fundamental.h"
+#include "ssx/future-util.h"
 #include "storage/log_reader.h"
 #include "storage/parser_errc.h"
 #include "storage/types.h"
@@ -46,12 +49,12 @@ namespace cloud_storage {
 using data_t = model::record_batch_reader::data_t;
 using storage_t = model::record_batch_reader::storage_t;
 
-remote_partition::iterator
-remote_partition::materialize_segment(const segment_meta& meta) {
+remote_partition::iterator remote_partition::materialize_segment(
+  const partition_manifest& m, const segment_meta& meta) {
     auto base_kafka_offset = meta.base_offset - meta.delta_offset;
     auto units = materialized().get_segment_units();
     auto st = std::make_unique<materialized_segment_state>(
-      meta.base_offset, *this, std::move(units));
+      meta.base_offset, *this, m, std::move(units));
     auto [iter, ok] = _segments.insert(
       std::make_pair(meta.base_offset, std::move(st)));
     vassert(
@@ -67,6 +70,129 @@ remote_partition::materialize_segment(const segment_meta& meta) {
     return iter;
 }
 
+void remote_partition::prefetch_segments(
+  const partition_manifest& m, partition_manifest::const_iterator it) {
+    auto num_segments
+      = config::shard_local_cfg().cloud_storage_segment_prefetch();
+    for (uint16_t i = 0; i < num_segments && it != m.end(); i++, it++) {
+        if (_segments.contains(it->first)) {
+            continue;
+        }
+        if (!materialized().has_free_segment_units()) {
+            vlog(
+              _ctxlog.debug,
+              "Segment {} is not prefetched, segment limit reached",
+              it->first);
+            return;
+        }
+        auto segment = materialize_segment(m, it->second)->second->segment;
+        ssx::spawn_with_gate(_gate, [this, segment] {
+            return segment->prefetch().handle_exception(
+              [this, segment](const std::exception_ptr& e) {
+                  vlog(
+                    _ctxlog.debug,
+                    "Failed to prefetch segment {}: {}",
+                    segment->get_segment_path(),
+                    e);
+              });
+        });
+    }
+}
+
+std::optional<segment_meta> remote_partition::find_spillover_for_reader(
+  const storage::log_reader_config& config) const {
+    if (_manifest.get_spillover_map().empty()) {
+        return std::nullopt;
+    }
+    if (config.first_timestamp) {
+        return _manifest.spillover_timequery(*config.first_timestamp);
+    }
+    auto ko = model::offset_cast(config.start_offset);
+    if (auto spillover = _manifest.find_spillover(ko); spillover) {
+        return spillover;
+    }
+    // The scan range may start below the first spillover manifest
+    auto so = _manifest.get_archive_start_kafka_offset().value();
+    if (config.start_offset < so && config.max_offset > so) {
+        return *_manifest.get_spillover_map().begin();
+    }
+    return std::nullopt;
+}
+
+remote_partition::spillover_manifest_ptr
+remote_partition::get_spillover_manifest(const segment_meta& spillover_meta) {
+    for (auto it = _spillover_manifests.begin();
+         it != _spillover_manifests.end();
+         it++) {
+        if ((*it)->get_start_offset() == spillover_meta.base_offset) {
+            auto res = *it;
+            _spillover_manifests.erase(it);
+            _spillover_manifests.push_back(res);
+            return res;
+        }
+    }
+    return nullptr;
+}
+
+ss::future<remote_partition::spillover_manifest_ptr>
+remote_partition::hydrate_spillover_manifest(
+  const segment_meta& spillover_meta) {
+    static constexpr ss::lowres_clock::duration download_timeout = 60s;
+    static constexpr ss::lowres_clock::duration download_backoff = 1s;
+
+    if (auto res = get_spillover_manifest(spillover_meta); res) {
+        co_return res;
+    }
+    gate_guard guard(_gate);
+    auto path = _manifest.get_spillover_manifest_path(spillover_meta);
+    vlog(_ctxlog.debug, "Hydrating spillover manifest {}", path);
+    auto m = ss::make_lw_shared<partition_manifest>(
+      _manifest.get_ntp(), _manifest.get_revision_id());
+    retry_chain_node fib(download_timeout, download_backoff, &_rtc);
+    auto res = co_await _api.download_manifest(_bucket, path, *m, fib);
+    if (res != download_result::success) {
+        throw std::runtime_error(fmt::format(
+          "Failed to download spillover manifest {}: {}", path, res));
+    }
+    // The same manifest could be hydrated concurrently by another reader
+    if (auto cached = get_spillover_manifest(spillover_meta); cached) {
+        co_return cached;
+    }
+    _spillover_manifests.push_back(m);
+    if (_spillover_manifests.size() > max_cached_spillover_manifests) {
+        _spillover_manifests.pop_front();
+    }
+    co_return m;
+}
+
+model::offset remote_partition::next_range_base_offset(
+  const segment_meta& spillover_meta) const {
+    auto next = model::offset{};
+    for (const auto& meta : _manifest.get_spillover_map()) {
+        if (meta.base_offset > spillover_meta.committed_offset) {
+            next = meta.base_offset;
+            break;
+        }
+    }
+    if (next == model::offset{} && _manifest.size() != 0) {
+        next = _manifest.begin()->first;
+    }
+    auto expected = model::next_offset(spillover_meta.committed_offset);
+    if (next != model::offset{} && next != expected) {
+        // Retention removes spillover manifests before it truncates the
+        // manifest so the log shouldn't have gaps. Offsets inside the gap
+        // can't be served.
+        vlog(
+          _ctxlog.warn,
+          "Gap in the log after spillover manifest {}-{}, next offset range "
+          "starts at {}",
+          spillover_meta.base_offset,
+          spillover_meta.committed_offset,
+          next);
+    }
+    return next;
+}
+
 remote_partition::borrow_result_t remote_partition::borrow_next_reader(
   storage::log_reader_config config, model::offset hint) {
     // The code find the materialized that can satisfy the reader. If the
@@ -88,15 +214,34 @@ remote_partition::borrow_result_t remote_partition::borrow_next_reader(
     //   doesn't have any data. The 'segment_containing' method of the
     //   manifest takes this into account.
     // - find materialized segment or materialize the new one
-    auto mit = _manifest.end();
+    //
+    // The offsets moved to the spillover manifests are looked up in the
+    // spillover manifest which has to be hydrated by the caller.
+    auto spillover = hint == model::offset{}
+                       ? find_spillover_for_reader(config)
+                       : _manifest.find_spillover(hint);
+    spillover_manifest_ptr spillover_manifest;
+    if (spillover.has_value()) {
+        spillover_manifest = get_spillover_manifest(*spillover);
+        if (!spillover_manifest) {
+            vlog(
+              _ctxlog.debug,
+              "Spillover manifest {}-{} is not hydrated",
+              spillover->base_offset,
+              spillover->committed_offset);
+            return borrow_result_t{};
+        }
+    }
+    const auto& manifest = spillover_manifest ? *spillover_manifest
+                                              : _manifest;
+    auto mit = manifest.end();
     if (hint == model::offset{}) {
         // This code path is only used for the first lookup. It
         // could be either lookup by kafka offset or by timestamp.
         if (config.first_timestamp) {
-            auto maybe_meta = _manifest.timequery(*config.first_timestamp);
+            auto maybe_meta = manifest.timequery(*config.first_timestamp);
             if (maybe_meta) {
-                mit = _manifest.segment_containing(
-                  maybe_meta->get().base_offset);
+                mit = manifest.segment_containing(maybe_meta->base_offset);
             }
         } else {
             // In this case the lookup is perfomed by kafka offset.
@@ -104,22 +249,22 @@ remote_partition::borrow_result_t remote_partition::borrow_next_reader(
             // partition_record_batch_reader_impl. This lookup will
             // skip segments without data batches (the logic is implemented
             // inside the partition_manifest).
-            mit = _manifest.segment_containing(ko);
+            mit = manifest.segment_containing(ko);
         }
-        if (mit == _manifest.end()) {
+        if (mit == manifest.end()) {
             // Segment that matches exactly can't be found in the manifest. In
             // this case we want to start scanning from the begining of the
             // partition if the start of the manifest is contained by the scan
             // range.
-            auto so = _manifest.get_start_kafka_offset().value_or(
+            auto so = manifest.get_start_kafka_offset().value_or(
               kafka::offset::min());
             if (config.start_offset < so && config.max_offset > so) {
-                mit = _manifest.begin();
+                mit = manifest.begin();
             }
         }
     } else {
-        mit = _manifest.segment_containing(hint);
-        while (mit != _manifest.end()) {
+        mit = manifest.segment_containing(hint);
+        while (mit != manifest.end()) {
             // The segment 'mit' points to might not have any
             // data batches. In this case we need to move iterator forward.
             // The check can only be done if we have 'delta_offset_end'.
@@ -134,7 +279,7 @@ remote_partition::borrow_result_t remote_partition::borrow_next_reader(
             mit++;
         }
     }
-    if (mit == _manifest.end()) {
+    if (mit == manifest.end()) {
         // No such segment
         return borrow_result_t{};
     }
@@ -148,10 +293,10 @@ remote_partition::borrow_result_t remote_partition::borrow_next_reader(
         }
     }
     if (iter == _segments.end()) {
-        iter = materialize_segment(mit->second);
+        iter = materialize_segment(manifest, mit->second);
     }
     auto next_it = std::next(mit);
-    while (next_it != _manifest.end()) {
+    while (next_it != manifest.end()) {
         // Normally, the segments in the manifest do not overlap.
         // But in some cases we may see them overlapping, for instance
         // if they were produced by older version of redpanda.
@@ -162,11 +307,24 @@ remote_partition::borrow_result_t remote_partition::borrow_next_reader(
         }
         next_it++;
     }
-    model::offset next_offset = next_it == _manifest.end() ? model::offset{}
-                                                           : next_it->first;
+    model::offset next_offset = next_it == manifest.end() ? model::offset{}
+                                                          : next_it->first;
+    if (next_it == manifest.end() && spillover.has_value()) {
+        // Continue with the next spillover manifest or the partition
+        // manifest
+        next_offset = next_range_base_offset(*spillover);
+    }
+    auto reader = iter->second->borrow_reader(config, _ctxlog, _probe);
+    if (hint != model::offset{}) {
+        // The reader moved from the previous segment to this one so the
+        // partition is read sequentially. Segments that follow are
+        // hydrated in the background to avoid a stall on the next switch.
+        // The prefetch doesn't cross the boundary of the manifest.
+        // Note that 'iter' is invalidated by the materialization.
+        prefetch_segments(manifest, next_it);
+    }
     return borrow_result_t{
-      .reader = iter->second->borrow_reader(config, _ctxlog, _probe),
-      .next_segment_offset = next_offset};
+      .reader = std::move(reader), .next_segment_offset = next_offset};
 }
 
 class partition_record_batch_reader_impl final
@@ -425,6 +583,12 @@ private:
               config.start_offset,
               _next_segment_base_offset);
             if (_next_segment_base_offset != model::offset{}) {
+                if (auto spillover = _partition->_manifest.find_spillover(
+                      _next_segment_base_offset);
+                    spillover.has_value()) {
+                    co_await _partition->hydrate_spillover_manifest(
+                      *spillover);
+                }
                 auto [new_reader, new_next_offset]
                   = _partition->borrow_next_reader(
                     config, _next_segment_base_offset);
@@ -491,7 +655,8 @@ kafka::offset remote_partition::first_uploaded_offset() {
       _manifest.size() > 0,
       "The manifest for {} is not expected to be empty",
       _manifest.get_ntp());
-    auto so = _manifest.get_start_kafka_offset().value();
+    auto so = _manifest.get_archive_start_kafka_offset().value_or(
+      _manifest.get_start_kafka_offset().value());
     vlog(_ctxlog.trace, "remote partition first_uploaded_offset: {}", so);
     return so;
 }
@@ -553,22 +718,22 @@ remote_partition::aborted_transactions(offset_range offsets) {
     // redpanda offsets to extract aborted transactions metadata because
     // tx-manifests contains redpanda offsets.
     std::vector<model::tx_range> result;
-    auto first_it = _manifest.segment_containing(offsets.begin);
-    for (auto it = first_it; it != _manifest.end(); it++) {
-        if (it->second.base_offset > offsets.end_rp) {
-            break;
-        }
-
-        // Segment might be materialized, we need a
-        // second map lookup to learn if this is the case.
-        auto m = _segments.find(it->first);
-        if (m == _segments.end()) {
-            m = materialize_segment(it->second);
+    // The beginning of the range might be stored in the spillover
+    // manifests. The list is copied because the map can be updated
+    // while we're waiting for the manifest to be hydrated.
+    std::vector<segment_meta> spillovers;
+    for (const auto& meta : _manifest.get_spillover_map()) {
+        if (
+          meta.committed_kafka_offset() >= offsets.begin
+          && meta.base_offset <= offsets.end_rp) {
+            spillovers.push_back(meta);
         }
-        auto tx = co_await m->second->segment->aborted_transactions(
-          offsets.begin_rp, offsets.end_rp);
-        std::copy(tx.begin(), tx.end(), std::back_inserter(result));
     }
+    for (const auto& meta : spillovers) {
+        auto spillover = co_await hydrate_spillover_manifest(meta);
+        co_await collect_aborted_transactions(*spillover, offsets, result);
+    }
+    co_await collect_aborted_transactions(_manifest, offsets, result);
 
     // Adjacent segments might return the same transaction record.
     // In this case we will have a duplicate. The duplicates will always
@@ -587,6 +752,34 @@ remote_partition::aborted_transactions(offset_range offsets) {
     co_return result;
 }
 
+ss::future<> remote_partition::collect_aborted_transactions(
+  const partition_manifest& manifest,
+  const offset_range& offsets,
+  std::vector<model::tx_range>& result) {
+    auto first_it = manifest.segment_containing(offsets.begin);
+    if (
+      first_it == manifest.end() && manifest.size() > 0
+      && offsets.begin < manifest.begin()->second.base_kafka_offset()) {
+        // The range starts in one of the previous manifests
+        first_it = manifest.begin();
+    }
+    for (auto it = first_it; it != manifest.end(); it++) {
+        if (it->second.base_offset > offsets.end_rp) {
+            break;
+        }
+
+        // Segment might be materialized, we need a
+        // second map lookup to learn if this is the case.
+        auto m = _segments.find(it->first);
+        if (m == _segments.end()) {
+            m = materialize_segment(manifest, it->second);
+        }
+        auto tx = co_await m->second->segment->aborted_transactions(
+          offsets.begin_rp, offsets.end_rp);
+        std::copy(tx.begin(), tx.end(), std::back_inserter(result));
+    }
+}
+
 ss::future<> remote_partition::stop() {
     vlog(_ctxlog.debug, "remote partition stop {} segments", _segments.size());
 
@@ -649,6 +842,11 @@ ss::future<storage::translating_reader> remote_partition::make_reader(
       "remote partition make_reader invoked, config: {}, num segments {}",
       config,
       _segments.size());
+    if (auto spillover = find_spillover_for_reader(config);
+        spillover.has_value()) {
+        // The reader has to start from one of the spillover manifests
+        co_await hydrate_spillover_manifest(*spillover);
+    }
     auto ot_state = ss::make_lw_shared<storage::offset_translator_state>(
       get_ntp());
     auto impl = std::make_unique<partition_record_batch_reader_impl>(
@@ -664,7 +862,8 @@ remote_partition::timequery(storage::timequery_config cfg) {
         co_return std::nullopt;
     }
 
-    auto start_offset = _manifest.get_start_kafka_offset().value();
+    auto start_offset = _manifest.get_archive_start_kafka_offset().value_or(
+      _manifest.get_start_kafka_offset().value());
 
     // Synthesize a log_reader_config from our timequery_config
     storage::log_reader_config config(
@@ -702,9 +901,9 @@ remote_partition::seek_by_timestamp(model::timestamp t) {
     auto segment_meta = _manifest.timequery(t);
 
     if (segment_meta) {
-        auto found = _segments.find(segment_meta->get().base_offset);
+        auto found = _segments.find(segment_meta->base_offset);
         if (found == _segments.end()) {
-            found = materialize_segment(*segment_meta);
+            found = materialize_segment(_manifest, *segment_meta);
         }
         return found;
     }
@@ -752,6 +951,49 @@ ss::future<bool> remote_partition::tolerant_delete_object(
     }
 }
 
+/**
+ * Delete all segments referenced by the manifest along with their
+ * tx-manifests and indices.
+ *
+ * @return true if the caller should stop trying to delete things and
+ * silently return, false if successful, throws if deletion should be
+ * retried.
+ */
+ss::future<bool> remote_partition::erase_segments(
+  const partition_manifest& manifest, retry_chain_node& parent) {
+    for (const auto& i : manifest) {
+        auto path = manifest.generate_segment_path(i.second);
+        vlog(_ctxlog.debug, "Erasing segment {}", path);
+        // On failure, we throw: this should cause controller to retry
+        // the topic deletion operation that called us, until it
+        // eventually succeeds.
+        // TODO: S3 API has a plural delete API, which would be more
+        // suitable.
+        if (co_await tolerant_delete_object(
+              _bucket, cloud_storage_clients::object_key(path), parent)) {
+            co_return true;
+        };
+
+        auto tx_range_manifest_path
+          = tx_range_manifest(path).get_manifest_path();
+        if (co_await tolerant_delete_object(
+              _bucket,
+              cloud_storage_clients::object_key(tx_range_manifest_path),
+              parent)) {
+            co_return true;
+        };
+
+        auto index_path = generate_remote_index_path(path);
+        if (co_await tolerant_delete_object(
+              _bucket,
+              cloud_storage_clients::object_key(index_path()),
+              parent)) {
+            co_return true;
+        };
+    }
+    co_return false;
+}
+
 /**
  * The caller is responsible for determining whether it is appropriate
  * to delete data in S3, for example it is not appropriate if this is
@@ -799,9 +1041,8 @@ ss::future<> remote_partition::erase(ss::abort_source& as) {
     partition_manifest manifest(
       _manifest.get_ntp(), _manifest.get_revision_id());
 
-    auto manifest_path = manifest.get_manifest_path();
-    auto manifest_get_result = co_await _api.maybe_download_manifest(
-      _bucket, manifest_path, manifest, local_rtc);
+    auto manifest_get_result = co_await _api.download_partition_manifest(
+      _bucket, manifest, local_rtc, true);
 
     if (manifest_get_result == download_result::timedout) {
         // Throw on transient connectivity issues, so that controller
@@ -823,40 +1064,57 @@ ss::future<> remote_partition::erase(ss::abort_source& as) {
     // either a notfound (skip straight to erasing topic manifest), or a
     // success (iterate through manifest deleting segements)
     if (manifest_get_result != download_result::notfound) {
-        // Erase all segments
-        for (const auto& i : manifest) {
-            auto path = manifest.generate_segment_path(i.second);
-            vlog(_ctxlog.debug, "Erasing segment {}", path);
-            // On failure, we throw: this should cause controller to retry
-            // the topic deletion operation that called us, until it
-            // eventually succeeds.
-            // TODO: S3 API has a plural delete API, which would be more
-            // suitable.
+        // Erase the spillover manifests and the segments they reference
+        for (const auto& meta : manifest.get_spillover_map()) {
+            auto spillover_path = manifest.get_spillover_manifest_path(meta);
+            partition_manifest spillover(
+              manifest.get_ntp(), manifest.get_revision_id());
+            auto res = co_await _api.download_manifest(
+              _bucket, spillover_path, spillover, local_rtc);
+            if (res == download_result::timedout) {
+                throw std::runtime_error(fmt::format(
+                  "Timeout reading spillover manifest {}", spillover_path));
+            } else if (res == download_result::failed) {
+                vlog(
+                  _ctxlog.warn,
+                  "Error downloading spillover manifest {}: objects will not "
+                  "be deleted for this topic",
+                  spillover_path);
+                co_return;
+            } else if (res == download_result::success) {
+                if (co_await erase_segments(spillover, local_rtc)) {
+                    co_return;
+                }
+            }
+            vlog(
+              _ctxlog.debug, "Erasing spillover manifest {}", spillover_path);
             if (co_await tolerant_delete_object(
                   _bucket,
-                  cloud_storage_clients::object_key(path),
+                  cloud_storage_clients::object_key(spillover_path),
                   local_rtc)) {
                 co_return;
             };
+        }
+
+        // Erase all segments
+        if (co_await erase_segments(manifest, local_rtc)) {
+            co_return;
+        }
 
-            auto tx_range_manifest_path
-              = tx_range_manifest(path).get_manifest_path();
+        // Erase the partition manifest, both formats might be present if
+        // the manifest was uploaded before and after the binary format was
+        // enabled.
+        for (auto format : {manifest_format::serde, manifest_format::json}) {
+            auto manifest_path = manifest.get_manifest_path(format);
+            vlog(
+              _ctxlog.debug, "Erasing partition manifest {}", manifest_path);
             if (co_await tolerant_delete_object(
                   _bucket,
-                  cloud_storage_clients::object_key(tx_range_manifest_path),
+                  cloud_storage_clients::object_key(manifest_path),
                   local_rtc)) {
                 co_return;
             };
         }
-
-        // Erase the partition manifest
-        vlog(_ctxlog.debug, "Erasing partition manifest {}", manifest_path);
-        if (co_await tolerant_delete_object(
-              _bucket,
-              cloud_storage_clients::object_key(manifest_path),
-              local_rtc)) {
-            co_return;
-        };
     }
 
     // If I am partition 0, also delete the topic manifest
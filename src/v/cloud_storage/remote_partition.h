@@ -36,6 +36,7 @@
 #include <boost/iterator/iterator_facade.hpp>
 
 #include <chrono>
+#include <deque>
 #include <functional>
 
 namespace cloud_storage {
@@ -132,6 +133,8 @@ private:
       = absl::btree_map<model::offset, materialized_segment_ptr>;
     using iterator = segment_map_t::iterator;
 
+    using spillover_manifest_ptr = ss::lw_shared_ptr<const partition_manifest>;
+
     /// This is exposed for the benefit of the materialized_segment_state
     materialized_segments& materialized();
 
@@ -171,9 +174,56 @@ private:
       storage::log_reader_config config, model::offset hint = {});
 
     /// Materialize new segment
+    /// @param m is a manifest which contains the segment
     /// @return iterator that points to newly added segment (always valid
     /// iterator)
-    iterator materialize_segment(const segment_meta&);
+    iterator
+    materialize_segment(const partition_manifest& m, const segment_meta&);
+
+    /// Materialize segments which follow the one being read and hydrate
+    /// them in the background. Used when the partition is read
+    /// sequentially to avoid stalls when the reader moves to the next
+    /// segment. The number of segments is limited by the
+    /// cloud_storage_segment_prefetch property.
+    /// @param m is a manifest which contains the segments
+    /// @param it points to the first segment to prefetch
+    void prefetch_segments(
+      const partition_manifest& m, partition_manifest::const_iterator it);
+
+    /// Return metadata of the spillover manifest which has to be used by
+    /// the first lookup of the reader or nullopt if the reader starts in
+    /// the partition manifest
+    std::optional<segment_meta>
+    find_spillover_for_reader(const storage::log_reader_config& config) const;
+
+    /// Return the spillover manifest if it's already downloaded
+    spillover_manifest_ptr
+    get_spillover_manifest(const segment_meta& spillover_meta);
+
+    /// Download the spillover manifest if it's not available yet
+    ss::future<spillover_manifest_ptr>
+    hydrate_spillover_manifest(const segment_meta& spillover_meta);
+
+    /// Return base offset of the offset range that follows the spillover
+    /// manifest (next spillover manifest or the partition manifest)
+    model::offset
+    next_range_base_offset(const segment_meta& spillover_meta) const;
+
+    /// Find aborted transactions in segments of the manifest
+    ss::future<> collect_aborted_transactions(
+      const partition_manifest& m,
+      const offset_range& offsets,
+      std::vector<model::tx_range>& result);
+
+    /// Remove segments of the manifest from S3, used by erase()
+    ///
+    /// \return true if the caller should stop deleting objects
+    ss::future<bool>
+    erase_segments(const partition_manifest& m, retry_chain_node& parent);
+
+    /// Max number of spillover manifests kept in memory, the spillover
+    /// manifests are downloaded on demand when old offsets are read
+    static constexpr size_t max_cached_spillover_manifests = 4;
 
     retry_chain_node _rtc;
     retry_chain_logger _ctxlog;
@@ -185,6 +235,8 @@ private:
     cloud_storage_clients::bucket_name _bucket;
 
     segment_map_t _segments;
+    /// Recently used spillover manifests (most recent at the back)
+    std::deque<spillover_manifest_ptr> _spillover_manifests;
     partition_probe _probe;
 };
 
@@ -31,7 +31,9 @@
 
 #include <seastar/core/abort_source.hh>
 #include <seastar/core/circular_buffer.hh>
+#include <seastar/core/file.hh>
 #include <seastar/core/fstream.hh>
+#include <seastar/core/iostream.hh>
 #include <seastar/core/io_priority_class.hh>
 #include <seastar/core/loop.hh>
 #include <seastar/core/lowres_clock.hh>
@@ -114,7 +116,8 @@ remote_segment::remote_segment(
   , _rtc(&parent)
   , _ctxlog(cst_log, _rtc, generate_log_prefix(m, key))
   , _wait_list(expiry_handler_impl)
-  , _cache_backoff_jitter(cache_thrash_backoff) {
+  , _cache_backoff_jitter(cache_thrash_backoff)
+  , _chunk_size(config::shard_local_cfg().cloud_storage_cache_chunk_size()) {
     auto meta = m.get(key);
     vassert(meta, "Can't find segment metadata in manifest, key: {}", key);
 
@@ -124,6 +127,12 @@ remote_segment::remote_segment(
 
     _base_rp_offset = meta->base_offset;
     _max_rp_offset = meta->committed_offset;
+    _size = meta->size_bytes;
+    // Chunk boundaries are computed using the segment size so chunk reads
+    // can't be used if the manifest doesn't have it.
+    _chunked_reads
+      = !config::shard_local_cfg().cloud_storage_disable_chunk_reads()
+        && _size > 0;
     _base_offset_delta = std::clamp(
       meta->delta_offset, model::offset_delta(0), model::offset_delta::max());
     _compacted = meta->is_compacted;
@@ -177,13 +186,7 @@ remote_segment::data_stream(size_t pos, ss::io_priority_class io_priority) {
     vlog(_ctxlog.debug, "remote segment file input stream at {}", pos);
     ss::gate::holder g(_gate);
     co_await hydrate();
-    ss::file_input_stream_options options{};
-    options.buffer_size = config::shard_local_cfg().storage_read_buffer_size();
-    options.read_ahead
-      = config::shard_local_cfg().storage_read_readahead_count();
-    options.io_priority_class = io_priority;
-    auto data_stream = ss::make_file_input_stream(
-      _data_file, pos, std::move(options));
+    auto data_stream = make_data_stream(pos, io_priority);
     co_return storage::segment_reader_handle(std::move(data_stream));
 }
 
@@ -225,13 +228,7 @@ remote_segment::offset_data_stream(
       pos.file_pos,
       pos.rp_offset,
       pos.rp_offset - pos.kaf_offset);
-    ss::file_input_stream_options options{};
-    options.buffer_size = config::shard_local_cfg().storage_read_buffer_size();
-    options.read_ahead
-      = config::shard_local_cfg().storage_read_readahead_count();
-    options.io_priority_class = io_priority;
-    auto data_stream = ss::make_file_input_stream(
-      _data_file, pos.file_pos, std::move(options));
+    auto data_stream = make_data_stream(pos.file_pos, io_priority);
     co_return input_stream_with_offsets{
       .stream = std::move(data_stream),
       .rp_offset = pos.rp_offset,
@@ -239,6 +236,102 @@ remote_segment::offset_data_stream(
     };
 }
 
+/// Data source which reads the segment chunk by chunk. Chunks are hydrated
+/// when the reader reaches them, the following chunks are prefetched in the
+/// background.
+class chunk_data_source_impl final : public ss::data_source_impl {
+public:
+    chunk_data_source_impl(
+      remote_segment& segment,
+      uint64_t pos,
+      ss::io_priority_class io_priority)
+      : _segment(segment)
+      , _pos(pos)
+      , _io_priority(io_priority) {}
+
+    chunk_data_source_impl(const chunk_data_source_impl&) = delete;
+    chunk_data_source_impl& operator=(const chunk_data_source_impl&) = delete;
+    chunk_data_source_impl(chunk_data_source_impl&&) = delete;
+    chunk_data_source_impl& operator=(chunk_data_source_impl&&) = delete;
+    ~chunk_data_source_impl() override = default;
+
+    ss::future<ss::temporary_buffer<char>> get() override {
+        while (_pos < _segment.get_size()) {
+            if (!_stream) {
+                co_await open_chunk();
+            }
+            auto buf = co_await _stream->read();
+            if (!buf.empty()) {
+                _pos += buf.size();
+                co_return buf;
+            }
+            if (_pos < _chunk_end) {
+                throw remote_segment_exception(fmt::format(
+                  "Chunk of segment {} is truncated at {}, expected end {}",
+                  _segment.get_segment_path(),
+                  _pos,
+                  _chunk_end));
+            }
+            co_await close_chunk();
+        }
+        co_return ss::temporary_buffer<char>{};
+    }
+
+    ss::future<> close() override { return close_chunk(); }
+
+private:
+    ss::future<> open_chunk() {
+        auto start = _segment.get_chunk_start(_pos);
+        _chunk_end = _segment.get_chunk_end(start);
+        _file = co_await _segment.materialize_chunk(start);
+        _segment.prefetch_chunks(start);
+        ss::file_input_stream_options options{};
+        options.buffer_size
+          = config::shard_local_cfg().storage_read_buffer_size();
+        options.read_ahead
+          = config::shard_local_cfg().storage_read_readahead_count();
+        options.io_priority_class = _io_priority;
+        _stream = ss::make_file_input_stream(
+          _file, _pos - start, _chunk_end - _pos, std::move(options));
+    }
+
+    ss::future<> close_chunk() {
+        if (_stream) {
+            co_await _stream->close();
+            _stream = std::nullopt;
+        }
+        if (_file) {
+            co_await _file.close();
+            _file = ss::file{};
+        }
+    }
+
+    remote_segment& _segment;
+    uint64_t _pos;
+    uint64_t _chunk_end{0};
+    ss::io_priority_class _io_priority;
+    ss::file _file;
+    std::optional<ss::input_stream<char>> _stream;
+};
+
+ss::input_stream<char> remote_segment::make_data_stream(
+  uint64_t pos, ss::io_priority_class io_priority) {
+    if (!_data_file) {
+        return ss::input_stream<char>(ss::data_source(
+          std::make_unique<chunk_data_source_impl>(*this, pos, io_priority)));
+    }
+    ss::file_input_stream_options options{};
+    options.buffer_size = config::shard_local_cfg().storage_read_buffer_size();
+    options.read_ahead
+      = config::shard_local_cfg().storage_read_readahead_count();
+    options.io_priority_class = io_priority;
+    return ss::make_file_input_stream(_data_file, pos, std::move(options));
+}
+
+bool remote_segment::is_materialized() const {
+    return _tx_range && (_data_file || (_chunked_reads && _index));
+}
+
 std::optional<offset_index::find_result>
 remote_segment::maybe_get_offsets(kafka::offset kafka_offset) {
     if (!_index) {
@@ -302,7 +395,7 @@ ss::future<uint64_t> remote_segment::do_hydrate_segment_inner(
     }
     if (index_prepared) {
         auto index_stream = make_iobuf_input_stream(tmpidx.to_iobuf());
-        co_await _cache.put(_path().native() + ".index", index_stream);
+        co_await _cache.put(generate_remote_index_path(_path)(), index_stream);
         _index = std::move(tmpidx);
     }
     co_return size_bytes;
@@ -331,6 +424,173 @@ ss::future<> remote_segment::do_hydrate_segment() {
     }
 }
 
+ss::future<bool> remote_segment::do_hydrate_chunked() {
+    if (co_await _cache.is_cached(_path) == cache_element_status::available) {
+        // The whole segment was hydrated before, no need to download it
+        // again in chunks.
+        vlog(_ctxlog.debug, "Segment {} is available in the cache", _path);
+        _chunked_reads = false;
+        co_return true;
+    }
+    if (!_index) {
+        co_await maybe_materialize_index();
+    }
+    if (!_index && !co_await do_hydrate_index()) {
+        // The segment was uploaded without the index so the file position
+        // of the offset can't be found without the whole segment.
+        vlog(
+          _ctxlog.info,
+          "Index of segment {} is not available, chunk reads disabled",
+          _path);
+        _chunked_reads = false;
+        co_return true;
+    }
+    if (!_tx_range) {
+        auto tx_path = generate_remote_tx_path(_path);
+        if (
+          co_await _cache.is_cached(tx_path)
+          == cache_element_status::not_available) {
+            co_await do_hydrate_txrange();
+        }
+        co_return co_await do_materialize_txrange();
+    }
+    co_return true;
+}
+
+ss::future<bool> remote_segment::do_hydrate_index() {
+    retry_chain_node local_rtc(
+      cache_hydration_timeout, cache_hydration_backoff, &_rtc);
+    offset_index ix(
+      _base_rp_offset,
+      _base_rp_offset - _base_offset_delta,
+      0,
+      remote_segment_sampling_step_bytes);
+    auto path = generate_remote_index_path(_path);
+    auto res = co_await _api.download_index(_bucket, path, ix, local_rtc);
+    if (res == download_result::timedout) {
+        throw download_exception(res, path);
+    }
+    if (res != download_result::success) {
+        co_return false;
+    }
+    auto index_stream = make_iobuf_input_stream(ix.to_iobuf());
+    co_await _cache.put(path(), index_stream);
+    _index = std::move(ix);
+    co_return true;
+}
+
+remote_segment::chunk_start_t
+remote_segment::get_chunk_start(uint64_t pos) const {
+    return pos - pos % _chunk_size;
+}
+
+uint64_t remote_segment::get_chunk_end(chunk_start_t start) const {
+    return std::min(start + _chunk_size, _size);
+}
+
+std::filesystem::path
+remote_segment::get_chunk_path(chunk_start_t start) const {
+    // The chunk size is a part of the key because it can be changed
+    // while the chunks of the segment are in the cache.
+    return fmt::format(
+      "{}_chunks/{}-{}", _path().native(), start, get_chunk_end(start) - 1);
+}
+
+ss::future<ss::file> remote_segment::materialize_chunk(chunk_start_t start) {
+    ss::gate::holder guard(_gate);
+    auto path = get_chunk_path(start);
+    while (true) {
+        co_await hydrate_chunk(start);
+        if (auto item = co_await _cache.get(path); item.has_value()) {
+            co_return item->body;
+        }
+        // Same as in do_materialize_segment, the chunk was evicted right
+        // after it was hydrated.
+        vlog(
+          _ctxlog.info,
+          "Chunk {} was deleted from cache and need to be re-hydrated",
+          path);
+        co_await ss::sleep(_cache_backoff_jitter.next_duration());
+    }
+}
+
+ss::future<> remote_segment::hydrate_chunk(chunk_start_t start) {
+    ss::gate::holder guard(_gate);
+    if (auto it = _chunks_in_progress.find(start);
+        it != _chunks_in_progress.end()) {
+        auto pending = it->second;
+        co_return co_await pending->get_shared_future();
+    }
+    auto pending = ss::make_lw_shared<ss::shared_promise<>>();
+    _chunks_in_progress.emplace(start, pending);
+    auto deferred = ss::defer(
+      [this, start] { _chunks_in_progress.erase(start); });
+    try {
+        if (
+          co_await _cache.is_cached(get_chunk_path(start))
+          == cache_element_status::not_available) {
+            co_await do_hydrate_chunk(start);
+        }
+    } catch (...) {
+        pending->set_exception(std::current_exception());
+        throw;
+    }
+    pending->set_value();
+}
+
+ss::future<> remote_segment::do_hydrate_chunk(chunk_start_t start) {
+    retry_chain_node local_rtc(
+      cache_hydration_timeout, cache_hydration_backoff, &_rtc);
+    auto range = cloud_storage_clients::http_byte_range{
+      start, get_chunk_end(start) - 1};
+    vlog(
+      _ctxlog.debug,
+      "Hydrating chunk {}-{} of segment {}",
+      range.first,
+      range.second,
+      _path);
+    auto res = co_await _api.download_segment(
+      _bucket,
+      _path,
+      [this, start](uint64_t size_bytes, ss::input_stream<char> s) {
+          return do_hydrate_chunk_inner(start, size_bytes, std::move(s));
+      },
+      local_rtc,
+      range);
+    if (res != download_result::success) {
+        throw download_exception(res, _path);
+    }
+}
+
+ss::future<uint64_t> remote_segment::do_hydrate_chunk_inner(
+  chunk_start_t start, uint64_t size_bytes, ss::input_stream<char> s) {
+    co_await _cache.put(get_chunk_path(start), s).finally([&s] {
+        return s.close();
+    });
+    co_return size_bytes;
+}
+
+void remote_segment::prefetch_chunks(chunk_start_t start) {
+    auto num_chunks = config::shard_local_cfg().cloud_storage_chunk_prefetch();
+    auto next = start + _chunk_size;
+    for (uint16_t i = 0; i < num_chunks && next < _size; i++) {
+        if (!_chunks_in_progress.contains(next)) {
+            ssx::spawn_with_gate(_gate, [this, next] {
+                return hydrate_chunk(next).handle_exception(
+                  [this, next](const std::exception_ptr& e) {
+                      vlog(
+                        _ctxlog.debug,
+                        "Failed to prefetch chunk {} of segment {}: {}",
+                        next,
+                        _path,
+                        e);
+                  });
+            });
+        }
+        next += _chunk_size;
+    }
+}
+
 ss::future<> remote_segment::do_hydrate_txrange() {
     ss::gate::holder guard(_gate);
     retry_chain_node local_rtc(
@@ -464,7 +724,7 @@ ss::future<bool> remote_segment::do_materialize_txrange() {
 
 ss::future<> remote_segment::maybe_materialize_index() {
     ss::gate::holder guard(_gate);
-    auto path = _path().native() + ".index";
+    auto path = generate_remote_index_path(_path)();
     offset_index ix(
       _base_rp_offset,
       _base_rp_offset - _base_offset_delta,
@@ -590,7 +850,18 @@ ss::future<> remote_segment::run_hydrate_bg() {
               _wait_list.size(),
               _data_file ? "available" : "not available");
             std::exception_ptr err;
-            if (!_data_file || !_tx_range) {
+            if (_chunked_reads && !is_materialized()) {
+                // Only the metadata is hydrated, the data is downloaded in
+                // chunks by the readers
+                try {
+                    if (co_await do_hydrate_chunked() == false) {
+                        continue;
+                    }
+                } catch (const download_exception&) {
+                    err = std::current_exception();
+                }
+            }
+            if (!err && !is_materialized()) {
                 // We don't have a _data_file set so we have to check cache
                 // and retrieve the file out of it or hydrate.
                 // If _data_file is initialized we can use it safely since the
@@ -671,13 +942,14 @@ ss::future<> remote_segment::run_hydrate_bg() {
                     }
                 }
             }
-            // Invariant: here we should have a data file or error to be set.
-            // If the hydration failed we will have 'err' set to some value. The
-            // error needs to be propagated further. Otherwise we will always
-            // have _data_file set because if we don't we will retry the
-            // hydration earlier.
+            // Invariant: here we should have a data file (or index if the
+            // segment is read in chunks) or error to be set. If the hydration
+            // failed we will have 'err' set to some value. The error needs to
+            // be propagated further. Otherwise the segment is always
+            // materialized because if it isn't we will retry the hydration
+            // earlier.
             vassert(
-              _data_file || err,
+              is_materialized() || err,
               "Segment hydration succeded but file isn't available");
             while (!_wait_list.empty()) {
                 auto& p = _wait_list.front();
@@ -716,6 +988,29 @@ ss::future<> remote_segment::hydrate() {
     });
 }
 
+ss::future<> remote_segment::prefetch() {
+    ss::gate::holder guard(_gate);
+    auto num_chunks = config::shard_local_cfg().cloud_storage_chunk_prefetch();
+    uint64_t required = _size;
+    if (_chunked_reads) {
+        required = std::min<uint64_t>(_size, _chunk_size * (num_chunks + 1));
+    }
+    if (!co_await _cache.has_free_space(_path, required)) {
+        vlog(
+          _ctxlog.debug,
+          "Not enough space in the cache to prefetch {} bytes of segment {}",
+          required,
+          _path);
+        co_return;
+    }
+    vlog(_ctxlog.debug, "Prefetching segment {}", _path);
+    co_await hydrate();
+    if (_chunked_reads) {
+        co_await hydrate_chunk(0);
+        prefetch_chunks(0);
+    }
+}
+
 ss::future<std::vector<model::tx_range>>
 remote_segment::aborted_transactions(model::offset from, model::offset to) {
     co_await hydrate();
@@ -30,12 +30,13 @@
 #include <seastar/core/condition-variable.hh>
 #include <seastar/core/expiring_fifo.hh>
 #include <seastar/core/io_priority_class.hh>
+#include <seastar/core/shared_future.hh>
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/temporary_buffer.hh>
 
-namespace cloud_storage {
+#include <absl/container/flat_hash_map.h>
 
-static constexpr size_t remote_segment_sampling_step_bytes = 64_KiB;
+namespace cloud_storage {
 
 class download_exception : public std::exception {
 public:
@@ -53,7 +54,11 @@ public:
       : std::runtime_error(m) {}
 };
 
+class chunk_data_source_impl;
+
 class remote_segment final {
+    friend class chunk_data_source_impl;
+
 public:
     remote_segment(
       remote& r,
@@ -86,6 +91,9 @@ public:
     /// Get base offset of the segment (kafka offset)
     const kafka::offset get_base_kafka_offset() const;
 
+    /// Size of the segment object in bytes
+    uint64_t get_size() const { return _size; }
+
     ss::future<> stop();
 
     /// create an input stream _sharing_ the underlying file handle
@@ -108,6 +116,11 @@ public:
     /// Hydrate the segment
     ss::future<> hydrate();
 
+    /// Hydrate the segment ahead of the reader. If the segment is read in
+    /// chunks only the metadata and the first chunks are downloaded. Nothing
+    /// is downloaded if the data doesn't fit into the cache.
+    ss::future<> prefetch();
+
     retry_chain_node* get_retry_chain_node() { return &_rtc; }
 
     bool download_in_progress() const noexcept { return !_wait_list.empty(); }
@@ -126,11 +139,23 @@ public:
     bool is_stopped() const { return _stopped; }
 
 private:
+    /// Byte position of the first byte of the chunk
+    using chunk_start_t = uint64_t;
+
     /// get a file offset for the corresponding kafka offset
     /// if the index is available
     std::optional<offset_index::find_result>
     maybe_get_offsets(kafka::offset kafka_offset);
 
+    /// Return true if the segment can be read. The segment file is opened
+    /// or, if the segment is read in chunks, the index is available.
+    bool is_materialized() const;
+
+    /// Create a stream which reads segment data starting from 'pos'. If the
+    /// segment is read in chunks the stream hydrates the chunks on demand.
+    ss::input_stream<char>
+    make_data_stream(uint64_t pos, ss::io_priority_class io_priority);
+
     /// Sets the results of the waiters of this segment as the given error.
     void set_waiter_errors(const std::exception_ptr& err);
 
@@ -149,6 +174,44 @@ private:
     ss::future<uint64_t>
       do_hydrate_segment_inner(uint64_t, ss::input_stream<char>);
 
+    /// Prepare the segment to be read in chunks. The method hydrates the
+    /// segment index and tx manifest, the data is hydrated lazily by the
+    /// readers. Returns false if the hydration has to be retried. If the
+    /// segment index is not available or if the whole segment is already
+    /// in the cache chunk reads are disabled for the segment.
+    ss::future<bool> do_hydrate_chunked();
+
+    /// Download the segment index and add it to the cache. Returns false
+    /// if the index is not available.
+    ss::future<bool> do_hydrate_index();
+
+    /// Get the start of the chunk that contains the file position
+    chunk_start_t get_chunk_start(uint64_t pos) const;
+
+    /// Get the end of the chunk (exclusive)
+    uint64_t get_chunk_end(chunk_start_t start) const;
+
+    /// Cache key of the chunk
+    std::filesystem::path get_chunk_path(chunk_start_t start) const;
+
+    /// Hydrate the chunk and open its file. The caller is responsible for
+    /// closing the file.
+    ss::future<ss::file> materialize_chunk(chunk_start_t start);
+
+    /// Download the chunk into the cache if it's not available. Concurrent
+    /// requests for the same chunk wait for a single download.
+    ss::future<> hydrate_chunk(chunk_start_t start);
+
+    /// Download the chunk using a ranged request
+    ss::future<> do_hydrate_chunk(chunk_start_t start);
+
+    /// Helper for do_hydrate_chunk
+    ss::future<uint64_t> do_hydrate_chunk_inner(
+      chunk_start_t start, uint64_t, ss::input_stream<char>);
+
+    /// Hydrate the chunks that follow 'start' in the background
+    void prefetch_chunks(chunk_start_t start);
+
     /// Hydrate tx manifest. Method downloads the manifest file to the cache
     /// dir.
     ss::future<> do_hydrate_txrange();
@@ -172,6 +235,7 @@ private:
     model::offset _base_rp_offset;
     model::offset_delta _base_offset_delta;
     model::offset _max_rp_offset;
+    uint64_t _size;
 
     retry_chain_node _rtc;
     retry_chain_logger _ctxlog;
@@ -192,6 +256,14 @@ private:
     // For backing off on apparent thrash/saturation of the local cache
     simple_time_jitter<ss::lowres_clock> _cache_backoff_jitter;
 
+    /// Set if the segment is hydrated in chunks instead of being
+    /// downloaded as a whole
+    bool _chunked_reads{false};
+    size_t _chunk_size;
+    /// Chunks which are being downloaded
+    absl::flat_hash_map<chunk_start_t, ss::lw_shared_ptr<ss::shared_promise<>>>
+      _chunks_in_progress;
+
     bool _compacted{false};
     bool _stopped{false};
 };
@@ -15,8 +15,14 @@
 #include "serde/serde.h"
 #include "vlog.h"
 
+#include <fmt/core.h>
+
 namespace cloud_storage {
 
+remote_segment_path generate_remote_index_path(const remote_segment_path& p) {
+    return remote_segment_path(fmt::format("{}.index", p().native()));
+}
+
 offset_index::offset_index(
   model::offset initial_rp,
   kafka::offset initial_kaf,
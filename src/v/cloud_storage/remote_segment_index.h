@@ -12,6 +12,7 @@
 
 #include "bytes/iobuf.h"
 #include "bytes/iobuf_parser.h"
+#include "cloud_storage/types.h"
 #include "model/fundamental.h"
 #include "seastarx.h"
 #include "storage/parser.h"
@@ -24,6 +25,12 @@
 
 namespace cloud_storage {
 
+static constexpr size_t remote_segment_sampling_step_bytes = 64_KiB;
+
+/// Path of the segment index object, the index is uploaded next to the
+/// segment and stored in the cache next to the segment file
+remote_segment_path generate_remote_index_path(const remote_segment_path& p);
+
 /// Offset index for remote_segment
 ///
 /// The object indexes tuples that contain three elements:
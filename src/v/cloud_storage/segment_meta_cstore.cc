@@ -19,6 +19,7 @@
 #include <bitset>
 #include <functional>
 #include <tuple>
+#include <utility>
 
 namespace cloud_storage {
 
@@ -172,12 +173,12 @@ public:
       gauge_col_t::const_iterator,
       gauge_col_t::const_iterator,
       gauge_col_t::const_iterator,
-      counter_col_t::const_iterator,
-      counter_col_t::const_iterator,
       gauge_col_t::const_iterator,
-      counter_col_t::const_iterator,
-      counter_col_t::const_iterator,
-      counter_col_t::const_iterator>;
+      gauge_col_t::const_iterator,
+      gauge_col_t::const_iterator,
+      gauge_col_t::const_iterator,
+      gauge_col_t::const_iterator,
+      gauge_col_t::const_iterator>;
 
     column_store()
       : _is_compacted(int64_xor_alg())
@@ -186,12 +187,12 @@ public:
       , _committed_offset(int64_xor_alg())
       , _base_timestamp(int64_xor_alg())
       , _max_timestamp(int64_xor_alg())
-      , _delta_offset(int64_delta_alg(0))
-      , _ntp_revision(int64_delta_alg(0))
+      , _delta_offset(int64_xor_alg())
+      , _ntp_revision(int64_xor_alg())
       , _archiver_term(int64_xor_alg())
-      , _segment_term(int64_delta_alg(0))
-      , _delta_offset_end(int64_delta_alg(0))
-      , _sname_format(int64_delta_alg(0)) {}
+      , _segment_term(int64_xor_alg())
+      , _delta_offset_end(int64_xor_alg())
+      , _sname_format(int64_xor_alg()) {}
 
     /// Add element to the store. The operation is transactional.
     void append(const segment_meta& meta) {
@@ -441,14 +442,16 @@ private:
     gauge_col_t _committed_offset;
     gauge_col_t _base_timestamp;
     gauge_col_t _max_timestamp;
-    counter_col_t _delta_offset;
-    counter_col_t _ntp_revision;
-    /// The archiver term is not strictly monotonic in manifests
-    /// generated by old redpanda versions
+    // The fields below are not guaranteed to be monotonic in real manifests.
+    // Segments uploaded by old redpanda versions don't have some of them set
+    // and re-uploaded compacted segments may use newer name format or
+    // revision than the segments that follow them.
+    gauge_col_t _delta_offset;
+    gauge_col_t _ntp_revision;
     gauge_col_t _archiver_term;
-    counter_col_t _segment_term;
-    counter_col_t _delta_offset_end;
-    counter_col_t _sname_format;
+    gauge_col_t _segment_term;
+    gauge_col_t _delta_offset_end;
+    gauge_col_t _sname_format;
 
     hint_map_t _hints;
 };
@@ -474,6 +477,12 @@ public:
 
     bool equal(const impl& other) const { return _iters == other._iters; }
 
+    size_t index() const {
+        return std::get<static_cast<size_t>(segment_meta_ix::base_offset)>(
+                 _iters)
+          .index();
+    }
+
 private:
     column_store::iterators_t _iters;
     mutable std::optional<segment_meta> _curr;
@@ -491,6 +500,10 @@ const segment_meta& segment_meta_materializing_iterator::dereference() const {
 
 void segment_meta_materializing_iterator::increment() { _impl->increment(); }
 
+size_t segment_meta_materializing_iterator::index() const {
+    return _impl->index();
+}
+
 bool segment_meta_materializing_iterator::equal(
   const segment_meta_materializing_iterator& other) const {
     return _impl->equal(*other._impl);
@@ -560,8 +573,53 @@ private:
 segment_meta_cstore::segment_meta_cstore()
   : _impl(std::make_unique<impl>()) {}
 
+segment_meta_cstore::segment_meta_cstore(const segment_meta_cstore& other)
+  : _impl(std::make_unique<impl>()) {
+    // The columns are append only, replaying the elements in the same
+    // order produces identical encoding.
+    for (const auto& meta : other) {
+        _impl->append(meta);
+    }
+}
+
+segment_meta_cstore&
+segment_meta_cstore::operator=(const segment_meta_cstore& other) {
+    if (this != &other) {
+        segment_meta_cstore tmp(other);
+        _impl = std::move(tmp._impl);
+    }
+    return *this;
+}
+
+// The moved-from object is left empty rather than without an impl so it
+// remains usable.
+segment_meta_cstore::segment_meta_cstore(segment_meta_cstore&& other)
+  : _impl(std::exchange(other._impl, std::make_unique<impl>())) {}
+
+segment_meta_cstore&
+segment_meta_cstore::operator=(segment_meta_cstore&& other) {
+    if (this != &other) {
+        _impl = std::exchange(other._impl, std::make_unique<impl>());
+    }
+    return *this;
+}
+
 segment_meta_cstore::~segment_meta_cstore() {}
 
+bool segment_meta_cstore::operator==(const segment_meta_cstore& other) const {
+    if (size() != other.size()) {
+        return false;
+    }
+    auto end_it = end();
+    auto rhs = other.begin();
+    for (auto lhs = begin(); lhs != end_it; ++lhs, ++rhs) {
+        if (*lhs != *rhs) {
+            return false;
+        }
+    }
+    return true;
+}
+
 segment_meta_cstore::const_iterator segment_meta_cstore::begin() const {
     return const_iterator(_impl->begin());
 }
@@ -601,7 +659,29 @@ segment_meta_cstore::lower_bound(model::offset o) const {
     return const_iterator(_impl->lower_bound(o));
 }
 
-void segment_meta_cstore::insert(const segment_meta& s) { _impl->insert(s); }
+void segment_meta_cstore::insert(const segment_meta& s) {
+    auto last = _impl->last_segment();
+    if (!last.has_value() || last->base_offset < s.base_offset) {
+        _impl->append(s);
+        return;
+    }
+    // The columns can only be appended to so the element which doesn't
+    // belong to the end of the sequence requires a full rebuild.
+    auto tmp = std::make_unique<impl>();
+    bool inserted = false;
+    auto end_it = end();
+    for (auto it = begin(); it != end_it; ++it) {
+        if (!inserted && it->base_offset >= s.base_offset) {
+            tmp->append(s);
+            inserted = true;
+            if (it->base_offset == s.base_offset) {
+                continue;
+            }
+        }
+        tmp->append(*it);
+    }
+    _impl = std::move(tmp);
+}
 
 void segment_meta_cstore::prefix_truncate(model::offset new_start_offset) {
     return _impl->prefix_truncate(new_start_offset);
@@ -761,6 +761,10 @@ public:
 
     ~segment_meta_materializing_iterator();
 
+    /// Position of the element in the column store. The method shouldn't
+    /// be called on the end iterator.
+    size_t index() const;
+
 private:
     friend class boost::iterator_core_access;
     const segment_meta& dereference() const;
@@ -783,8 +787,14 @@ public:
     using const_iterator = segment_meta_materializing_iterator;
 
     segment_meta_cstore();
+    segment_meta_cstore(const segment_meta_cstore&);
+    segment_meta_cstore& operator=(const segment_meta_cstore&);
+    segment_meta_cstore(segment_meta_cstore&&);
+    segment_meta_cstore& operator=(segment_meta_cstore&&);
     ~segment_meta_cstore();
 
+    bool operator==(const segment_meta_cstore&) const;
+
     /// Return iterator
     const_iterator begin() const;
     const_iterator end() const;
@@ -809,6 +819,9 @@ public:
     const_iterator lower_bound(model::offset) const;
     const_iterator at_index(size_t ix) const;
 
+    /// Add element to the store. Elements added in base offset order
+    /// are appended to the columns. Otherwise, the columns are rebuilt
+    /// and the element with the same base offset (if any) is replaced.
     void insert(const segment_meta&);
 
     std::pair<size_t, size_t> inflated_actual_size() const;
@@ -21,6 +21,7 @@ namespace cloud_storage {
 
 class remote_segment;
 class remote_partition;
+class partition_manifest;
 struct materialized_segment_state;
 class remote_segment_batch_reader;
 class partition_probe;
@@ -31,8 +32,12 @@ class partition_probe;
 /// least one active reader that consumes data from the
 /// remote segment.
 struct materialized_segment_state {
+    /// \param m is a manifest which contains the segment
     materialized_segment_state(
-      model::offset bo, remote_partition& p, ssx::semaphore_units);
+      model::offset bo,
+      remote_partition& p,
+      const partition_manifest& m,
+      ssx::semaphore_units);
 
     void return_reader(std::unique_ptr<remote_segment_batch_reader> reader);
 
@@ -11,6 +11,7 @@
 #include "cloud_storage/access_time_tracker.h"
 #include "seastarx.h"
 #include "ssx/sformat.h"
+#include "units.h"
 
 #include <seastar/testing/perf_tests.hh>
 
@@ -28,7 +29,7 @@ static void run_test(int test_scale) {
 
     for (int i = 0; i < test_scale; i++) {
         perf_tests::start_measuring_time();
-        tracker.add_timestamp(names[i % test_scale], make_ts(i));
+        tracker.add(names[i % test_scale], make_ts(i), 1_MiB);
         perf_tests::stop_measuring_time();
     }
 }
@@ -13,6 +13,8 @@
 #include "cache_test_fixture.h"
 #include "cloud_storage/access_time_tracker.h"
 #include "cloud_storage/cache_service.h"
+#include "ssx/future-util.h"
+#include "test_utils/async.h"
 #include "test_utils/fixture.h"
 #include "units.h"
 #include "utils/file_io.h"
@@ -25,6 +27,7 @@
 #include <boost/test/tools/old/interface.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <stdexcept>
 
@@ -117,7 +120,7 @@ FIXTURE_TEST(invalidate_missing_file_ok, cache_test_fixture) {
 FIXTURE_TEST(empty_cache_nothing_deleted, cache_test_fixture) {
     ss::sleep(ss::lowres_clock::duration(2s)).get();
 
-    BOOST_CHECK_EQUAL(0, sharded_cache.local().get_total_cleaned());
+    BOOST_CHECK_EQUAL(0, sharded_cache.local().get_total_cleaned().get());
 }
 
 FIXTURE_TEST(files_up_to_max_cache_size_not_deleted, cache_test_fixture) {
@@ -126,7 +129,7 @@ FIXTURE_TEST(files_up_to_max_cache_size_not_deleted, cache_test_fixture) {
 
     ss::sleep(ss::lowres_clock::duration(2s)).get();
 
-    BOOST_CHECK_EQUAL(0, sharded_cache.local().get_total_cleaned());
+    BOOST_CHECK_EQUAL(0, sharded_cache.local().get_total_cleaned().get());
 }
 
 FIXTURE_TEST(file_bigger_than_max_cache_size_deleted, cache_test_fixture) {
@@ -135,7 +138,37 @@ FIXTURE_TEST(file_bigger_than_max_cache_size_deleted, cache_test_fixture) {
 
     ss::sleep(ss::lowres_clock::duration(2s)).get();
 
-    BOOST_CHECK_EQUAL(2_MiB + 1_KiB, sharded_cache.local().get_total_cleaned());
+    BOOST_CHECK_EQUAL(
+      2_MiB + 1_KiB, sharded_cache.local().get_total_cleaned().get());
+}
+
+FIXTURE_TEST(quota_is_borrowed_from_other_shards, cache_test_fixture) {
+    auto data_string1 = create_data_string('a', 1_MiB + 1_KiB);
+    put_into_cache(data_string1, KEY);
+    tests::cooperative_spin_wait_with_timeout(5s, [this] {
+        return is_tracked(KEY);
+    }).get();
+
+    ss::sleep(ss::lowres_clock::duration(2s)).get();
+
+    // The file is larger than the quota of a single shard but it fits
+    // into the cache
+    BOOST_CHECK_EQUAL(0, sharded_cache.local().get_total_cleaned().get());
+    auto path = (CACHE_DIR / KEY).lexically_normal().native();
+    auto owner_quota = sharded_cache
+                         .invoke_on(
+                           cache::owner_shard(path),
+                           [](cache& c) { return c._quota; })
+                         .get();
+    BOOST_CHECK_GE(owner_quota, 1_MiB + 1_KiB);
+    // The quota is moved between the shards but never created
+    auto total_quota = sharded_cache
+                         .map_reduce0(
+                           [](cache& c) { return c._quota; },
+                           uint64_t{0},
+                           std::plus<>())
+                         .get();
+    BOOST_CHECK_EQUAL(total_quota, 1_MiB + 500_KiB);
 }
 
 FIXTURE_TEST(
@@ -148,11 +181,89 @@ FIXTURE_TEST(
 
     ss::sleep(ss::lowres_clock::duration(2s)).get();
 
-    BOOST_CHECK_EQUAL(1_MiB + 1_KiB, sharded_cache.local().get_total_cleaned());
+    BOOST_CHECK_EQUAL(
+      1_MiB + 1_KiB, sharded_cache.local().get_total_cleaned().get());
     BOOST_REQUIRE(!ss::file_exists((CACHE_DIR / KEY).native()).get());
     BOOST_REQUIRE(ss::file_exists((CACHE_DIR / KEY2).native()).get());
 }
 
+FIXTURE_TEST(cache_size_is_tracked, cache_test_fixture) {
+    auto data_string1 = create_data_string('a', 1_KiB);
+    put_into_cache(data_string1, KEY);
+    auto data_string2 = create_data_string('b', 2_KiB);
+    put_into_cache(data_string2, KEY2);
+
+    // Size accounting is done on shard 0 in the background
+    tests::cooperative_spin_wait_with_timeout(5s, [this] {
+        return is_tracked(KEY) && is_tracked(KEY2);
+    }).get();
+    auto size_before = get_current_cache_size();
+
+    // Overwrite doesn't account the file twice
+    put_into_cache(create_data_string('c', 3_KiB), KEY);
+    tests::cooperative_spin_wait_with_timeout(5s, [this, size_before] {
+        return get_current_cache_size() == size_before + 2_KiB;
+    }).get();
+
+    sharded_cache.local().invalidate(KEY).get();
+    BOOST_CHECK(!is_tracked(KEY));
+    BOOST_CHECK_EQUAL(get_current_cache_size(), size_before - 1_KiB);
+}
+
+FIXTURE_TEST(tracker_is_used_after_restart, cache_test_fixture) {
+    put_into_cache(create_data_string('a', 1_KiB), KEY);
+    tests::cooperative_spin_wait_with_timeout(5s, [this] {
+        return is_tracked(KEY);
+    }).get();
+    // The access tracking of this file is still in flight, shutdown
+    // has to wait for it before the tracker is saved.
+    put_into_cache(create_data_string('b', 1_KiB), KEY2);
+    sharded_cache.stop().get();
+
+    sharded_cache.start(CACHE_DIR, 1_MiB + 500_KiB).get();
+    sharded_cache
+      .invoke_on_all([](cloud_storage::cache& c) { return c.start(); })
+      .get();
+
+    // The cache directory is not walked after clean shutdown, all files
+    // are known from the saved trackers.
+    BOOST_CHECK(is_tracked(KEY));
+    BOOST_CHECK(is_tracked(KEY2));
+    BOOST_CHECK_EQUAL(get_current_cache_size(), 2_KiB);
+}
+
+FIXTURE_TEST(put_in_flight_during_restart, cache_test_fixture) {
+    // The file is written by a shard which doesn't own it so the tracking
+    // is done by another shard which could be stopped first.
+    auto path = (CACHE_DIR / KEY).lexically_normal().native();
+    auto writer = (owner_shard(KEY) + 1) % ss::smp::count;
+    auto data = create_data_string('a', 1_KiB);
+    sharded_cache
+      .invoke_on(
+        writer,
+        [key = KEY, data](cache& c) {
+            iobuf buf;
+            buf.append(data.data(), data.size());
+            // The put is not awaited, it holds the gate when stop starts
+            ssx::background = ss::do_with(
+              make_iobuf_input_stream(std::move(buf)),
+              [&c, key](ss::input_stream<char>& in) {
+                  return c.put(key, in);
+              });
+        })
+      .get();
+    sharded_cache.stop().get();
+
+    sharded_cache.start(CACHE_DIR, 1_MiB + 500_KiB).get();
+    sharded_cache
+      .invoke_on_all([](cloud_storage::cache& c) { return c.start(); })
+      .get();
+
+    BOOST_CHECK(ss::file_exists(path).get());
+    BOOST_CHECK(is_tracked(KEY));
+    BOOST_CHECK_EQUAL(get_current_cache_size(), 1_KiB);
+}
+
 FIXTURE_TEST(cannot_put_tmp_file, cache_test_fixture) {
     auto data_string1 = create_data_string('a', 1_KiB);
     BOOST_CHECK_THROW(
@@ -190,7 +301,8 @@ FIXTURE_TEST(eviction_cleans_directory, cache_test_fixture) {
 
     ss::sleep(ss::lowres_clock::duration(2s)).get();
 
-    BOOST_CHECK_EQUAL(1_MiB + 1_KiB, sharded_cache.local().get_total_cleaned());
+    BOOST_CHECK_EQUAL(
+      1_MiB + 1_KiB, sharded_cache.local().get_total_cleaned().get());
     BOOST_CHECK(!ss::file_exists((CACHE_DIR / key1).native()).get());
     BOOST_CHECK(
       !ss::file_exists((CACHE_DIR / "a/b/c/first_topic").native()).get());
@@ -198,6 +310,66 @@ FIXTURE_TEST(eviction_cleans_directory, cache_test_fixture) {
     BOOST_CHECK(ss::file_exists(CACHE_DIR.native()).get());
 }
 
+FIXTURE_TEST(chunked_segment_is_fully_evicted, cache_test_fixture) {
+    // A segment hydrated in chunks has no segment file in the cache, only
+    // the chunks and the .tx and .index files.
+    const std::filesystem::path segment{"abc001/test_topic/0-1-v1.log"};
+    const std::filesystem::path chunks_dir{
+      "abc001/test_topic/0-1-v1.log_chunks"};
+    const std::vector<std::filesystem::path> chunks{
+      chunks_dir / "0-1023", chunks_dir / "1024-2047"};
+    const std::vector<std::filesystem::path> sidecars{
+      "abc001/test_topic/0-1-v1.log.tx", "abc001/test_topic/0-1-v1.log.index"};
+    for (const auto& key : chunks) {
+        BOOST_REQUIRE_EQUAL(owner_shard(key), owner_shard(segment));
+        put_into_cache(create_data_string('a', 1_KiB), key);
+    }
+    for (const auto& key : sidecars) {
+        put_into_cache(create_data_string('b', 1_KiB), key);
+    }
+    tests::cooperative_spin_wait_with_timeout(5s, [&] {
+        return std::all_of(
+                 chunks.begin(),
+                 chunks.end(),
+                 [this](const auto& key) { return is_tracked(key); })
+               && std::all_of(
+                 sidecars.begin(),
+                 sidecars.end(),
+                 [this](const auto& key) { return is_tracked(key); });
+    }).get();
+
+    // The chunks are the least recently used files, the .tx and .index
+    // files are evicted together with the last of them.
+    BOOST_CHECK_EQUAL(evict(segment, 2_KiB), 4_KiB);
+    for (const auto& key : chunks) {
+        BOOST_CHECK(!is_tracked(key));
+        BOOST_CHECK(!ss::file_exists((CACHE_DIR / key).native()).get());
+    }
+    for (const auto& key : sidecars) {
+        BOOST_CHECK(!is_tracked(key));
+        BOOST_CHECK(!ss::file_exists((CACHE_DIR / key).native()).get());
+    }
+    BOOST_CHECK(!ss::file_exists((CACHE_DIR / chunks_dir).native()).get());
+    BOOST_CHECK_EQUAL(get_current_cache_size(), 0);
+}
+
+FIXTURE_TEST(invalidate_removes_segment_chunks, cache_test_fixture) {
+    const std::filesystem::path segment{"abc001/test_topic/0-1-v1.log"};
+    const std::filesystem::path chunk{
+      "abc001/test_topic/0-1-v1.log_chunks/0-1023"};
+    put_into_cache(create_data_string('a', 2_KiB), segment);
+    put_into_cache(create_data_string('b', 1_KiB), chunk);
+    tests::cooperative_spin_wait_with_timeout(5s, [&] {
+        return is_tracked(segment) && is_tracked(chunk);
+    }).get();
+
+    sharded_cache.local().invalidate(segment).get();
+
+    BOOST_CHECK(!is_tracked(chunk));
+    BOOST_CHECK(!ss::file_exists((CACHE_DIR / chunk).native()).get());
+    BOOST_CHECK_EQUAL(get_current_cache_size(), 0);
+}
+
 FIXTURE_TEST(invalidate_outside_cache_dir_throws, cache_test_fixture) {
     // make sure the cache directory is empty to get reliable results
     ss::recursive_touch_directory(CACHE_DIR.native()).get();
@@ -321,7 +493,7 @@ SEASTAR_THREAD_TEST_CASE(test_access_time_tracker) {
     };
 
     for (int i = 0; i < 10; i++) {
-        cm.add_timestamp(names[i], timestamps[i]);
+        cm.add(names[i], timestamps[i], 1_KiB);
     }
 
     for (int i = 0; i < 10; i++) {
@@ -360,16 +532,56 @@ SEASTAR_THREAD_TEST_CASE(test_access_time_tracker_serializer) {
     };
 
     for (int i = 0; i < 10; i++) {
-        in.add_timestamp(names[i], timestamps[i]);
+        in.add(names[i], timestamps[i], 1_KiB);
     }
 
     access_time_tracker out;
-    out.from_iobuf(in.to_iobuf());
+    BOOST_REQUIRE(out.from_iobuf(in.to_iobuf(true)));
+    BOOST_REQUIRE_EQUAL(out.size(), 10);
+    BOOST_REQUIRE_EQUAL(out.total_size(), 10_KiB);
 
     for (int i = 0; i < 10; i++) {
         auto ts = out.estimate_timestamp(names[i]);
         BOOST_REQUIRE(ts.value() >= timestamps[i]);
     }
+
+    // Incomplete tracker
+    BOOST_REQUIRE(!out.from_iobuf(in.to_iobuf()));
+    BOOST_REQUIRE_EQUAL(out.size(), 10);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_access_time_tracker_lru) {
+    access_time_tracker cm;
+    for (int i = 0; i < 10; i++) {
+        cm.add(fmt::format("key{}", i), make_ts(1653000000 + i), 1_KiB);
+    }
+    BOOST_REQUIRE_EQUAL(cm.total_size(), 10_KiB);
+
+    // Access moves the entry to the tail of the LRU list
+    cm.add("key0", make_ts(1653000010), 2_KiB);
+    BOOST_REQUIRE_EQUAL(cm.total_size(), 11_KiB);
+    // Rebuilt entries are inserted according to their timestamp
+    cm.add("key3", make_ts(1653000000), 1_KiB);
+
+    auto no_skip = [](std::string_view) { return false; };
+    auto lru = cm.lru_entries(3_KiB, no_skip);
+    BOOST_REQUIRE_EQUAL(lru.size(), 3);
+    BOOST_REQUIRE_EQUAL(lru[0].path, "key3");
+    BOOST_REQUIRE_EQUAL(lru[1].path, "key1");
+    BOOST_REQUIRE_EQUAL(lru[2].path, "key2");
+
+    lru = cm.lru_entries(
+      2_KiB, [](std::string_view key) { return key == "key1"; });
+    BOOST_REQUIRE_EQUAL(lru.size(), 2);
+    BOOST_REQUIRE_EQUAL(lru[0].path, "key3");
+    BOOST_REQUIRE_EQUAL(lru[1].path, "key2");
+
+    BOOST_REQUIRE_EQUAL(cm.remove("key0"), 2_KiB);
+    BOOST_REQUIRE_EQUAL(cm.remove("key0"), 0);
+    BOOST_REQUIRE_EQUAL(cm.total_size(), 9_KiB);
+    lru = cm.lru_entries(100_KiB, no_skip);
+    BOOST_REQUIRE_EQUAL(lru.size(), 9);
+    BOOST_REQUIRE_EQUAL(lru.back().path, "key9");
 }
 
 /**
@@ -24,6 +24,7 @@
 
 #include <chrono>
 #include <filesystem>
+#include <functional>
 
 using namespace std::chrono_literals;
 
@@ -79,6 +80,40 @@ public:
     ss::future<> clean_up_at_start() {
         return sharded_cache.local().clean_up_at_start();
     }
+
+    ss::shard_id owner_shard(const std::filesystem::path& key) {
+        auto path = (CACHE_DIR / key).lexically_normal().native();
+        return cache::owner_shard(path);
+    }
+
+    bool is_tracked(const std::filesystem::path& key) {
+        auto path = (CACHE_DIR / key).lexically_normal().native();
+        return sharded_cache
+          .invoke_on(
+            cache::owner_shard(path),
+            [path](cache& c) {
+                return c._access_time_tracker.estimate_timestamp(path)
+                  .has_value();
+            })
+          .get();
+    }
+
+    /// Evicts the least recently used files of the shard which owns the key
+    uint64_t evict(const std::filesystem::path& key, uint64_t size) {
+        return sharded_cache
+          .invoke_on(
+            owner_shard(key), [size](cache& c) { return c.evict(size); })
+          .get();
+    }
+
+    uint64_t get_current_cache_size() {
+        return sharded_cache
+          .map_reduce0(
+            [](cache& c) { return c._current_cache_size; },
+            uint64_t{0},
+            std::plus<>())
+          .get();
+    }
 };
 
 } // namespace cloud_storage
@@ -0,0 +1,133 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "bytes/iobuf.h"
+#include "bytes/iostream.h"
+#include "cloud_storage/partition_manifest.h"
+#include "model/fundamental.h"
+#include "random/generators.h"
+#include "seastarx.h"
+#include "units.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/testing/perf_tests.hh>
+
+#include <fmt/core.h>
+
+#include <set>
+#include <utility>
+
+using namespace cloud_storage;
+
+static const model::ntp bench_ntp(
+  model::ns("kafka"), model::topic("bench-topic"), model::partition_id(0));
+
+static partition_manifest make_manifest(size_t num_segments) {
+    partition_manifest m(bench_ntp, model::initial_revision_id(1));
+    model::offset base_offset{0};
+    model::timestamp ts{1000000};
+    model::offset_delta delta{0};
+    for (size_t i = 0; i < num_segments; i++) {
+        auto num_records = random_generators::get_int(1000, 10000);
+        auto num_config = random_generators::get_int(0, 3);
+        segment_meta meta{
+          .is_compacted = false,
+          .size_bytes = static_cast<size_t>(
+            random_generators::get_int(100_MiB, 128_MiB)),
+          .base_offset = base_offset,
+          .committed_offset = base_offset + model::offset(num_records - 1),
+          .base_timestamp = ts,
+          .max_timestamp = model::timestamp(ts() + num_records),
+          .delta_offset = delta,
+          .ntp_revision = model::initial_revision_id(1),
+          .archiver_term = model::term_id(1 + i / 1000),
+          .segment_term = model::term_id(1 + i / 1000),
+          .delta_offset_end = delta + model::offset_delta(num_config),
+          .sname_format = segment_name_format::v2,
+        };
+        m.add(meta.base_offset, meta);
+        base_offset = model::next_offset(meta.committed_offset);
+        ts = model::timestamp(meta.max_timestamp() + 1);
+        delta = meta.delta_offset_end;
+    }
+    m.advance_insync_offset(base_offset);
+    return m;
+}
+
+static const partition_manifest manifest_1K = make_manifest(1000);
+static const partition_manifest manifest_100K = make_manifest(100000);
+
+static ss::future<iobuf>
+serialize_manifest(const partition_manifest& m, manifest_format format) {
+    auto [is, size] = co_await m.serialize(format);
+    iobuf buf;
+    auto os = make_iobuf_ref_output_stream(buf);
+    co_await ss::copy(is, os);
+    co_return buf;
+}
+
+static ss::future<>
+encode_test(const partition_manifest& m, manifest_format format) {
+    perf_tests::start_measuring_time();
+    auto buf = co_await serialize_manifest(m, format);
+    perf_tests::stop_measuring_time();
+    perf_tests::do_not_optimize(buf);
+}
+
+static ss::future<>
+decode_test(const partition_manifest& m, manifest_format format) {
+    auto buf = co_await serialize_manifest(m, format);
+    // The object size doesn't depend on the iteration
+    static std::set<std::pair<size_t, manifest_format>> reported;
+    if (reported.emplace(m.size(), format).second) {
+        fmt::print(
+          "{} segments, {} manifest size: {} bytes\n",
+          m.size(),
+          format == manifest_format::json ? "json" : "serde",
+          buf.size_bytes());
+    }
+    partition_manifest restored;
+    perf_tests::start_measuring_time();
+    co_await restored.update(make_iobuf_input_stream(std::move(buf)));
+    perf_tests::stop_measuring_time();
+    perf_tests::do_not_optimize(restored);
+}
+
+PERF_TEST(manifest_bench, json_encode_1K) {
+    return encode_test(manifest_1K, manifest_format::json);
+}
+
+PERF_TEST(manifest_bench, serde_encode_1K) {
+    return encode_test(manifest_1K, manifest_format::serde);
+}
+
+PERF_TEST(manifest_bench, json_decode_1K) {
+    return decode_test(manifest_1K, manifest_format::json);
+}
+
+PERF_TEST(manifest_bench, serde_decode_1K) {
+    return decode_test(manifest_1K, manifest_format::serde);
+}
+
+PERF_TEST(manifest_bench, json_encode_100K) {
+    return encode_test(manifest_100K, manifest_format::json);
+}
+
+PERF_TEST(manifest_bench, serde_encode_100K) {
+    return encode_test(manifest_100K, manifest_format::serde);
+}
+
+PERF_TEST(manifest_bench, json_decode_100K) {
+    return decode_test(manifest_100K, manifest_format::json);
+}
+
+PERF_TEST(manifest_bench, serde_decode_100K) {
+    return decode_test(manifest_100K, manifest_format::serde);
+}
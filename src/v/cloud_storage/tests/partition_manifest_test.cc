@@ -17,6 +17,7 @@
 #include "model/metadata.h"
 #include "model/timestamp.h"
 #include "seastarx.h"
+#include "units.h"
 #include "utils/tracking_allocator.h"
 
 #include <seastar/testing/test_case.hh>
@@ -430,82 +431,53 @@ SEASTAR_THREAD_TEST_CASE(test_segment_contains) {
       m.segment_containing(model::offset{59}) == std::prev(m.end()));
 }
 
-// Test for the partition manifest tracked memory.
-SEASTAR_THREAD_TEST_CASE(test_manifest_mem_tracking) {
+// Test for the memory used by the partition manifest segments.
+SEASTAR_THREAD_TEST_CASE(test_manifest_segments_metadata_bytes) {
     partition_manifest empty_manifest;
     empty_manifest.update(make_manifest_stream(empty_manifest_json)).get0();
-    BOOST_REQUIRE_EQUAL(0, empty_manifest.segments_metadata_bytes());
+    auto empty_size_bytes = empty_manifest.segments_metadata_bytes();
 
-    auto one_segment_manifest = manifest_for({
-      {model::offset(0), kafka::offset(0)},
-      {model::offset(10), kafka::offset(5)},
-    });
-    BOOST_REQUIRE_GT(
-      one_segment_manifest.segments_metadata_bytes(),
-      empty_manifest.segments_metadata_bytes());
-
-    auto two_segment_manifest = manifest_for({
+    auto manifest = manifest_for({
       {model::offset(0), kafka::offset(0)},
       {model::offset(10), kafka::offset(5)},
       {model::offset(20), kafka::offset(10)},
     });
-    auto two_segment_size_bytes
-      = two_segment_manifest.segments_metadata_bytes();
-    BOOST_REQUIRE_GT(
-      two_segment_size_bytes, one_segment_manifest.segments_metadata_bytes());
+    BOOST_REQUIRE_GT(manifest.segments_metadata_bytes(), empty_size_bytes);
 
-    segment_meta another_seg{
-      .is_compacted = false,
-      .size_bytes = 1024,
-      .base_offset = model::offset(20),
-      .committed_offset = model::offset(29),
-      .delta_offset = model::offset_delta(10),
-      .delta_offset_end = model::offset_delta(15),
-    };
-    two_segment_manifest.add(segment_name("20-1-v1.log"), another_seg);
-    auto three_segment_size_bytes
-      = two_segment_manifest.segments_metadata_bytes();
-    BOOST_REQUIRE_GT(three_segment_size_bytes, two_segment_size_bytes);
-
-    // Truncate so we're left with the last two segments. This doesn't
-    // deallocate the memory.
-    two_segment_manifest.truncate(model::offset(10));
-    BOOST_REQUIRE_EQUAL(2, two_segment_manifest.size());
-    BOOST_REQUIRE_EQUAL(
-      three_segment_size_bytes, two_segment_manifest.segments_metadata_bytes());
-
-    // Making a copy will have the copy share the original mem_tracker, meaning
-    // the original manifest's tracked memory increase.
+    // The copy is encoded the same way as the original.
     {
-        auto another_two_segment_manifest = two_segment_manifest;
-        BOOST_REQUIRE_GT(
-          two_segment_manifest.segments_metadata_bytes(),
-          three_segment_size_bytes);
+        auto copy = manifest;
+        BOOST_REQUIRE(copy == manifest);
         BOOST_REQUIRE_EQUAL(
-          two_segment_manifest.segments_metadata_bytes(),
-          another_two_segment_manifest.segments_metadata_bytes());
+          copy.segments_metadata_bytes(), manifest.segments_metadata_bytes());
     }
 
-    // Once we destroy the copy, the allocated memory will go down.
-    BOOST_REQUIRE_EQUAL(
-      three_segment_size_bytes, two_segment_manifest.segments_metadata_bytes());
+    // Removing all segments releases the memory.
+    manifest.truncate(model::offset(20));
+    BOOST_REQUIRE_EQUAL(0, manifest.size());
+    BOOST_REQUIRE_EQUAL(empty_size_bytes, manifest.segments_metadata_bytes());
 
-    // Replace all segments in the manifest with one segment. This will reduce
-    // the underlying map to no segments, and then add the new segment,
-    // resulting in meaningful reduction in memory.
-    segment_meta whole_seg{
-      .is_compacted = false,
-      .size_bytes = 1024,
-      .base_offset = model::offset(10),
-      .committed_offset = model::offset(29),
-      .delta_offset = model::offset_delta(5),
-      .delta_offset_end = model::offset_delta(15),
-    };
-    two_segment_manifest.add(model::offset(0), whole_seg);
-    BOOST_REQUIRE_EQUAL(1, two_segment_manifest.size());
-    BOOST_REQUIRE_EQUAL(
-      one_segment_manifest.segments_metadata_bytes(),
-      two_segment_manifest.segments_metadata_bytes());
+    // Segment metadata is stored in compressed form.
+    constexpr size_t num_segments = 10000;
+    for (size_t i = 0; i < num_segments; i++) {
+        segment_meta seg{
+          .is_compacted = false,
+          .size_bytes = 1024 + i % 7,
+          .base_offset = model::offset(i * 10),
+          .committed_offset = model::offset(i * 10 + 9),
+          .base_timestamp = model::timestamp(1000 + i * 100),
+          .max_timestamp = model::timestamp(1000 + i * 100 + 99),
+          .delta_offset = model::offset_delta(i),
+          .segment_term = model::term_id(1 + i / 1000),
+          .delta_offset_end = model::offset_delta(i + 1),
+          .sname_format = segment_name_format::v2,
+        };
+        manifest.add(seg.base_offset, seg);
+    }
+    BOOST_REQUIRE_EQUAL(num_segments, manifest.size());
+    BOOST_REQUIRE_LT(
+      manifest.segments_metadata_bytes(),
+      num_segments * sizeof(segment_meta) / 4);
 }
 
 SEASTAR_THREAD_TEST_CASE(test_manifest_type) {
@@ -1147,6 +1119,247 @@ SEASTAR_THREAD_TEST_CASE(test_complete_manifest_serialization_roundtrip) {
     }
 }
 
+SEASTAR_THREAD_TEST_CASE(test_binary_manifest_path) {
+    partition_manifest m(manifest_ntp, model::initial_revision_id(0));
+    auto path = m.get_manifest_path(manifest_format::serde);
+    BOOST_REQUIRE_EQUAL(
+      path, "20000000/meta/test-ns/test-topic/42_0/manifest.bin");
+    auto res = get_partition_manifest_path_components(path);
+    BOOST_REQUIRE(res.has_value());
+    BOOST_REQUIRE_EQUAL(res->_part, manifest_ntp.tp.partition);
+}
+
+static iobuf
+serialize_manifest(const partition_manifest& m, manifest_format format) {
+    auto [is, size] = m.serialize(format).get();
+    iobuf buf;
+    auto os = make_iobuf_ref_output_stream(buf);
+    ss::copy(is, os).get();
+    BOOST_REQUIRE_EQUAL(buf.size_bytes(), size);
+    return buf;
+}
+
+SEASTAR_THREAD_TEST_CASE(test_empty_binary_manifest_roundtrip) {
+    partition_manifest m(manifest_ntp, model::initial_revision_id(3));
+    auto buf = serialize_manifest(m, manifest_format::serde);
+
+    partition_manifest restored;
+    restored.update(make_iobuf_input_stream(std::move(buf))).get();
+    BOOST_REQUIRE(restored == m);
+    BOOST_REQUIRE(restored.empty());
+}
+
+SEASTAR_THREAD_TEST_CASE(test_binary_manifest_serialization_roundtrip) {
+    using accessor = cloud_storage::partition_manifest_accessor;
+    partition_manifest m(manifest_ntp, model::initial_revision_id(0));
+    // Not a multiple of the row size to cover the trailing values
+    constexpr int64_t num_segments = 1003;
+    model::offset base_offset{0};
+    for (int64_t i = 0; i < num_segments; i++) {
+        auto committed_offset = base_offset + model::offset(100 + i % 7);
+        partition_manifest::segment_meta meta{
+          .is_compacted = i % 3 == 0,
+          .size_bytes = static_cast<size_t>(1_MiB + i * 17),
+          .base_offset = base_offset,
+          .committed_offset = committed_offset,
+          .base_timestamp = model::timestamp(1000000 + i * 1000),
+          .max_timestamp = model::timestamp(1000000 + i * 1000 + 999),
+          .delta_offset = model::offset_delta(i / 10),
+          .ntp_revision = model::initial_revision_id(0),
+          .archiver_term = model::term_id(1 + i / 100),
+          .segment_term = model::term_id(1 + i / 50),
+          .delta_offset_end = model::offset_delta(i / 10 + 1),
+          .sname_format = i < 500 ? segment_name_format::v1
+                                  : segment_name_format::v2,
+        };
+        m.add(meta.base_offset, meta);
+        base_offset = model::next_offset(committed_offset);
+    }
+    m.advance_start_offset(m.begin()->second.base_offset);
+    m.advance_insync_offset(base_offset);
+    accessor::add_replaced_segment(
+      &m,
+      segment_name("0-1-v1.log"),
+      partition_manifest::segment_meta{
+        .size_bytes = 1024,
+        .base_offset = model::offset(0),
+        .committed_offset = model::offset(50),
+        .ntp_revision = model::initial_revision_id(0),
+        .segment_term = model::term_id(1),
+      });
+
+    auto bin = serialize_manifest(m, manifest_format::serde);
+    auto json = serialize_manifest(m, manifest_format::json);
+    BOOST_REQUIRE_LT(bin.size_bytes(), json.size_bytes());
+
+    partition_manifest from_bin;
+    from_bin.update(make_iobuf_input_stream(std::move(bin))).get();
+    BOOST_REQUIRE(from_bin == m);
+    BOOST_REQUIRE_EQUAL(from_bin.size(), num_segments);
+    BOOST_REQUIRE_EQUAL(from_bin.replaced_segments_count(), 1);
+
+    partition_manifest from_json;
+    from_json.update(make_iobuf_input_stream(std::move(json))).get();
+    BOOST_REQUIRE(from_json == from_bin);
+
+    auto it = m.begin();
+    for (const auto& [key, meta] : from_bin) {
+        require_equal_segment_meta(it->second, meta);
+        ++it;
+    }
+}
+
+static partition_manifest make_spillover_test_manifest(int64_t num_segments) {
+    partition_manifest m(manifest_ntp, model::initial_revision_id(0));
+    model::offset base_offset{0};
+    for (int64_t i = 0; i < num_segments; i++) {
+        auto committed_offset = base_offset + model::offset(99);
+        partition_manifest::segment_meta meta{
+          .size_bytes = 1_MiB,
+          .base_offset = base_offset,
+          .committed_offset = committed_offset,
+          .base_timestamp = model::timestamp(1000 * i),
+          .max_timestamp = model::timestamp(1000 * i + 999),
+          .delta_offset = model::offset_delta(i),
+          .ntp_revision = model::initial_revision_id(0),
+          .archiver_term = model::term_id(1),
+          .segment_term = model::term_id(1),
+          .delta_offset_end = model::offset_delta(i + 1),
+          .sname_format = segment_name_format::v2,
+        };
+        m.add(meta.base_offset, meta);
+        base_offset = model::next_offset(committed_offset);
+    }
+    m.advance_start_offset(model::offset(0));
+    m.advance_insync_offset(base_offset);
+    return m;
+}
+
+SEASTAR_THREAD_TEST_CASE(test_spillover_manifest_path) {
+    partition_manifest m(manifest_ntp, model::initial_revision_id(0));
+    segment_meta meta{
+      .base_offset = model::offset(0),
+      .committed_offset = model::offset(1999),
+    };
+    BOOST_REQUIRE_EQUAL(
+      m.get_spillover_manifest_path(meta),
+      "20000000/meta/test-ns/test-topic/42_0/manifest.bin.0.1999");
+}
+
+SEASTAR_THREAD_TEST_CASE(test_partition_manifest_spillover) {
+    auto m = make_spillover_test_manifest(10);
+
+    auto spillover = m.make_spillover_manifest(4);
+    BOOST_REQUIRE_EQUAL(spillover.size(), 4);
+    auto meta = spillover.make_manifest_metadata();
+    BOOST_REQUIRE_EQUAL(meta.base_offset, model::offset(0));
+    BOOST_REQUIRE_EQUAL(meta.committed_offset, model::offset(399));
+    BOOST_REQUIRE_EQUAL(meta.base_timestamp, model::timestamp(0));
+    BOOST_REQUIRE_EQUAL(meta.max_timestamp, model::timestamp(3999));
+    BOOST_REQUIRE_EQUAL(meta.size_bytes, 4_MiB);
+    BOOST_REQUIRE_EQUAL(meta.delta_offset, model::offset_delta(0));
+    BOOST_REQUIRE_EQUAL(meta.delta_offset_end, model::offset_delta(4));
+
+    BOOST_REQUIRE(m.spillover(meta));
+    BOOST_REQUIRE_EQUAL(m.size(), 6);
+    BOOST_REQUIRE_EQUAL(m.begin()->first, model::offset(400));
+    BOOST_REQUIRE_EQUAL(m.get_start_offset().value(), model::offset(400));
+    BOOST_REQUIRE_EQUAL(m.get_archive_start_offset().value(), model::offset(0));
+    BOOST_REQUIRE_EQUAL(
+      m.get_archive_start_kafka_offset().value(), kafka::offset(0));
+    BOOST_REQUIRE_EQUAL(m.get_spillover_map().size(), 1);
+
+    // The same range can't be moved twice
+    BOOST_REQUIRE(!m.spillover(meta));
+
+    // The range has to end on the segment boundary
+    auto next = m.make_spillover_manifest(2).make_manifest_metadata();
+    auto misaligned = next;
+    misaligned.committed_offset = model::offset(550);
+    BOOST_REQUIRE(!m.spillover(misaligned));
+    BOOST_REQUIRE(m.spillover(next));
+    BOOST_REQUIRE_EQUAL(m.size(), 4);
+    BOOST_REQUIRE_EQUAL(m.get_spillover_map().size(), 2);
+
+    // Lookups
+    BOOST_REQUIRE(!m.find_spillover(model::offset(600)).has_value());
+    BOOST_REQUIRE_EQUAL(
+      m.find_spillover(model::offset(150))->base_offset, model::offset(0));
+    BOOST_REQUIRE_EQUAL(
+      m.find_spillover(model::offset(450))->base_offset, model::offset(400));
+    // Kafka offset 402 maps to the offset 406 (delta 4)
+    BOOST_REQUIRE_EQUAL(
+      m.find_spillover(kafka::offset(402))->base_offset, model::offset(400));
+    BOOST_REQUIRE_EQUAL(
+      m.spillover_timequery(model::timestamp(4500))->base_offset,
+      model::offset(400));
+    BOOST_REQUIRE(!m.spillover_timequery(model::timestamp(9000)).has_value());
+}
+
+SEASTAR_THREAD_TEST_CASE(test_partition_manifest_drop_spillover) {
+    auto m = make_spillover_test_manifest(10);
+    std::vector<segment_meta> metas;
+    std::vector<partition_manifest> spillovers;
+    for (int i = 0; i < 2; i++) {
+        spillovers.push_back(m.make_spillover_manifest(2));
+        metas.push_back(spillovers.back().make_manifest_metadata());
+        BOOST_REQUIRE(m.spillover(metas.back()));
+    }
+    // The size of the spilled data is a part of the cloud log
+    BOOST_REQUIRE_EQUAL(m.cloud_log_size(), 10_MiB);
+
+    auto segments_of = [](const partition_manifest& s) {
+        fragmented_vector<segment_meta> res;
+        for (const auto& it : s) {
+            res.push_back(it.second);
+        }
+        return res;
+    };
+
+    // Only the first spillover manifest can be dropped
+    BOOST_REQUIRE(!m.drop_spillover(metas[1], segments_of(spillovers[1])));
+    BOOST_REQUIRE_EQUAL(m.get_spillover_map().size(), 2);
+
+    BOOST_REQUIRE(m.drop_spillover(metas[0], segments_of(spillovers[0])));
+    BOOST_REQUIRE_EQUAL(m.get_spillover_map().size(), 1);
+    BOOST_REQUIRE_EQUAL(
+      m.get_archive_start_offset().value(), model::offset(200));
+    BOOST_REQUIRE_EQUAL(m.cloud_log_size(), 8_MiB);
+    BOOST_REQUIRE_EQUAL(m.replaced_segments_count(), 2);
+
+    BOOST_REQUIRE(m.drop_spillover(metas[1], segments_of(spillovers[1])));
+    BOOST_REQUIRE(m.get_spillover_map().empty());
+    BOOST_REQUIRE(!m.get_archive_start_offset().has_value());
+    BOOST_REQUIRE_EQUAL(m.cloud_log_size(), 6_MiB);
+    BOOST_REQUIRE_EQUAL(m.replaced_segments_count(), 4);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_binary_manifest_spillover_roundtrip) {
+    auto m = make_spillover_test_manifest(10);
+    for (int i = 0; i < 3; i++) {
+        auto meta = m.make_spillover_manifest(2).make_manifest_metadata();
+        BOOST_REQUIRE(m.spillover(meta));
+    }
+    BOOST_REQUIRE_EQUAL(m.get_spillover_map().size(), 3);
+
+    auto bin = serialize_manifest(m, manifest_format::serde);
+    partition_manifest restored;
+    restored.update(make_iobuf_input_stream(std::move(bin))).get();
+    BOOST_REQUIRE(restored == m);
+    BOOST_REQUIRE_EQUAL(restored.get_spillover_map().size(), 3);
+    BOOST_REQUIRE_EQUAL(
+      restored.get_archive_start_offset().value(), model::offset(0));
+
+    // The spillover manifest itself doesn't reference other manifests
+    auto spillover = m.make_spillover_manifest(2);
+    auto spillover_bin = serialize_manifest(spillover, manifest_format::serde);
+    partition_manifest restored_spillover;
+    restored_spillover.update(make_iobuf_input_stream(std::move(spillover_bin)))
+      .get();
+    BOOST_REQUIRE(restored_spillover == spillover);
+    BOOST_REQUIRE(restored_spillover.get_spillover_map().empty());
+}
+
 SEASTAR_THREAD_TEST_CASE(test_partition_manifest_start_offset_advance) {
     partition_manifest m(manifest_ntp, model::initial_revision_id(0));
     BOOST_REQUIRE(m.get_start_offset() == std::nullopt);
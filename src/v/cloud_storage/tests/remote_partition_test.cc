@@ -1020,6 +1020,53 @@ FIXTURE_TEST(test_remote_partition_scan_full, cloud_storage_fixture) {
     BOOST_REQUIRE_EQUAL(nmatches, coverage.size());
 }
 
+/// This test scans first two segments and checks that the segments which
+/// follow are prefetched
+FIXTURE_TEST(test_remote_partition_segment_prefetch, cloud_storage_fixture) {
+    constexpr int num_segments = 5;
+    constexpr int num_prefetched = 2;
+    config::shard_local_cfg().cloud_storage_segment_prefetch.set_value(
+      static_cast<uint16_t>(num_prefetched));
+    auto reset_cfg = ss::defer([] {
+        config::shard_local_cfg().cloud_storage_segment_prefetch.reset();
+    });
+
+    auto segments = setup_s3_imposter(*this, num_segments, 10);
+    auto base = segments[0].base_offset;
+    auto max = segments[1].max_offset;
+
+    auto conf = get_configuration();
+    static auto bucket = cloud_storage_clients::bucket_name("bucket");
+    remote api(connection_limit(10), conf, config_file);
+    api.start().get();
+    auto action = ss::defer([&api] { api.stop().get(); });
+    auto manifest = hydrate_manifest(api, bucket);
+    auto partition = ss::make_shared<remote_partition>(
+      manifest, api, cache.local(), bucket);
+    auto partition_stop = ss::defer([&partition] { partition->stop().get(); });
+    partition->start().get();
+
+    storage::log_reader_config reader_config(
+      base, max, ss::default_priority_class());
+    auto reader = partition->make_reader(reader_config).get().reader;
+    auto headers_read
+      = reader.consume(test_consumer(), model::no_timeout).get();
+    std::move(reader).release();
+    BOOST_REQUIRE_EQUAL(headers_read.size(), 20);
+
+    auto is_requested = [&](int ix) {
+        auto path = manifest.generate_segment_path(
+          *manifest.get(segments[ix].base_offset));
+        return get_targets().contains(ss::sstring("/" + path().string()));
+    };
+    // The reader moved to the second segment so the segments that follow
+    // it are hydrated in the background
+    tests::cooperative_spin_wait_with_timeout(10s, [&] {
+        return is_requested(2) && is_requested(3);
+    }).get();
+    BOOST_REQUIRE(!is_requested(4));
+}
+
 /// This test scans the entire range of offsets
 FIXTURE_TEST(
   test_remote_partition_scan_full_truncated_segments, cloud_storage_fixture) {
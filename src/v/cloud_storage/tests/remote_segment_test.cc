@@ -15,9 +15,11 @@
 #include "cloud_storage/partition_manifest.h"
 #include "cloud_storage/remote.h"
 #include "cloud_storage/remote_segment.h"
+#include "cloud_storage/remote_segment_index.h"
 #include "cloud_storage/tests/cloud_storage_fixture.h"
 #include "cloud_storage/tests/common_def.h"
 #include "cloud_storage/types.h"
+#include "config/configuration.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "model/timeout_clock.h"
@@ -422,3 +424,89 @@ FIXTURE_TEST(
     reader.stop().get();
     segment->stop().get();
 }
+
+FIXTURE_TEST(test_remote_segment_chunked_reads, cloud_storage_fixture) {
+    set_expectations_and_listen({});
+    auto conf = get_configuration();
+    auto bucket = cloud_storage_clients::bucket_name("bucket");
+    remote remote(connection_limit(10), conf, config_file);
+    auto action = ss::defer([&remote] { remote.stop().get(); });
+    partition_manifest m(manifest_ntp, manifest_revision);
+    auto key = model::offset(1);
+    iobuf segment_bytes = generate_segment(model::offset(1), 100);
+    uint64_t clen = segment_bytes.size_bytes();
+    partition_manifest::segment_meta meta{
+      .is_compacted = false,
+      .size_bytes = clen,
+      .base_offset = model::offset(1),
+      .committed_offset = model::offset(100),
+      .base_timestamp = {},
+      .max_timestamp = {},
+      .delta_offset = model::offset_delta(0),
+      .ntp_revision = manifest_revision};
+    auto path = m.generate_segment_path(meta);
+    auto reset_stream = make_reset_fn(segment_bytes);
+    retry_chain_node fib(never_abort, 1000ms, 200ms);
+    auto upl_res = remote
+                     .upload_segment(
+                       bucket, path, clen, reset_stream, fib, always_continue)
+                     .get();
+    BOOST_REQUIRE(upl_res == upload_result::success);
+
+    // Upload the index the same way the archiver does
+    offset_index ix(
+      model::offset(1),
+      kafka::offset(1),
+      0,
+      remote_segment_sampling_step_bytes);
+    auto builder = make_remote_segment_index_builder(
+      make_iobuf_input_stream(iobuf_deep_copy(segment_bytes)),
+      ix,
+      model::offset_delta(0),
+      remote_segment_sampling_step_bytes);
+    BOOST_REQUIRE(!builder->consume().get().has_error());
+    builder->close().get();
+    auto index_path = generate_remote_index_path(path);
+    upl_res = remote
+                .upload_object(
+                  bucket,
+                  cloud_storage_clients::object_key(index_path()),
+                  ix.to_iobuf(),
+                  fib,
+                  remote::make_segment_tags(manifest_ntp, manifest_revision))
+                .get();
+    BOOST_REQUIRE(upl_res == upload_result::success);
+    m.add(key, meta);
+
+    // The value bypasses the lower bound of the property to get several
+    // chunks out of a small segment
+    config::shard_local_cfg().cloud_storage_cache_chunk_size.set_value(
+      std::make_any<size_t>(clen / 4 + 1));
+    auto reset_chunk_size = ss::defer([] {
+        config::shard_local_cfg().cloud_storage_cache_chunk_size.reset();
+    });
+
+    remote_segment segment(remote, cache.local(), bucket, m, key, fib);
+    auto reader_handle
+      = segment.data_stream(0, ss::default_priority_class()).get();
+    iobuf downloaded;
+    auto rds = make_iobuf_ref_output_stream(downloaded);
+    ss::copy(reader_handle.stream(), rds).get();
+    reader_handle.close().get();
+    segment.stop().get();
+
+    BOOST_REQUIRE_EQUAL(downloaded.size_bytes(), segment_bytes.size_bytes());
+    BOOST_REQUIRE(downloaded == segment_bytes);
+
+    // The segment is never downloaded as a whole
+    const ss::sstring url = "/" + path().string();
+    size_t num_ranged_gets = 0;
+    for (const auto& req : get_requests()) {
+        if (req._method != "GET" || req._url != url) {
+            continue;
+        }
+        BOOST_REQUIRE(!req.get_header("Range").empty());
+        num_ranged_gets++;
+    }
+    BOOST_REQUIRE_EQUAL(num_ranged_gets, 4);
+}
@@ -17,6 +17,7 @@
 #include "cloud_storage/tests/common_def.h"
 #include "cloud_storage/tests/s3_imposter.h"
 #include "cloud_storage/types.h"
+#include "config/configuration.h"
 #include "model/metadata.h"
 #include "seastarx.h"
 #include "storage/directories.h"
@@ -291,6 +292,210 @@ FIXTURE_TEST(test_download_segment, s3_imposter_fixture) { // NOLINT
       subscription.get() == api_activity_notification::segment_upload);
 }
 
+// Use tiny parts to split the payload into several parts which are
+// uploaded concurrently (the bounds are bypassed by set_value)
+static constexpr size_t multipart_part_size = 64;
+
+static auto use_tiny_multipart_parts() {
+    auto& cfg = config::shard_local_cfg();
+    cfg.cloud_storage_multipart_upload_threshold.set_value(
+      std::make_any<std::optional<size_t>>(multipart_part_size));
+    cfg.cloud_storage_multipart_upload_part_size.set_value(
+      std::make_any<size_t>(multipart_part_size));
+    cfg.cloud_storage_multipart_upload_concurrency.set_value(
+      std::make_any<size_t>(2));
+    return ss::defer([&cfg] {
+        cfg.cloud_storage_multipart_upload_threshold.reset();
+        cfg.cloud_storage_multipart_upload_part_size.reset();
+        cfg.cloud_storage_multipart_upload_concurrency.reset();
+    });
+}
+
+static bool is_upload_of_part(const ss::httpd::request& req, uint32_t part) {
+    return req._method == "PUT" && req.query_parameters.contains("partNumber")
+           && req.query_parameters.at("partNumber") == ss::to_sstring(part);
+}
+
+FIXTURE_TEST(test_upload_segment_multipart, s3_imposter_fixture) { // NOLINT
+    set_expectations_and_listen({});
+    auto conf = get_configuration();
+    auto bucket = cloud_storage_clients::bucket_name("bucket");
+    remote remote(connection_limit(10), conf, config_file);
+    auto name = segment_name("1-2-v1.log");
+    auto path = generate_remote_segment_path(
+      manifest_ntp, manifest_revision, name, model::term_id{123});
+    uint64_t clen = manifest_payload.size();
+    auto action = ss::defer([&remote] { remote.stop().get(); });
+
+    static constexpr size_t part_size = multipart_part_size;
+    auto reset_cfg = use_tiny_multipart_parts();
+
+    auto reset_stream =
+      []() -> ss::future<std::unique_ptr<storage::stream_provider>> {
+        iobuf out;
+        out.append(manifest_payload.data(), manifest_payload.size());
+        co_return std::make_unique<storage::segment_reader_handle>(
+          make_iobuf_input_stream(std::move(out)));
+    };
+    retry_chain_node fib(never_abort, 1s, 20ms);
+    auto upl_res = remote
+                     .upload_segment(
+                       bucket, path, clen, reset_stream, fib, always_continue)
+                     .get();
+    BOOST_REQUIRE(upl_res == upload_result::success);
+
+    size_t num_parts = 0;
+    for (const auto& req : get_requests()) {
+        if (req._method == "PUT") {
+            BOOST_REQUIRE(req.query_parameters.contains("uploadId"));
+            BOOST_REQUIRE_LE(req.content.size(), part_size);
+            ++num_parts;
+        }
+    }
+    BOOST_REQUIRE_EQUAL(num_parts, (clen + part_size - 1) / part_size);
+
+    iobuf downloaded;
+    auto try_consume = [&downloaded](uint64_t len, ss::input_stream<char> is) {
+        downloaded.clear();
+        auto rds = make_iobuf_ref_output_stream(downloaded);
+        return ss::do_with(
+          std::move(rds), std::move(is), [&downloaded](auto& rds, auto& is) {
+              return ss::copy(is, rds).then(
+                [&downloaded] { return downloaded.size_bytes(); });
+          });
+    };
+    auto dnl_res
+      = remote.download_segment(bucket, path, try_consume, fib).get();
+
+    BOOST_REQUIRE(dnl_res == download_result::success);
+    iobuf_parser p(std::move(downloaded));
+    auto actual = p.read_string(p.bytes_left());
+    BOOST_REQUIRE(actual == manifest_payload);
+}
+
+FIXTURE_TEST(
+  test_upload_segment_multipart_part_retry, s3_imposter_fixture) { // NOLINT
+    // The first attempt to upload the second part fails with a retryable
+    // error, only this part is sent again.
+    fail_request_if(
+      [attempt = 0](const ss::httpd::request& req) mutable {
+          return is_upload_of_part(req, 2) && attempt++ == 0;
+      },
+      ss::httpd::reply::status_type::service_unavailable);
+    set_expectations_and_listen({});
+    auto conf = get_configuration();
+    auto bucket = cloud_storage_clients::bucket_name("bucket");
+    remote remote(connection_limit(10), conf, config_file);
+    auto name = segment_name("1-2-v1.log");
+    auto path = generate_remote_segment_path(
+      manifest_ntp, manifest_revision, name, model::term_id{123});
+    uint64_t clen = manifest_payload.size();
+    auto action = ss::defer([&remote] { remote.stop().get(); });
+    auto reset_cfg = use_tiny_multipart_parts();
+
+    auto reset_stream =
+      []() -> ss::future<std::unique_ptr<storage::stream_provider>> {
+        iobuf out;
+        out.append(manifest_payload.data(), manifest_payload.size());
+        co_return std::make_unique<storage::segment_reader_handle>(
+          make_iobuf_input_stream(std::move(out)));
+    };
+    retry_chain_node fib(never_abort, 1s, 20ms);
+    auto upl_res = remote
+                     .upload_segment(
+                       bucket, path, clen, reset_stream, fib, always_continue)
+                     .get();
+    BOOST_REQUIRE(upl_res == upload_result::success);
+
+    size_t first_part = 0;
+    size_t second_part = 0;
+    for (const auto& req : get_requests()) {
+        first_part += is_upload_of_part(req, 1) ? 1 : 0;
+        second_part += is_upload_of_part(req, 2) ? 1 : 0;
+    }
+    BOOST_REQUIRE_EQUAL(first_part, 1);
+    BOOST_REQUIRE_EQUAL(second_part, 2);
+
+    iobuf downloaded;
+    auto try_consume = [&downloaded](uint64_t len, ss::input_stream<char> is) {
+        downloaded.clear();
+        auto rds = make_iobuf_ref_output_stream(downloaded);
+        return ss::do_with(
+          std::move(rds), std::move(is), [&downloaded](auto& rds, auto& is) {
+              return ss::copy(is, rds).then(
+                [&downloaded] { return downloaded.size_bytes(); });
+          });
+    };
+    auto dnl_res
+      = remote.download_segment(bucket, path, try_consume, fib).get();
+
+    BOOST_REQUIRE(dnl_res == download_result::success);
+    iobuf_parser p(std::move(downloaded));
+    auto actual = p.read_string(p.bytes_left());
+    BOOST_REQUIRE(actual == manifest_payload);
+}
+
+FIXTURE_TEST(
+  test_upload_segment_multipart_abort, s3_imposter_fixture) { // NOLINT
+    // The second part can't be uploaded, the upload is aborted
+    static const ss::sstring access_denied
+      = R"xml(<?xml version="1.0" encoding="UTF-8"?>
+                <Error>
+                    <Code>AccessDenied</Code>
+                    <Message>Access Denied</Message>
+                    <Resource>resource</Resource>
+                    <RequestId>requestid</RequestId>
+                </Error>)xml";
+    fail_request_if(
+      [](const ss::httpd::request& req) { return is_upload_of_part(req, 2); },
+      ss::httpd::reply::status_type::forbidden,
+      access_denied);
+    set_expectations_and_listen({});
+    auto conf = get_configuration();
+    auto bucket = cloud_storage_clients::bucket_name("bucket");
+    remote remote(connection_limit(10), conf, config_file);
+    auto name = segment_name("1-2-v1.log");
+    auto path = generate_remote_segment_path(
+      manifest_ntp, manifest_revision, name, model::term_id{123});
+    uint64_t clen = manifest_payload.size();
+    auto action = ss::defer([&remote] { remote.stop().get(); });
+    auto reset_cfg = use_tiny_multipart_parts();
+
+    auto reset_stream =
+      []() -> ss::future<std::unique_ptr<storage::stream_provider>> {
+        iobuf out;
+        out.append(manifest_payload.data(), manifest_payload.size());
+        co_return std::make_unique<storage::segment_reader_handle>(
+          make_iobuf_input_stream(std::move(out)));
+    };
+    retry_chain_node fib(never_abort, 1s, 20ms);
+    auto upl_res = remote
+                     .upload_segment(
+                       bucket, path, clen, reset_stream, fib, always_continue)
+                     .get();
+    BOOST_REQUIRE(upl_res == upload_result::failed);
+
+    size_t num_aborts = 0;
+    for (const auto& req : get_requests()) {
+        BOOST_REQUIRE(!(
+          req._method == "POST" && req.query_parameters.contains("uploadId")));
+        if (
+          req._method == "DELETE"
+          && req.query_parameters.contains("uploadId")) {
+            ++num_aborts;
+        }
+    }
+    BOOST_REQUIRE_EQUAL(num_aborts, 1);
+
+    // The segment wasn't created
+    auto try_consume = [](uint64_t, ss::input_stream<char> is) {
+        return is.close().then([] { return uint64_t{0}; });
+    };
+    auto dnl_res
+      = remote.download_segment(bucket, path, try_consume, fib).get();
+    BOOST_REQUIRE(dnl_res == download_result::notfound);
+}
+
 FIXTURE_TEST(test_download_segment_timeout, s3_imposter_fixture) { // NOLINT
     auto conf = get_configuration();
     auto bucket = cloud_storage_clients::bucket_name("bucket");
@@ -14,8 +14,10 @@
 #include "bytes/iobuf_parser.h"
 #include "cloud_storage/types.h"
 #include "cloud_storage_clients/client_probe.h"
+#include "hashing/secure.h"
 #include "seastarx.h"
 #include "test_utils/async.h"
+#include "utils/base64.h"
 
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/iostream.hh>
@@ -29,6 +31,9 @@
 #include <boost/test/tools/old/interface.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <string>
+#include <string_view>
+
 using namespace std::chrono_literals;
 
 inline ss::logger fixt_log("fixture"); // NOLINT
@@ -66,6 +71,16 @@ uint16_t s3_imposter_fixture::httpd_port_number() {
     return unit_test_httpd_port_number();
 }
 
+void s3_imposter_fixture::fail_request_if(
+  request_predicate predicate,
+  ss::httpd::reply::status_type status,
+  ss::sstring body) {
+    _failures.push_back(failure{
+      .predicate = std::move(predicate),
+      .status = status,
+      .body = std::move(body)});
+}
+
 const std::vector<ss::httpd::request>&
 s3_imposter_fixture::get_requests() const {
     return _requests;
@@ -115,6 +130,16 @@ void s3_imposter_fixture::set_routes(
               request._url,
               request.content_length,
               request._method);
+            for (auto& f : fixture._failures) {
+                if (f.predicate(request)) {
+                    vlog(fixt_log.trace, "Fail request {}", request._url);
+                    repl.set_status(f.status);
+                    return f.body;
+                }
+            }
+            if (request.query_parameters.contains("uploadId")) {
+                return handle_multipart(request, repl);
+            }
             if (request._method == "GET") {
                 auto it = expectations.find(request._url);
                 if (it == expectations.end() || !it->second.body.has_value()) {
@@ -122,7 +147,21 @@ void s3_imposter_fixture::set_routes(
                     repl.set_status(reply::status_type::not_found);
                     return error_payload;
                 }
-                return *it->second.body;
+                std::string range{request.get_header("Range")};
+                if (range.empty()) {
+                    return *it->second.body;
+                }
+                // Only the 'bytes=first-last' form is used by the clients
+                static constexpr std::string_view prefix = "bytes=";
+                BOOST_REQUIRE(range.starts_with(prefix));
+                auto sep = range.find('-');
+                uint64_t first = std::stoull(
+                  range.substr(prefix.size(), sep - prefix.size()));
+                uint64_t last = std::stoull(range.substr(sep + 1));
+                const auto& body = *it->second.body;
+                last = std::min<uint64_t>(last, body.size() - 1);
+                repl.set_status(reply::status_type::partial_content);
+                return body.substr(first, last - first + 1);
             } else if (request._method == "PUT") {
                 expectations[request._url] = {
                   .url = request._url, .body = request.content};
@@ -155,6 +194,15 @@ void s3_imposter_fixture::set_routes(
                   "S3 imposter response: {}",
                   repl.response_line());
                 return "";
+            } else if (
+              request._method == "POST"
+              && request.query_parameters.contains("uploads")) {
+                // Create multipart upload
+                auto upload_id = fmt::format("upload-{}", next_upload_id++);
+                multipart_parts[upload_id] = {};
+                return fmt::format(
+                  R"xml(<InitiateMultipartUploadResult><UploadId>{}</UploadId></InitiateMultipartUploadResult>)xml",
+                  upload_id);
             } else if (
               request._method == "POST"
               && request.query_parameters.contains("delete")) {
@@ -164,7 +212,52 @@ void s3_imposter_fixture::set_routes(
             BOOST_FAIL("Unexpected request");
             return "";
         }
+        ss::sstring handle_multipart(const_req request, reply& repl) {
+            auto upload_id = request.query_parameters.at("uploadId");
+            auto it = multipart_parts.find(upload_id);
+            if (it == multipart_parts.end()) {
+                repl.set_status(reply::status_type::not_found);
+                return "";
+            }
+            if (request._method == "PUT") {
+                // Upload part
+                BOOST_REQUIRE_EQUAL(
+                  request.get_header("Content-MD5"), content_md5(request));
+                auto part_number = std::stoul(
+                  request.query_parameters.at("partNumber"));
+                it->second[part_number] = request.content;
+                repl.add_header("ETag", fmt::format("\"{}\"", part_number));
+                return "";
+            } else if (request._method == "POST") {
+                // Complete multipart upload
+                ss::sstring body;
+                for (const auto& [part_number, content] : it->second) {
+                    body += content;
+                }
+                expectations[request._url] = {
+                  .url = request._url, .body = std::move(body)};
+                multipart_parts.erase(it);
+                return R"xml(<CompleteMultipartUploadResult></CompleteMultipartUploadResult>)xml";
+            } else if (request._method == "DELETE") {
+                // Abort multipart upload
+                multipart_parts.erase(it);
+                repl.set_status(reply::status_type::no_content);
+                return "";
+            }
+            BOOST_FAIL("Unexpected request");
+            return "";
+        }
+        static ss::sstring content_md5(const_req request) {
+            auto hash = internal::hash<GNUTLS_DIG_MD5, 16>{};
+            hash.update(std::string_view{request.content});
+            auto digest = hash.reset();
+            return bytes_to_base64(
+              {reinterpret_cast<const uint8_t*>(digest.data()),
+               digest.size()});
+        }
         std::map<ss::sstring, expectation> expectations;
+        std::map<ss::sstring, std::map<uint32_t, ss::sstring>> multipart_parts;
+        size_t next_upload_id{0};
         s3_imposter_fixture& fixture;
     };
     auto hd = ss::make_shared<content_handler>(expectations, *this);
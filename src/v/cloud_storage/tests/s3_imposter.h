@@ -17,6 +17,7 @@
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/sstring.hh>
 #include <seastar/http/httpd.hh>
+#include <seastar/util/noncopyable_function.hh>
 
 #include <chrono>
 #include <exception>
@@ -63,6 +64,17 @@ public:
     void
     set_expectations_and_listen(const std::vector<expectation>& expectations);
 
+    using request_predicate
+      = ss::noncopyable_function<bool(const ss::httpd::request&)>;
+
+    /// Reply with an error to the requests which match the predicate
+    /// instead of handling them. The failed requests are still recorded.
+    /// An empty body makes the client retry the request.
+    void fail_request_if(
+      request_predicate predicate,
+      ss::httpd::reply::status_type status,
+      ss::sstring body = "");
+
     /// Access all http requests ordered by time
     const std::vector<ss::httpd::request>& get_requests() const;
 
@@ -83,6 +95,13 @@ private:
     std::vector<ss::httpd::request> _requests;
     /// Contains all accessed target urls
     std::multimap<ss::sstring, ss::httpd::request> _targets;
+
+    struct failure {
+        request_predicate predicate;
+        ss::httpd::reply::status_type status;
+        ss::sstring body;
+    };
+    std::vector<failure> _failures;
 };
 
 class enable_cloud_storage_fixture {
@@ -765,3 +765,44 @@ BOOST_AUTO_TEST_CASE(test_segment_meta_cstore_prefix_truncate_small) {
 BOOST_AUTO_TEST_CASE(test_segment_meta_cstore_prefix_truncate_full) {
     test_cstore_prefix_truncate(10000, 2000);
 }
+
+BOOST_AUTO_TEST_CASE(test_segment_meta_cstore_insert_out_of_order) {
+    auto manifest = generate_metadata(1000);
+    auto shuffled = manifest;
+    std::random_device rd;
+    std::mt19937 g(rd());
+    std::shuffle(shuffled.begin(), shuffled.end(), g);
+    segment_meta_cstore store;
+    for (const auto& sm : shuffled) {
+        store.insert(sm);
+    }
+
+    BOOST_REQUIRE_EQUAL(store.size(), manifest.size());
+    auto it = store.begin();
+    for (size_t i = 0; i < store.size(); i++) {
+        BOOST_REQUIRE_EQUAL(it.index(), i);
+        BOOST_REQUIRE_EQUAL(*it, manifest[i]);
+        ++it;
+    }
+
+    // Insert with existing base offset replaces the element
+    auto replacement = manifest[manifest.size() / 2];
+    replacement.size_bytes += 1;
+    store.insert(replacement);
+    BOOST_REQUIRE_EQUAL(store.size(), manifest.size());
+    BOOST_REQUIRE_EQUAL(*store.find(replacement.base_offset), replacement);
+}
+
+BOOST_AUTO_TEST_CASE(test_segment_meta_cstore_copy) {
+    segment_meta_cstore store;
+    for (const auto& sm : generate_metadata(1000)) {
+        store.insert(sm);
+    }
+
+    auto copy = store;
+    BOOST_REQUIRE(copy == store);
+    BOOST_REQUIRE(copy.inflated_actual_size() == store.inflated_actual_size());
+
+    auto moved = std::move(copy);
+    BOOST_REQUIRE(moved == store);
+}
@@ -67,6 +67,16 @@ const ss::sstring recovery_results = R"XML(
     </ListBucketResult>
     )XML";
 
+const ss::sstring recovery_results_with_size = R"XML(
+    <ListBucketResult>
+      <IsTruncated>false</IsTruncated>
+      <Contents>
+          <Key>recovery_state/kafka/test/0_9c7bc334-a669-4f04-b8c3-81c30b6ef5bf_1024.true</Key>
+      </Contents>
+      <NextContinuationToken>n</NextContinuationToken>
+    </ListBucketResult>
+    )XML";
+
 const ss::sstring topic_manifest_json = R"JSON({
       "version": 1,
       "namespace": "kafka",
@@ -479,3 +489,36 @@ FIXTURE_TEST(recovery_status_default, fixture) {
     BOOST_REQUIRE_EQUAL(
       state, cloud_storage::topic_recovery_service::state::inactive);
 }
+
+FIXTURE_TEST(recovery_downloaded_bytes, fixture) {
+    ::setenv("__REDPANDA_TOPIC_REC_DL_CHECK_MILLIS", "100", 1);
+    auto unset = ss::defer(
+      [] { ::unsetenv("__REDPANDA_TOPIC_REC_DL_CHECK_MILLIS"); });
+    set_expectations_and_listen(
+      {root_level,
+       meta_level,
+       manifest,
+       {.url = recovery_state.url, .body = recovery_results_with_size}});
+
+    auto& service = app.topic_recovery_service;
+    service.local().start_recovery({});
+    wait_for_topic(tp_ns);
+
+    // The recovery ends once the only partition reports its result
+    tests::cooperative_spin_wait_with_timeout(10s, [&service] {
+        return !service.local().is_active();
+    }).get();
+
+    auto status_log = service.local().recovery_status_log();
+    auto it = std::find_if(
+      status_log.begin(), status_log.end(), [](const auto& status) {
+          return status.state
+                 == cloud_storage::topic_recovery_service::state::
+                   recovering_data;
+      });
+    BOOST_REQUIRE(it != status_log.end());
+    const auto& counts = it->download_counts.at(tp_ns);
+    BOOST_REQUIRE_EQUAL(counts.pending_downloads, 0);
+    BOOST_REQUIRE_EQUAL(counts.successful_downloads, 1);
+    BOOST_REQUIRE_EQUAL(counts.downloaded_bytes, 1024);
+}
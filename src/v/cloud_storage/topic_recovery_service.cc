@@ -84,10 +84,11 @@ std::ostream& operator<<(std::ostream& os, const topic_download_counts& tds) {
     fmt::print(
       os,
       "{{pending_downloads: {}, successful_downloads: {}, failed_downloads: "
-      "{}}}",
+      "{}, downloaded_bytes: {}}}",
       tds.pending_downloads,
       tds.successful_downloads,
-      tds.failed_downloads);
+      tds.failed_downloads,
+      tds.downloaded_bytes);
     return os;
 }
 
@@ -216,6 +217,14 @@ void topic_recovery_service::push_status() {
        .request = _recovery_request});
 }
 
+void topic_recovery_service::update_status() {
+    if (_status_log.empty() || _status_log.back().state != _state) {
+        push_status();
+        return;
+    }
+    _status_log.back().download_counts = _download_counts;
+}
+
 std::vector<topic_recovery_service::recovery_status>
 topic_recovery_service::recovery_status_log() const {
     return {_status_log.begin(), _status_log.end()};
@@ -631,6 +640,7 @@ ss::future<> topic_recovery_service::do_check_for_downloads() {
         } else {
             status.failed_downloads += 1;
         }
+        status.downloaded_bytes += result.downloaded_bytes.value_or(0);
 
         vlog(
           cst_log.debug,
@@ -646,6 +656,10 @@ ss::future<> topic_recovery_service::do_check_for_downloads() {
     if (config::shard_local_cfg().cloud_storage_azure_storage_account()) {
         timeout_multiplier = results.size();
     }
+    if (!results.empty()) {
+        // Make the progress of the recovery visible through the status log
+        update_status();
+    }
     auto clear_fib = make_rtc(_as, _config, timeout_multiplier);
     co_await clear_recovery_results(
       _remote.local(), _config.bucket, clear_fib, std::move(results));
@@ -695,7 +709,7 @@ void topic_recovery_service::populate_recovery_status() {
         auto topic = ntp_cfg->tp_ns.tp;
         auto expected = ntp_cfg->partition_count * ntp_cfg->replication_factor;
         _download_counts.emplace(
-          ntp_cfg->tp_ns, topic_download_counts{expected, 0, 0});
+          ntp_cfg->tp_ns, topic_download_counts{expected, 0, 0, 0});
     }
 }
 
@@ -52,6 +52,8 @@ struct topic_download_counts {
     int pending_downloads;
     int successful_downloads;
     int failed_downloads;
+    /// Total size of the segments downloaded by the finished partitions
+    uint64_t downloaded_bytes{0};
 };
 
 std::ostream& operator<<(std::ostream&, const topic_download_counts&);
@@ -163,6 +165,11 @@ private:
     /// \brief Stores the current state in recovery status log.
     void push_status();
 
+    /// \brief Updates the last entry of the recovery status log with the
+    /// current download counts if the state didn't change. Otherwise, the
+    /// status is pushed to the log.
+    void update_status();
+
 private:
     ss::gate _gate;
     ss::abort_source _as;
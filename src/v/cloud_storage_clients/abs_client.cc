@@ -10,11 +10,13 @@
 
 #include "cloud_storage_clients/abs_client.h"
 
+#include "bytes/iostream.h"
 #include "cloud_storage_clients/abs_error.h"
 #include "cloud_storage_clients/configuration.h"
 #include "cloud_storage_clients/logger.h"
 #include "cloud_storage_clients/util.h"
 #include "cloud_storage_clients/xml_sax_parser.h"
+#include "utils/base64.h"
 #include "vlog.h"
 
 #include <utility>
@@ -97,7 +99,9 @@ abs_request_creator::abs_request_creator(
   , _apply_credentials{std::move(apply_credentials)} {}
 
 result<http::client::request_header> abs_request_creator::make_get_blob_request(
-  bucket_name const& name, object_key const& key) {
+  bucket_name const& name,
+  object_key const& key,
+  std::optional<http_byte_range> byte_range) {
     // GET /{container-id}/{blob-id} HTTP/1.1
     // Host: {storage-account-id}.blob.core.windows.net
     // x-ms-date:{req-datetime in RFC9110} # added by 'add_auth'
@@ -110,6 +114,14 @@ result<http::client::request_header> abs_request_creator::make_get_blob_request(
     header.method(boost::beast::http::verb::get);
     header.target(target);
     header.insert(boost::beast::http::field::host, host);
+    if (byte_range.has_value()) {
+        header.insert(
+          boost::beast::http::field::range,
+          fmt::format(
+            "bytes={}-{}",
+            byte_range.value().first,
+            byte_range.value().second));
+    }
     auto error_code = _apply_credentials->add_auth(header);
     if (error_code) {
         return error_code;
@@ -156,6 +168,82 @@ result<http::client::request_header> abs_request_creator::make_put_blob_request(
     return header;
 }
 
+result<http::client::request_header>
+abs_request_creator::make_put_block_request(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& block_id,
+  size_t payload_size_bytes,
+  const ss::sstring& content_md5) {
+    // PUT /{container-id}/{blob-id}?comp=block&blockid={block-id} HTTP/1.1
+    // Host: {storage-account-id}.blob.core.windows.net
+    // x-ms-date:{req-datetime in RFC9110} # added by 'add_auth'
+    // x-ms-version:"2021-08-06"           # added by 'add_auth'
+    // Authorization:{signature}           # added by 'add_auth'
+    // Content-Length:{payload-size}
+    // Content-MD5:{payload-md5}
+    const auto target = fmt::format(
+      "/{}/{}?comp=block&blockid={}", name(), key().string(), block_id);
+    const boost::beast::string_view host{_ap().data(), _ap().length()};
+
+    http::client::request_header header{};
+    header.method(boost::beast::http::verb::put);
+    header.target(target);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      boost::beast::http::field::content_length,
+      std::to_string(payload_size_bytes));
+    header.insert(
+      boost::beast::http::field::content_md5,
+      {content_md5.data(), content_md5.size()});
+
+    auto error_code = _apply_credentials->add_auth(header);
+    if (error_code) {
+        return error_code;
+    }
+
+    return header;
+}
+
+result<http::client::request_header>
+abs_request_creator::make_put_block_list_request(
+  bucket_name const& name,
+  object_key const& key,
+  size_t payload_size_bytes,
+  const object_tag_formatter& tags) {
+    // PUT /{container-id}/{blob-id}?comp=blocklist HTTP/1.1
+    // Host: {storage-account-id}.blob.core.windows.net
+    // x-ms-date:{req-datetime in RFC9110} # added by 'add_auth'
+    // x-ms-version:"2021-08-06"           # added by 'add_auth'
+    // x-ms-tags:{object-formatter-tags}
+    // Authorization:{signature}           # added by 'add_auth'
+    // Content-Length:{payload-size}
+    // Content-Type: text/plain
+    const auto target = fmt::format(
+      "/{}/{}?comp=blocklist", name(), key().string());
+    const boost::beast::string_view host{_ap().data(), _ap().length()};
+
+    http::client::request_header header{};
+    header.method(boost::beast::http::verb::put);
+    header.target(target);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(boost::beast::http::field::content_type, content_type_value);
+    header.insert(
+      boost::beast::http::field::content_length,
+      std::to_string(payload_size_bytes));
+
+    if (!tags.empty()) {
+        header.insert(tags_name, tags.str());
+    }
+
+    auto error_code = _apply_credentials->add_auth(header);
+    if (error_code) {
+        return error_code;
+    }
+
+    return header;
+}
+
 result<http::client::request_header>
 abs_request_creator::make_get_blob_metadata_request(
   bucket_name const& name, object_key const& key) {
@@ -346,9 +434,10 @@ abs_client::get_object(
   bucket_name const& name,
   object_key const& key,
   ss::lowres_clock::duration timeout,
-  bool expect_no_such_key) {
+  bool expect_no_such_key,
+  std::optional<http_byte_range> byte_range) {
     return send_request(
-      do_get_object(name, key, timeout, expect_no_such_key),
+      do_get_object(name, key, timeout, expect_no_such_key, byte_range),
       name,
       key,
       op_type_tag::download);
@@ -358,8 +447,9 @@ ss::future<http::client::response_stream_ref> abs_client::do_get_object(
   bucket_name const& name,
   object_key const& key,
   ss::lowres_clock::duration timeout,
-  bool expect_no_such_key) {
-    auto header = _requestor.make_get_blob_request(name, key);
+  bool expect_no_such_key,
+  std::optional<http_byte_range> byte_range) {
+    auto header = _requestor.make_get_blob_request(name, key, byte_range);
     if (!header) {
         vlog(
           abs_log.warn, "Failed to create request header: {}", header.error());
@@ -375,7 +465,9 @@ ss::future<http::client::response_stream_ref> abs_client::do_get_object(
     vassert(response_stream->is_header_done(), "Header is not received");
 
     const auto status = response_stream->get_headers().result();
-    if (status != boost::beast::http::status::ok) {
+    if (
+      status != boost::beast::http::status::ok
+      && status != boost::beast::http::status::partial_content) {
         if (
           expect_no_such_key
           && status == boost::beast::http::status::not_found) {
@@ -449,6 +541,153 @@ ss::future<> abs_client::do_put_object(
     }
 }
 
+/// All block ids of a blob must have the same length. The digits only
+/// input makes sure that the base64 encoding doesn't contain characters
+/// that have to be escaped in the query string.
+static ss::sstring make_block_id(uint32_t part_number) {
+    auto id = fmt::format("{:012}", part_number);
+    return bytes_to_base64(
+      {reinterpret_cast<const uint8_t*>(id.data()), id.size()});
+}
+
+ss::future<result<ss::sstring, error_outcome>>
+abs_client::create_multipart_upload(
+  bucket_name const&,
+  object_key const&,
+  const object_tag_formatter&,
+  ss::lowres_clock::duration) {
+    return ss::make_ready_future<result<ss::sstring, error_outcome>>(
+      ss::sstring{});
+}
+
+ss::future<result<abs_client::multipart_part, error_outcome>>
+abs_client::upload_part(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring&,
+  uint32_t part_number,
+  iobuf body,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_put_block(name, key, part_number, std::move(body), timeout),
+      name,
+      key,
+      op_type_tag::upload);
+}
+
+ss::future<abs_client::multipart_part> abs_client::do_put_block(
+  bucket_name const& name,
+  object_key const& key,
+  uint32_t part_number,
+  iobuf body,
+  ss::lowres_clock::duration timeout) {
+    auto block_id = make_block_id(part_number);
+    auto md5 = co_await util::content_md5(body);
+    auto header = _requestor.make_put_block_request(
+      name, key, block_id, body.size_bytes(), md5);
+    if (!header) {
+        vlog(
+          abs_log.warn, "Failed to create request header: {}", header.error());
+        throw std::system_error(header.error());
+    }
+
+    vlog(abs_log.trace, "send https request:\n{}", header.value());
+
+    auto stream = make_iobuf_input_stream(std::move(body));
+    auto response_stream
+      = co_await _client.request(std::move(header.value()), stream, timeout)
+          .finally([&stream] { return stream.close(); });
+
+    co_await response_stream->prefetch_headers();
+    vassert(response_stream->is_header_done(), "Header is not received");
+
+    const auto status = response_stream->get_headers().result();
+    if (status != boost::beast::http::status::created) {
+        auto buf = co_await util::drain_response_stream(
+          std::move(response_stream));
+        throw parse_rest_error_response(status, std::move(buf));
+    }
+
+    co_return multipart_part{
+      .part_number = part_number,
+      .part_id = std::move(block_id),
+    };
+}
+
+ss::future<result<abs_client::no_response, error_outcome>>
+abs_client::complete_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring&,
+  const std::vector<multipart_part>& parts,
+  const object_tag_formatter& tags,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_put_block_list(name, key, parts, tags, timeout).then([] {
+          return ss::make_ready_future<no_response>(no_response{});
+      }),
+      name,
+      key,
+      op_type_tag::upload);
+}
+
+ss::future<> abs_client::do_put_block_list(
+  bucket_name const& name,
+  object_key const& key,
+  const std::vector<multipart_part>& parts,
+  const object_tag_formatter& tags,
+  ss::lowres_clock::duration timeout) {
+    // <?xml version="1.0" encoding="utf-8"?>
+    // <BlockList>
+    //     <Latest>{block-id}</Latest>
+    //     ...
+    // </BlockList>
+    std::string body{R"xml(<?xml version="1.0" encoding="utf-8"?>)xml"};
+    body += "<BlockList>";
+    for (const auto& p : parts) {
+        fmt::format_to(
+          std::back_inserter(body), "<Latest>{}</Latest>", p.part_id);
+    }
+    body += "</BlockList>";
+    iobuf payload;
+    payload.append(body.data(), body.size());
+
+    auto header = _requestor.make_put_block_list_request(
+      name, key, payload.size_bytes(), tags);
+    if (!header) {
+        vlog(
+          abs_log.warn, "Failed to create request header: {}", header.error());
+        throw std::system_error(header.error());
+    }
+
+    vlog(abs_log.trace, "send https request:\n{}", header.value());
+
+    auto stream = make_iobuf_input_stream(std::move(payload));
+    auto response_stream
+      = co_await _client.request(std::move(header.value()), stream, timeout)
+          .finally([&stream] { return stream.close(); });
+
+    co_await response_stream->prefetch_headers();
+    vassert(response_stream->is_header_done(), "Header is not received");
+
+    const auto status = response_stream->get_headers().result();
+    if (status != boost::beast::http::status::created) {
+        auto buf = co_await util::drain_response_stream(
+          std::move(response_stream));
+        throw parse_rest_error_response(status, std::move(buf));
+    }
+}
+
+ss::future<result<abs_client::no_response, error_outcome>>
+abs_client::abort_multipart_upload(
+  bucket_name const&,
+  object_key const&,
+  const ss::sstring&,
+  ss::lowres_clock::duration) {
+    return ss::make_ready_future<result<no_response, error_outcome>>(
+      no_response{});
+}
+
 ss::future<result<abs_client::head_object_result, error_outcome>>
 abs_client::head_object(
   bucket_name const& name,
@@ -41,13 +41,44 @@ public:
       size_t payload_size_bytes,
       const object_tag_formatter& tags);
 
+    /// \brief Create 'Put Block' request header
+    ///
+    /// \param name is container name
+    /// \param key is the blob identifier
+    /// \param block_id is a base64 encoded id of the block
+    /// \param payload_size_bytes is a size of the block in bytes
+    /// \param content_md5 is a base64 encoded MD5 digest of the block
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_put_block_request(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& block_id,
+      size_t payload_size_bytes,
+      const ss::sstring& content_md5);
+
+    /// \brief Create 'Put Block List' request header
+    ///
+    /// \param name is container name
+    /// \param key is the blob identifier
+    /// \param payload_size_bytes is a size of the block list in bytes
+    /// \param tags are formatted tags for 'x-ms-tags'
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_put_block_list_request(
+      bucket_name const& name,
+      object_key const& key,
+      size_t payload_size_bytes,
+      const object_tag_formatter& tags);
+
     /// \brief Create a 'Get Blob' request header
     ///
     /// \param name is container name
     /// \param key is the blob identifier
+    /// \param byte_range is an optional range of bytes to download
     /// \return initialized and signed http header or error
-    result<http::client::request_header>
-    make_get_blob_request(bucket_name const& name, object_key const& key);
+    result<http::client::request_header> make_get_blob_request(
+      bucket_name const& name,
+      object_key const& key,
+      std::optional<http_byte_range> byte_range = std::nullopt);
 
     /// \brief Create a 'Get Blob Metadata' request header
     ///
@@ -114,13 +145,15 @@ public:
     /// \param key is a blob identifier
     /// \param timeout is a timeout of the operation
     /// \param expect_no_such_key log 404 as warning if set to false
+    /// \param byte_range download only the range of bytes of the object
     /// \return future that becomes ready after request was sent
     ss::future<result<http::client::response_stream_ref, error_outcome>>
     get_object(
       bucket_name const& name,
       object_key const& key,
       ss::lowres_clock::duration timeout,
-      bool expect_no_such_key = false) override;
+      bool expect_no_such_key = false,
+      std::optional<http_byte_range> byte_range = std::nullopt) override;
 
     /// Send Get Blob Metadata request.
     /// \param name is a container name
@@ -147,6 +180,41 @@ public:
       const object_tag_formatter& tags,
       ss::lowres_clock::duration timeout) override;
 
+    /// Blocks are staged per blob, so there is no upload to create. The
+    /// returned upload id is always empty.
+    ss::future<result<ss::sstring, error_outcome>> create_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const object_tag_formatter& tags,
+      ss::lowres_clock::duration timeout) override;
+
+    /// Send Put Block request, the id of the block is derived from
+    /// the part number
+    ss::future<result<multipart_part, error_outcome>> upload_part(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      uint32_t part_number,
+      iobuf body,
+      ss::lowres_clock::duration timeout) override;
+
+    /// Send Put Block List request, the tags are applied by this request
+    ss::future<result<no_response, error_outcome>> complete_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      const std::vector<multipart_part>& parts,
+      const object_tag_formatter& tags,
+      ss::lowres_clock::duration timeout) override;
+
+    /// Uncommitted blocks are garbage collected by ABS, so there is
+    /// nothing to abort.
+    ss::future<result<no_response, error_outcome>> abort_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      ss::lowres_clock::duration timeout) override;
+
     /// Send List Blobs request
     /// \param name is a container name
     /// \param prefix is an optional blob prefix to match
@@ -197,7 +265,8 @@ private:
       bucket_name const& name,
       object_key const& key,
       ss::lowres_clock::duration timeout,
-      bool expect_no_such_key = false);
+      bool expect_no_such_key = false,
+      std::optional<http_byte_range> byte_range = std::nullopt);
 
     ss::future<> do_put_object(
       bucket_name const& name,
@@ -207,6 +276,20 @@ private:
       const object_tag_formatter& tags,
       ss::lowres_clock::duration timeout);
 
+    ss::future<multipart_part> do_put_block(
+      bucket_name const& name,
+      object_key const& key,
+      uint32_t part_number,
+      iobuf body,
+      ss::lowres_clock::duration timeout);
+
+    ss::future<> do_put_block_list(
+      bucket_name const& name,
+      object_key const& key,
+      const std::vector<multipart_part>& parts,
+      const object_tag_formatter& tags,
+      ss::lowres_clock::duration timeout);
+
     ss::future<head_object_result> do_head_object(
       bucket_name const& name,
       object_key const& key,
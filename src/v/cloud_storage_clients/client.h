@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "bytes/iobuf.h"
 #include "cloud_storage_clients/configuration.h"
 #include "cloud_storage_clients/types.h"
 #include "http/client.h"
@@ -76,13 +77,15 @@ public:
     /// \param key is an object key
     /// \param timeout is a timeout of the operation
     /// \param expect_no_such_key log missing key events as warnings if false
+    /// \param byte_range download only the range of bytes of the object
     /// \return future that becomes ready after request was sent
     virtual ss::future<result<http::client::response_stream_ref, error_outcome>>
     get_object(
       bucket_name const& name,
       object_key const& key,
       ss::lowres_clock::duration timeout,
-      bool expect_no_such_key = false)
+      bool expect_no_such_key = false,
+      std::optional<http_byte_range> byte_range = std::nullopt)
       = 0;
 
     struct head_object_result {
@@ -120,6 +123,85 @@ public:
       ss::lowres_clock::duration timeout)
       = 0;
 
+    /// Part of the multipart upload
+    struct multipart_part {
+        /// Number of the part, starts from 1
+        uint32_t part_number;
+        /// Id of the uploaded part (ETag in S3, block id in ABS)
+        ss::sstring part_id;
+    };
+
+    /// Start multipart upload of the object
+    ///
+    /// \param name is a bucket name
+    /// \param key is an id of the object
+    /// \param tags is a tag formatter, the tags are either applied by this
+    ///        request or by complete_multipart_upload depending on the
+    ///        backend
+    /// \param timeout is a timeout of the operation
+    /// \return future that returns the id of the new multipart upload
+    virtual ss::future<result<ss::sstring, error_outcome>>
+    create_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const object_tag_formatter& tags,
+      ss::lowres_clock::duration timeout)
+      = 0;
+
+    /// Upload single part of the multipart upload
+    ///
+    /// The payload is checksummed and the checksum is validated by the
+    /// server, so a corrupted part is rejected and can be retried.
+    /// \param name is a bucket name
+    /// \param key is an id of the object
+    /// \param upload_id is an id returned by create_multipart_upload
+    /// \param part_number is a number of the part, starts from 1
+    /// \param body is the content of the part
+    /// \param timeout is a timeout of the operation
+    /// \return future that returns the uploaded part
+    virtual ss::future<result<multipart_part, error_outcome>> upload_part(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      uint32_t part_number,
+      iobuf body,
+      ss::lowres_clock::duration timeout)
+      = 0;
+
+    /// Assemble the object from the uploaded parts
+    ///
+    /// \param name is a bucket name
+    /// \param key is an id of the object
+    /// \param upload_id is an id returned by create_multipart_upload
+    /// \param parts is a list of uploaded parts ordered by part number
+    /// \param tags is a tag formatter
+    /// \param timeout is a timeout of the operation
+    /// \return future that becomes ready when the object is created
+    virtual ss::future<result<no_response, error_outcome>>
+    complete_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      const std::vector<multipart_part>& parts,
+      const object_tag_formatter& tags,
+      ss::lowres_clock::duration timeout)
+      = 0;
+
+    /// Abort multipart upload and discard uploaded parts
+    ///
+    /// \param name is a bucket name
+    /// \param key is an id of the object
+    /// \param upload_id is an id returned by create_multipart_upload
+    /// \param timeout is a timeout of the operation
+    /// \return future that becomes ready when the request is completed
+    virtual ss::future<result<no_response, error_outcome>>
+    abort_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      ss::lowres_clock::duration timeout)
+      = 0;
+
     struct list_bucket_item {
         ss::sstring key;
         std::chrono::system_clock::time_point last_modified;
@@ -11,6 +11,7 @@
 #include "cloud_storage_clients/s3_client.h"
 
 #include "bytes/bytes.h"
+#include "bytes/iostream.h"
 #include "cloud_storage_clients/logger.h"
 #include "cloud_storage_clients/s3_error.h"
 #include "cloud_storage_clients/util.h"
@@ -71,7 +72,9 @@ request_creator::request_creator(
   , _apply_credentials{std::move(apply_credentials)} {}
 
 result<http::client::request_header> request_creator::make_get_object_request(
-  bucket_name const& name, object_key const& key) {
+  bucket_name const& name,
+  object_key const& key,
+  std::optional<http_byte_range> byte_range) {
     http::client::request_header header{};
     // GET /{object-id} HTTP/1.1
     // Host: {bucket-name}.s3.amazonaws.com
@@ -86,6 +89,14 @@ result<http::client::request_header> request_creator::make_get_object_request(
       boost::beast::http::field::user_agent, aws_header_values::user_agent);
     header.insert(boost::beast::http::field::host, host);
     header.insert(boost::beast::http::field::content_length, "0");
+    if (byte_range.has_value()) {
+        header.insert(
+          boost::beast::http::field::range,
+          fmt::format(
+            "bytes={}-{}",
+            byte_range.value().first,
+            byte_range.value().second));
+    }
     auto ec = _apply_credentials->add_auth(header);
     if (ec) {
         return ec;
@@ -335,6 +346,156 @@ request_creator::make_delete_objects_request(
         std::make_unique<delete_objects_body>(std::move(body))}}};
 }
 
+result<http::client::request_header>
+request_creator::make_create_multipart_upload_request(
+  bucket_name const& name,
+  object_key const& key,
+  const object_tag_formatter& tags) {
+    // POST /{object-id}?uploads HTTP/1.1
+    // Host: {bucket-name}.s3.amazonaws.com
+    // x-amz-date:{req-datetime}
+    // x-amz-tagging:{tags}
+    // Authorization:{signature}
+    http::client::request_header header{};
+    auto host = fmt::format("{}.{}", name(), _ap());
+    auto target = fmt::format("/{}?uploads", key().string());
+    header.method(boost::beast::http::verb::post);
+    header.target(target);
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(boost::beast::http::field::content_length, "0");
+    if (!tags.empty()) {
+        header.insert(aws_header_names::x_amz_tagging, tags.str());
+    }
+    auto ec = _apply_credentials->add_auth(header);
+    if (ec) {
+        return ec;
+    }
+    return header;
+}
+
+result<http::client::request_header> request_creator::make_upload_part_request(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  uint32_t part_number,
+  size_t payload_size_bytes,
+  const ss::sstring& content_md5) {
+    // PUT /{object-id}?partNumber={part-number}&uploadId={upload-id} HTTP/1.1
+    // Host: {bucket-name}.s3.amazonaws.com
+    // x-amz-date:{req-datetime}
+    // Authorization:{signature}
+    // Content-Length:{payload-size}
+    // Content-MD5:{payload-md5}
+    http::client::request_header header{};
+    auto host = fmt::format("{}.{}", name(), _ap());
+    auto target = fmt::format(
+      "/{}?partNumber={}&uploadId={}", key().string(), part_number, upload_id);
+    header.method(boost::beast::http::verb::put);
+    header.target(target);
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      boost::beast::http::field::content_type, aws_header_values::text_plain);
+    header.insert(
+      boost::beast::http::field::content_length,
+      std::to_string(payload_size_bytes));
+    header.insert(
+      boost::beast::http::field::content_md5,
+      {content_md5.data(), content_md5.size()});
+    auto ec = _apply_credentials->add_auth(header);
+    if (ec) {
+        return ec;
+    }
+    return header;
+}
+
+result<std::tuple<http::client::request_header, ss::input_stream<char>>>
+request_creator::make_complete_multipart_upload_request(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  const std::vector<client::multipart_part>& parts) {
+    // POST /{object-id}?uploadId={upload-id} HTTP/1.1
+    // Host: {bucket-name}.s3.amazonaws.com
+    // x-amz-date:{req-datetime}
+    // Authorization:{signature}
+    // Content-Length:{body-size}
+    //
+    // <CompleteMultipartUpload>
+    //     <Part>
+    //         <ETag>etag</ETag>
+    //         <PartNumber>1</PartNumber>
+    //     </Part>
+    //     ...
+    // </CompleteMultipartUpload>
+    auto body = [&] {
+        auto complete_tree = boost::property_tree::ptree{};
+        for (auto part_tree = boost::property_tree::ptree{};
+             const auto& p : parts) {
+            part_tree.put("ETag", p.part_id.c_str());
+            part_tree.put("PartNumber", p.part_number);
+            complete_tree.add_child("CompleteMultipartUpload.Part", part_tree);
+        }
+        auto out = std::ostringstream{};
+        boost::property_tree::write_xml(out, complete_tree);
+        if (!out.good()) {
+            throw std::runtime_error(fmt_with_ctx(
+              fmt::format,
+              "failed to create complete multipart upload request, state: {}",
+              out.rdstate()));
+        }
+        return out.str();
+    }();
+
+    http::client::request_header header{};
+    auto host = fmt::format("{}.{}", name(), _ap());
+    auto target = fmt::format("/{}?uploadId={}", key().string(), upload_id);
+    header.method(boost::beast::http::verb::post);
+    header.target(target);
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      boost::beast::http::field::content_length,
+      fmt::format("{}", body.size()));
+    auto ec = _apply_credentials->add_auth(header);
+    if (ec) {
+        return ec;
+    }
+
+    iobuf payload;
+    payload.append(body.data(), body.size());
+    return {std::move(header), make_iobuf_input_stream(std::move(payload))};
+}
+
+result<http::client::request_header>
+request_creator::make_abort_multipart_upload_request(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id) {
+    // DELETE /{object-id}?uploadId={upload-id} HTTP/1.1
+    // Host: {bucket-name}.s3.amazonaws.com
+    // x-amz-date:{req-datetime}
+    // Authorization:{signature}
+    http::client::request_header header{};
+    auto host = fmt::format("{}.{}", name(), _ap());
+    auto target = fmt::format("/{}?uploadId={}", key().string(), upload_id);
+    header.method(boost::beast::http::verb::delete_);
+    header.target(target);
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(boost::beast::http::field::content_length, "0");
+    auto ec = _apply_credentials->add_auth(header);
+    if (ec) {
+        return ec;
+    }
+    return header;
+}
+
 // client //
 
 template<class ResultT = void>
@@ -476,17 +637,21 @@ s3_client::get_object(
   bucket_name const& name,
   object_key const& key,
   ss::lowres_clock::duration timeout,
-  bool expect_no_such_key) {
+  bool expect_no_such_key,
+  std::optional<http_byte_range> byte_range) {
     return send_request(
-      do_get_object(name, key, timeout, expect_no_such_key), name, key);
+      do_get_object(name, key, timeout, expect_no_such_key, byte_range),
+      name,
+      key);
 }
 
 ss::future<http::client::response_stream_ref> s3_client::do_get_object(
   bucket_name const& name,
   object_key const& key,
   ss::lowres_clock::duration timeout,
-  bool expect_no_such_key) {
-    auto header = _requestor.make_get_object_request(name, key);
+  bool expect_no_such_key,
+  std::optional<http_byte_range> byte_range) {
+    auto header = _requestor.make_get_object_request(name, key, byte_range);
     if (!header) {
         return ss::make_exception_future<http::client::response_stream_ref>(
           std::system_error(header.error()));
@@ -501,7 +666,9 @@ ss::future<http::client::response_stream_ref> s3_client::do_get_object(
             [ref = std::move(ref), expect_no_such_key]() mutable {
                 vassert(ref->is_header_done(), "Header is not received");
                 const auto result = ref->get_headers().result();
-                if (result != boost::beast::http::status::ok) {
+                if (
+                  result != boost::beast::http::status::ok
+                  && result != boost::beast::http::status::partial_content) {
                     // Got error response, consume the response body and produce
                     // rest api error
                     if (
@@ -658,6 +825,172 @@ ss::future<> s3_client::do_put_object(
       });
 }
 
+ss::future<result<ss::sstring, error_outcome>>
+s3_client::create_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  const object_tag_formatter& tags,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_create_multipart_upload(name, key, tags, timeout), name, key);
+}
+
+ss::future<ss::sstring> s3_client::do_create_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  const object_tag_formatter& tags,
+  ss::lowres_clock::duration timeout) {
+    auto header = _requestor.make_create_multipart_upload_request(
+      name, key, tags);
+    if (!header) {
+        throw std::system_error(header.error());
+    }
+    vlog(s3_log.trace, "send https request:\n{}", header.value());
+    auto ref = co_await _client.request(std::move(header.value()), timeout);
+    auto buf = co_await util::drain_response_stream(ref);
+    auto status = ref->get_headers().result();
+    if (status != boost::beast::http::status::ok) {
+        vlog(s3_log.warn, "S3 replied with error: {:l}", ref->get_headers());
+        co_return co_await parse_rest_error_response<ss::sstring>(
+          status, std::move(buf));
+    }
+    auto resp = util::iobuf_to_ptree(std::move(buf), s3_log);
+    co_return resp.get<ss::sstring>("InitiateMultipartUploadResult.UploadId");
+}
+
+ss::future<result<s3_client::multipart_part, error_outcome>>
+s3_client::upload_part(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  uint32_t part_number,
+  iobuf body,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_upload_part(
+        name, key, upload_id, part_number, std::move(body), timeout),
+      name,
+      key);
+}
+
+ss::future<s3_client::multipart_part> s3_client::do_upload_part(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  uint32_t part_number,
+  iobuf body,
+  ss::lowres_clock::duration timeout) {
+    auto md5 = co_await util::content_md5(body);
+    auto header = _requestor.make_upload_part_request(
+      name, key, upload_id, part_number, body.size_bytes(), md5);
+    if (!header) {
+        throw std::system_error(header.error());
+    }
+    vlog(s3_log.trace, "send https request:\n{}", header.value());
+    auto stream = make_iobuf_input_stream(std::move(body));
+    auto ref = co_await _client
+                 .request(std::move(header.value()), stream, timeout)
+                 .finally([&stream] { return stream.close(); });
+    auto buf = co_await util::drain_response_stream(ref);
+    auto status = ref->get_headers().result();
+    if (status != boost::beast::http::status::ok) {
+        vlog(s3_log.warn, "S3 replied with error: {:l}", ref->get_headers());
+        co_return co_await parse_rest_error_response<multipart_part>(
+          status, std::move(buf));
+    }
+    auto etag = ref->get_headers().at(boost::beast::http::field::etag);
+    co_return multipart_part{
+      .part_number = part_number,
+      .part_id = ss::sstring(etag.data(), etag.size()),
+    };
+}
+
+ss::future<result<s3_client::no_response, error_outcome>>
+s3_client::complete_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  const std::vector<multipart_part>& parts,
+  const object_tag_formatter&,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_complete_multipart_upload(name, key, upload_id, parts, timeout)
+        .then(
+          []() { return ss::make_ready_future<no_response>(no_response{}); }),
+      name,
+      key);
+}
+
+ss::future<> s3_client::do_complete_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  const std::vector<multipart_part>& parts,
+  ss::lowres_clock::duration timeout) {
+    auto request = _requestor.make_complete_multipart_upload_request(
+      name, key, upload_id, parts);
+    if (!request) {
+        throw std::system_error(request.error());
+    }
+    auto& [header, body] = request.value();
+    vlog(s3_log.trace, "send https request:\n{}", header);
+    auto ref = co_await _client.request(std::move(header), body, timeout)
+                 .finally([&body] { return body.close(); });
+    auto buf = co_await util::drain_response_stream(ref);
+    auto status = ref->get_headers().result();
+    if (status != boost::beast::http::status::ok) {
+        vlog(s3_log.warn, "S3 replied with error: {:l}", ref->get_headers());
+        co_return co_await parse_rest_error_response<>(status, std::move(buf));
+    }
+    // The object is assembled after the response header is sent, so
+    // the failure is reported in the body of the '200 OK' response.
+    auto resp = util::iobuf_to_ptree(buf.copy(), s3_log);
+    if (resp.get_child_optional("Error")) {
+        vlog(
+          s3_log.warn,
+          "S3 failed to complete multipart upload {} of {}",
+          upload_id,
+          key);
+        co_return co_await parse_rest_error_response<>(status, std::move(buf));
+    }
+}
+
+ss::future<result<s3_client::no_response, error_outcome>>
+s3_client::abort_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_abort_multipart_upload(name, key, upload_id, timeout).then([] {
+          return ss::make_ready_future<no_response>(no_response{});
+      }),
+      name,
+      key);
+}
+
+ss::future<> s3_client::do_abort_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  ss::lowres_clock::duration timeout) {
+    auto header = _requestor.make_abort_multipart_upload_request(
+      name, key, upload_id);
+    if (!header) {
+        throw std::system_error(header.error());
+    }
+    vlog(s3_log.trace, "send https request:\n{}", header.value());
+    auto ref = co_await _client.request(std::move(header.value()), timeout);
+    auto buf = co_await util::drain_response_stream(ref);
+    auto status = ref->get_headers().result();
+    if (
+      status != boost::beast::http::status::ok
+      && status != boost::beast::http::status::no_content) {
+        vlog(s3_log.warn, "S3 replied with error: {:l}", ref->get_headers());
+        co_return co_await parse_rest_error_response<>(status, std::move(buf));
+    }
+}
+
 ss::future<result<s3_client::list_bucket_result, error_outcome>>
 s3_client::list_objects(
   const bucket_name& name,
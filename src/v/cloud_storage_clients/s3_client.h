@@ -58,9 +58,12 @@ public:
     ///
     /// \param name is a bucket that has the object
     /// \param key is an object name
+    /// \param byte_range is an optional range of bytes to download
     /// \return initialized and signed http header or error
-    result<http::client::request_header>
-    make_get_object_request(bucket_name const& name, object_key const& key);
+    result<http::client::request_header> make_get_object_request(
+      bucket_name const& name,
+      object_key const& key,
+      std::optional<http_byte_range> byte_range = std::nullopt);
 
     /// \brief Create a 'HeadObject' request header
     ///
@@ -87,6 +90,59 @@ public:
     make_delete_objects_request(
       bucket_name const& name, std::span<const object_key> keys);
 
+    /// \brief Create a 'CreateMultipartUpload' request header
+    ///
+    /// \param name is a bucket that should be used to store new object
+    /// \param key is an object name
+    /// \param tags are tags of the new object
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_create_multipart_upload_request(
+      bucket_name const& name,
+      object_key const& key,
+      const object_tag_formatter& tags);
+
+    /// \brief Create an 'UploadPart' request header
+    ///
+    /// \param name is a bucket name
+    /// \param key is an object name
+    /// \param upload_id is an id of the multipart upload
+    /// \param part_number is a number of the part
+    /// \param payload_size_bytes is a size of the part in bytes
+    /// \param content_md5 is a base64 encoded MD5 digest of the part
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_upload_part_request(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      uint32_t part_number,
+      size_t payload_size_bytes,
+      const ss::sstring& content_md5);
+
+    /// \brief Create a 'CompleteMultipartUpload' request header and body
+    ///
+    /// \param name is a bucket name
+    /// \param key is an object name
+    /// \param upload_id is an id of the multipart upload
+    /// \param parts is a list of uploaded parts
+    /// \return the header and the body as an input_stream
+    result<std::tuple<http::client::request_header, ss::input_stream<char>>>
+    make_complete_multipart_upload_request(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      const std::vector<client::multipart_part>& parts);
+
+    /// \brief Create an 'AbortMultipartUpload' request header
+    ///
+    /// \param name is a bucket name
+    /// \param key is an object name
+    /// \param upload_id is an id of the multipart upload
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_abort_multipart_upload_request(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id);
+
     /// \brief Initialize http header for 'ListObjectsV2' request
     ///
     /// \param name of the bucket
@@ -136,13 +192,15 @@ public:
     /// \param key is an object key
     /// \param timeout is a timeout of the operation
     /// \param expect_no_such_key log 404 as warning if set to false
+    /// \param byte_range download only the range of bytes of the object
     /// \return future that gets ready after request was sent
     ss::future<result<http::client::response_stream_ref, error_outcome>>
     get_object(
       bucket_name const& name,
       object_key const& key,
       ss::lowres_clock::duration timeout,
-      bool expect_no_such_key = false) override;
+      bool expect_no_such_key = false,
+      std::optional<http_byte_range> byte_range = std::nullopt) override;
 
     /// HeadObject request.
     /// \param name is a bucket name
@@ -167,6 +225,36 @@ public:
       const object_tag_formatter& tags,
       ss::lowres_clock::duration timeout) override;
 
+    /// Start multipart upload, the tags are applied by this request
+    ss::future<result<ss::sstring, error_outcome>> create_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const object_tag_formatter& tags,
+      ss::lowres_clock::duration timeout) override;
+
+    /// Upload a part, the response contains an ETag of the part
+    ss::future<result<multipart_part, error_outcome>> upload_part(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      uint32_t part_number,
+      iobuf body,
+      ss::lowres_clock::duration timeout) override;
+
+    ss::future<result<no_response, error_outcome>> complete_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      const std::vector<multipart_part>& parts,
+      const object_tag_formatter& tags,
+      ss::lowres_clock::duration timeout) override;
+
+    ss::future<result<no_response, error_outcome>> abort_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      ss::lowres_clock::duration timeout) override;
+
     ss::future<result<list_bucket_result, error_outcome>> list_objects(
       const bucket_name& name,
       std::optional<object_key> prefix = std::nullopt,
@@ -197,7 +285,8 @@ private:
       bucket_name const& name,
       object_key const& key,
       ss::lowres_clock::duration timeout,
-      bool expect_no_such_key = false);
+      bool expect_no_such_key = false,
+      std::optional<http_byte_range> byte_range = std::nullopt);
 
     ss::future<> do_put_object(
       bucket_name const& name,
@@ -207,6 +296,33 @@ private:
       const object_tag_formatter& tags,
       ss::lowres_clock::duration timeout);
 
+    ss::future<ss::sstring> do_create_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const object_tag_formatter& tags,
+      ss::lowres_clock::duration timeout);
+
+    ss::future<multipart_part> do_upload_part(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      uint32_t part_number,
+      iobuf body,
+      ss::lowres_clock::duration timeout);
+
+    ss::future<> do_complete_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      const std::vector<multipart_part>& parts,
+      ss::lowres_clock::duration timeout);
+
+    ss::future<> do_abort_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      ss::lowres_clock::duration timeout);
+
     ss::future<list_bucket_result> do_list_objects_v2(
       const bucket_name& name,
       std::optional<object_key> prefix = std::nullopt,
@@ -15,8 +15,10 @@
 
 #include <seastar/core/sstring.hh>
 
+#include <cstdint>
 #include <filesystem>
 #include <system_error>
+#include <utility>
 
 namespace cloud_storage_clients {
 
@@ -25,6 +27,8 @@ using object_key = named_type<std::filesystem::path, struct s3_object_key>;
 using endpoint_url = named_type<ss::sstring, struct s3_endpoint_url>;
 using ca_trust_file
   = named_type<std::filesystem::path, struct s3_ca_trust_file>;
+/// Inclusive range of bytes of the object, first and last byte positions
+using http_byte_range = std::pair<uint64_t, uint64_t>;
 
 enum class error_outcome {
     none = 0,
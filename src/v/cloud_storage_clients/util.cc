@@ -11,7 +11,13 @@
 #include "cloud_storage_clients/util.h"
 
 #include "bytes/iobuf_istreambuf.h"
+#include "hashing/secure.h"
 #include "net/connection.h"
+#include "units.h"
+#include "utils/base64.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/coroutine/maybe_yield.hh>
 
 #include <boost/property_tree/xml_parser.hpp>
 
@@ -141,6 +147,23 @@ std::chrono::system_clock::time_point parse_timestamp(std::string_view sv) {
     return std::chrono::system_clock::from_time_t(timegm(&tm));
 }
 
+ss::future<ss::sstring> content_md5(const iobuf& buf) {
+    // The parts are megabytes in size, hashing them at once would stall the
+    // reactor
+    static constexpr size_t chunk_size = 32_KiB;
+    auto hash = internal::hash<GNUTLS_DIG_MD5, 16>{};
+    for (const auto& frag : buf) {
+        for (size_t pos = 0; pos < frag.size(); pos += chunk_size) {
+            auto len = std::min(chunk_size, frag.size() - pos);
+            hash.update(std::string_view{frag.get() + pos, len});
+            co_await ss::coroutine::maybe_yield();
+        }
+    }
+    auto digest = hash.reset();
+    co_return bytes_to_base64(
+      {reinterpret_cast<const uint8_t*>(digest.data()), digest.size()});
+}
+
 void log_buffer_with_rate_limiting(
   const char* msg, iobuf& buf, ss::logger& logger) {
     static constexpr int buffer_size = 0x100;
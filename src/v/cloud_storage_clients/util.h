@@ -42,6 +42,11 @@ boost::property_tree::ptree iobuf_to_ptree(iobuf&& buf, ss::logger& logger);
 /// \brief: Parse timestamp in format that S3 and ABS use
 std::chrono::system_clock::time_point parse_timestamp(std::string_view sv);
 
+/// \brief: Compute base64 encoded MD5 digest of the payload for the
+/// Content-MD5 header, the payload is hashed in chunks with preemption
+/// points in between
+ss::future<ss::sstring> content_md5(const iobuf& buf);
+
 void log_buffer_with_rate_limiting(
   const char* msg, iobuf& buf, ss::logger& logger);
 
@@ -82,9 +82,30 @@ struct archival_metadata_stm::cleanup_metadata_cmd {
     static constexpr cmd_key key{3};
 };
 
+struct archival_metadata_stm::spillover_cmd {
+    static constexpr cmd_key key{4};
+
+    using value = cloud_storage::segment_meta;
+};
+
+struct archival_metadata_stm::drop_spillover
+  : public serde::
+      envelope<drop_spillover, serde::version<0>, serde::compat_version<0>> {
+    /// Metadata of the removed spillover manifest
+    cloud_storage::segment_meta spillover_meta;
+    /// Segments of the removed spillover manifest
+    fragmented_vector<cloud_storage::segment_meta> segments;
+};
+
+struct archival_metadata_stm::drop_spillover_cmd {
+    static constexpr cmd_key key{5};
+
+    using value = drop_spillover;
+};
+
 struct archival_metadata_stm::snapshot
   : public serde::
-      envelope<snapshot, serde::version<1>, serde::compat_version<0>> {
+      envelope<snapshot, serde::version<2>, serde::compat_version<0>> {
     /// List of segments
     fragmented_vector<segment> segments;
     /// List of replaced segments
@@ -101,6 +122,8 @@ struct archival_metadata_stm::snapshot
     /// Last uploaded offset belonging to a compacted segment. If set to
     /// default, the next upload attempt will align this with start of manifest.
     model::offset last_uploaded_compacted_offset;
+    /// Metadata of the spillover manifests (added in snapshot v2)
+    fragmented_vector<cloud_storage::segment_meta> spillover_manifests;
 };
 
 inline archival_metadata_stm::segment
@@ -161,6 +184,26 @@ command_batch_builder::truncate(model::offset start_rp_offset) {
     return *this;
 }
 
+command_batch_builder& command_batch_builder::spillover(
+  const cloud_storage::segment_meta& spillover_meta) {
+    iobuf key_buf = serde::to_iobuf(archival_metadata_stm::spillover_cmd::key);
+    iobuf val_buf = serde::to_iobuf(spillover_meta);
+    _builder.add_raw_kv(std::move(key_buf), std::move(val_buf));
+    return *this;
+}
+
+command_batch_builder& command_batch_builder::drop_spillover(
+  const cloud_storage::segment_meta& spillover_meta,
+  fragmented_vector<cloud_storage::segment_meta> segments) {
+    iobuf key_buf = serde::to_iobuf(
+      archival_metadata_stm::drop_spillover_cmd::key);
+    auto record_val = archival_metadata_stm::drop_spillover_cmd::value{
+      .spillover_meta = spillover_meta, .segments = std::move(segments)};
+    iobuf val_buf = serde::to_iobuf(std::move(record_val));
+    _builder.add_raw_kv(std::move(key_buf), std::move(val_buf));
+    return *this;
+}
+
 ss::future<std::error_code> command_batch_builder::replicate() {
     if (_as) {
         _as->get().check();
@@ -226,6 +269,16 @@ archival_metadata_stm::replaced_segments_from_manifest(
     return segments;
 }
 
+fragmented_vector<cloud_storage::segment_meta>
+archival_metadata_stm::spillover_from_manifest(
+  const cloud_storage::partition_manifest& manifest) {
+    fragmented_vector<cloud_storage::segment_meta> spillover;
+    for (const auto& meta : manifest.get_spillover_map()) {
+        spillover.push_back(meta);
+    }
+    return spillover;
+}
+
 ss::future<> archival_metadata_stm::make_snapshot(
   const storage::ntp_config& ntp_cfg,
   const cloud_storage::partition_manifest& m,
@@ -238,8 +291,8 @@ ss::future<> archival_metadata_stm::make_snapshot(
       .replaced = std::move(replaced),
       .start_offset = m.get_start_offset().value_or(model::offset{}),
       .last_offset = m.get_last_offset(),
-      .last_uploaded_compacted_offset
-      = m.get_last_uploaded_compacted_offset()});
+      .last_uploaded_compacted_offset = m.get_last_uploaded_compacted_offset(),
+      .spillover_manifests = spillover_from_manifest(m)});
 
     auto snapshot = stm_snapshot::create(
       0, insync_offset, std::move(snap_data));
@@ -256,14 +309,11 @@ archival_metadata_stm::archival_metadata_stm(
   raft::consensus* raft,
   cloud_storage::remote& remote,
   features::feature_table& ft,
-  ss::logger& logger,
-  ss::shared_ptr<util::mem_tracker> partition_mem_tracker)
+  ss::logger& logger)
   : cluster::persisted_stm("archival_metadata.snapshot", logger, raft)
   , _logger(logger, ssx::sformat("ntp: {}", raft->ntp()))
   , _manifest(ss::make_shared<cloud_storage::partition_manifest>(
-      raft->ntp(),
-      raft->log_config().get_initial_revision(),
-      partition_mem_tracker))
+      raft->ntp(), raft->log_config().get_initial_revision()))
   , _cloud_storage_api(remote)
   , _feature_table(ft) {}
 
@@ -536,6 +586,14 @@ ss::future<> archival_metadata_stm::apply(model::record_batch b) {
         case cleanup_metadata_cmd::key:
             apply_cleanup_metadata();
             break;
+        case spillover_cmd::key:
+            apply_spillover(
+              serde::from_iobuf<spillover_cmd::value>(r.release_value()));
+            break;
+        case drop_spillover_cmd::key:
+            apply_drop_spillover(
+              serde::from_iobuf<drop_spillover_cmd::value>(r.release_value()));
+            break;
         };
     });
 
@@ -544,7 +602,8 @@ ss::future<> archival_metadata_stm::apply(model::record_batch b) {
 }
 
 ss::future<> archival_metadata_stm::handle_eviction() {
-    cloud_storage::partition_manifest manifest;
+    cloud_storage::partition_manifest manifest(
+      _manifest->get_ntp(), _manifest->get_revision_id());
 
     const auto& bucket_config
       = cloud_storage::configuration::get_bucket_config();
@@ -557,11 +616,8 @@ ss::future<> archival_metadata_stm::handle_eviction() {
     auto backoff = config::shard_local_cfg().cloud_storage_initial_backoff_ms();
 
     retry_chain_node rc_node(_download_as, timeout, backoff);
-    auto res = co_await _cloud_storage_api.download_manifest(
-      cloud_storage_clients::bucket_name{*bucket},
-      _manifest->get_manifest_path(),
-      manifest,
-      rc_node);
+    auto res = co_await _cloud_storage_api.download_partition_manifest(
+      cloud_storage_clients::bucket_name{*bucket}, manifest, rc_node);
 
     if (res == cloud_storage::download_result::notfound) {
         _insync_offset = model::prev_offset(_raft->start_offset());
@@ -624,22 +680,23 @@ ss::future<> archival_metadata_stm::apply_snapshot(
     vlog(
       _logger.info,
       "applying snapshot, so: {}, lo: {}, num segments: {}, num replaced: "
-      "{}",
+      "{}, num spillover manifests: {}",
       snap.start_offset,
       snap.last_offset,
       snap.segments.size(),
-      snap.replaced.size());
+      snap.replaced.size(),
+      snap.spillover_manifests.size());
 
     *_manifest = cloud_storage::partition_manifest(
       _raft->ntp(),
       _raft->log_config().get_initial_revision(),
-      _manifest->mem_tracker(),
       snap.start_offset,
       snap.last_offset,
       snap.last_uploaded_compacted_offset,
       header.offset,
       snap.segments,
-      snap.replaced);
+      snap.replaced,
+      snap.spillover_manifests);
 
     vlog(
       _logger.info,
@@ -664,7 +721,8 @@ ss::future<stm_snapshot> archival_metadata_stm::take_snapshot() {
       .start_offset = _manifest->get_start_offset().value_or(model::offset()),
       .last_offset = _manifest->get_last_offset(),
       .last_uploaded_compacted_offset
-      = _manifest->get_last_uploaded_compacted_offset()});
+      = _manifest->get_last_uploaded_compacted_offset(),
+      .spillover_manifests = spillover_from_manifest(*_manifest)});
 
     vlog(
       _logger.debug,
@@ -762,6 +820,45 @@ void archival_metadata_stm::apply_cleanup_metadata() {
       get_last_offset());
 }
 
+void archival_metadata_stm::apply_spillover(
+  const cloud_storage::segment_meta& spillover_meta) {
+    if (!_manifest->spillover(spillover_meta)) {
+        vlog(
+          _logger.error,
+          "Can't apply spillover manifest with offset range {}-{}",
+          spillover_meta.base_offset,
+          spillover_meta.committed_offset);
+    } else {
+        vlog(
+          _logger.debug,
+          "Spillover command applied, offset range {}-{}, new start offset: "
+          "{}, new last offset: {}",
+          spillover_meta.base_offset,
+          spillover_meta.committed_offset,
+          get_start_offset(),
+          get_last_offset());
+    }
+}
+
+void archival_metadata_stm::apply_drop_spillover(const drop_spillover& ds) {
+    if (!_manifest->drop_spillover(ds.spillover_meta, ds.segments)) {
+        vlog(
+          _logger.error,
+          "Can't remove spillover manifest with offset range {}-{}",
+          ds.spillover_meta.base_offset,
+          ds.spillover_meta.committed_offset);
+    } else {
+        vlog(
+          _logger.debug,
+          "Drop spillover command applied, offset range {}-{}, {} segments "
+          "scheduled for removal, new archive start offset: {}",
+          ds.spillover_meta.base_offset,
+          ds.spillover_meta.committed_offset,
+          ds.segments.size(),
+          _manifest->get_archive_start_offset());
+    }
+}
+
 void archival_metadata_stm::apply_update_start_offset(const start_offset& so) {
     vlog(
       _logger.debug,
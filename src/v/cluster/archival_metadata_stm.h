@@ -56,6 +56,20 @@ public:
     command_batch_builder& cleanup_metadata();
     /// Add truncate command to the batch
     command_batch_builder& truncate(model::offset start_rp_offset);
+    /// Add spillover command to the batch
+    ///
+    /// The command removes the segments moved to the spillover manifest
+    /// described by 'spillover_meta' from the manifest.
+    command_batch_builder&
+    spillover(const cloud_storage::segment_meta& spillover_meta);
+    /// Add drop_spillover command to the batch
+    ///
+    /// The command removes the oldest spillover manifest described by
+    /// 'spillover_meta' from the manifest. Its segments are scheduled
+    /// for garbage collection.
+    command_batch_builder& drop_spillover(
+      const cloud_storage::segment_meta& spillover_meta,
+      fragmented_vector<cloud_storage::segment_meta> segments);
     /// Replicate the configuration batch
     ss::future<std::error_code> replicate();
 
@@ -82,8 +96,7 @@ public:
       raft::consensus*,
       cloud_storage::remote& remote,
       features::feature_table&,
-      ss::logger& logger,
-      ss::shared_ptr<util::mem_tracker> partition_mem_tracker = nullptr);
+      ss::logger& logger);
 
     /// Add segments to the raft log, replicate them and
     /// wait until it is applied to the STM.
@@ -175,6 +188,9 @@ private:
     struct truncate_cmd;
     struct update_start_offset_cmd;
     struct cleanup_metadata_cmd;
+    struct spillover_cmd;
+    struct drop_spillover;
+    struct drop_spillover_cmd;
     struct snapshot;
 
     friend segment segment_from_meta(const cloud_storage::segment_meta& meta);
@@ -185,10 +201,15 @@ private:
     static fragmented_vector<segment> replaced_segments_from_manifest(
       const cloud_storage::partition_manifest& manifest);
 
+    static fragmented_vector<cloud_storage::segment_meta>
+    spillover_from_manifest(const cloud_storage::partition_manifest& manifest);
+
     void apply_add_segment(const segment& segment);
     void apply_truncate(const start_offset& so);
     void apply_cleanup_metadata();
     void apply_update_start_offset(const start_offset& so);
+    void apply_spillover(const cloud_storage::segment_meta& spillover_meta);
+    void apply_drop_spillover(const drop_spillover& ds);
 
 private:
     prefix_logger _logger;
@@ -415,6 +415,9 @@ controller::start(cluster_discovery& discovery, ss::abort_source& shard0_as) {
             config::shard_local_cfg().leader_balancer_node_mute_timeout.bind(),
             config::shard_local_cfg()
               .leader_balancer_transfer_limit_per_shard.bind(),
+            config::shard_local_cfg().leader_balancer_transfer_batch_size.bind(),
+            config::shard_local_cfg()
+              .leader_balancer_transfer_batch_concurrency.bind(),
             _raft0);
           return _leader_balancer->start();
       })
@@ -165,6 +165,16 @@ public:
     void reset_leaders();
     cluster::partition_leaders_table::leaders_info_t get_leaders() const;
 
+    /// Registers a callback for topic table deltas on this shard
+    notification_id_type
+      register_topic_delta_notification(topic_table::delta_cb_t);
+    void unregister_topic_delta_notification(notification_id_type);
+
+    /// Registers a callback for all leadership changes on this shard
+    notification_id_type register_leadership_change_notification(
+      partition_leaders_table::leader_change_cb_t);
+    void unregister_leadership_change_notification(notification_id_type);
+
     void set_is_node_isolated_status(bool is_node_isolated);
     bool is_node_isolated();
 
@@ -45,8 +45,6 @@ partition::partition(
   config::binding<uint64_t> max_concurrent_producer_ids,
   std::optional<cloud_storage_clients::bucket_name> read_replica_bucket)
   : _raft(r)
-  , _partition_mem_tracker(
-      ss::make_shared<util::mem_tracker>(_raft->ntp().path()))
   , _probe(std::make_unique<replicated_partition_probe>(*this))
   , _tx_gateway_frontend(tx_gateway_frontend)
   , _feature_table(feature_table)
@@ -106,8 +104,7 @@ partition::partition(
                 _raft.get(),
                 _cloud_storage_api.local(),
                 _feature_table.local(),
-                clusterlog,
-                _partition_mem_tracker);
+                clusterlog);
             stm_manager->add_stm(_archival_meta_stm);
 
             if (cloud_storage_cache.local_is_initialized()) {
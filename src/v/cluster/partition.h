@@ -237,6 +237,10 @@ public:
         return _read_replica_bucket.value();
     }
 
+    const features::feature_table& feature_table() const {
+        return _feature_table.local();
+    }
+
     /// Return true if shadow indexing is enabled for the partition
     bool is_remote_fetch_enabled() const;
 
@@ -319,7 +323,6 @@ private:
       local_timequery(storage::timequery_config);
 
     consensus_ptr _raft;
-    ss::shared_ptr<util::mem_tracker> _partition_mem_tracker;
     ss::lw_shared_ptr<raft::log_eviction_stm> _log_eviction_stm;
     ss::shared_ptr<cluster::id_allocator_stm> _id_allocator_stm;
     ss::shared_ptr<cluster::rm_stm> _rm_stm;
@@ -17,6 +17,7 @@
 #include "cluster/scheduling/leader_balancer_greedy.h"
 #include "cluster/shard_table.h"
 #include "cluster/topic_table.h"
+#include "config/configuration.h"
 #include "model/namespace.h"
 #include "raft/rpc_client_protocol.h"
 #include "random/generators.h"
@@ -26,9 +27,13 @@
 #include "vlog.h"
 
 #include <seastar/core/coroutine.hh>
+#include <seastar/core/loop.hh>
 #include <seastar/core/sleep.hh>
 #include <seastar/core/timer.hh>
+#include <seastar/core/when_all.hh>
 
+#include <absl/container/flat_hash_map.h>
+#include <boost/range/irange.hpp>
 #include <fmt/core.h>
 #include <fmt/format.h>
 #include <fmt/ostream.h>
@@ -52,12 +57,16 @@ leader_balancer::leader_balancer(
   config::binding<std::chrono::milliseconds>&& mute_timeout,
   config::binding<std::chrono::milliseconds>&& node_mute_timeout,
   config::binding<size_t>&& transfer_limit_per_shard,
+  config::binding<size_t>&& transfer_batch_size,
+  config::binding<size_t>&& transfer_batch_concurrency,
   consensus_ptr raft0)
   : _enabled(std::move(enabled))
   , _idle_timeout(std::move(idle_timeout))
   , _mute_timeout(std::move(mute_timeout))
   , _node_mute_timeout(std::move(node_mute_timeout))
   , _transfer_limit_per_shard(std::move(transfer_limit_per_shard))
+  , _transfer_batch_size(std::move(transfer_batch_size))
+  , _transfer_batch_concurrency(std::move(transfer_batch_concurrency))
   , _topics(topics)
   , _leaders(leaders)
   , _members(members)
@@ -423,9 +432,29 @@ ss::future<ss::stop_iteration> leader_balancer::balance() {
         co_return ss::stop_iteration::yes;
     }
 
+    /*
+     * plan a batch of movements against a single index. each planned movement
+     * is applied to the strategy so that the next one accounts for it, and the
+     * batch is bounded by the remaining in flight budget.
+     */
     auto error = strategy.error();
-    auto transfer = strategy.find_movement(muted_groups());
-    if (!transfer) {
+    auto skip = muted_groups();
+    const size_t batch_size = std::min(
+      _transfer_batch_size(),
+      _transfer_limit_per_shard() * cores.size() - _in_flight_changes.size());
+    std::vector<reassignment> transfers;
+    transfers.reserve(batch_size);
+    while (transfers.size() < batch_size) {
+        auto transfer = strategy.find_movement(skip);
+        if (!transfer) {
+            break;
+        }
+        strategy.apply_movement(*transfer);
+        skip.insert(transfer->group);
+        transfers.push_back(*transfer);
+    }
+
+    if (transfers.empty()) {
         vlog(
           clusterlog.debug,
           "No leadership balance improvements found with total delta {}, "
@@ -439,20 +468,43 @@ ss::future<ss::stop_iteration> leader_balancer::balance() {
         co_return ss::stop_iteration::yes;
     }
 
-    _in_flight_changes[transfer->group] = {
-      *transfer, clock_type::now() + _mute_timeout()};
+    for (const auto& transfer : transfers) {
+        _in_flight_changes[transfer.group] = {
+          transfer, clock_type::now() + _mute_timeout()};
+    }
     check_register_leadership_change_notification();
 
-    auto success = co_await do_transfer(*transfer);
-    if (!success) {
-        vlog(
-          clusterlog.info,
-          "Error transferring leadership group {} from {} to {}",
-          transfer->group,
-          transfer->from,
-          transfer->to);
+    auto results = co_await do_transfers(transfers);
+
+    bool failed = false;
+    for (size_t i = 0; i < transfers.size(); ++i) {
+        const auto& transfer = transfers[i];
+        if (results[i]) {
+            _probe.leader_transfer_succeeded();
+        } else {
+            vlog(
+              clusterlog.info,
+              "Error transferring leadership group {} from {} to {}",
+              transfer.group,
+              transfer.from,
+              transfer.to);
+            _in_flight_changes.erase(transfer.group);
+            _probe.leader_transfer_error();
+            failed = true;
+        }
+
+        /*
+         * if leadership moved, or it timed out we'll mute the group for a
+         * while and continue to avoid any thrashing. notice that we don't
+         * check for movement to the exact shard we requested. this is because
+         * we want to avoid thrashing (we'll still mute the group), but also
+         * because we may have simply been racing with organic leadership
+         * movement.
+         */
+        _muted.try_emplace(transfer.group, clock_type::now() + _mute_timeout());
+    }
 
-        _in_flight_changes.erase(transfer->group);
+    if (failed) {
         check_unregister_leadership_change_notification();
 
         /*
@@ -463,20 +515,9 @@ ss::future<ss::stop_iteration> leader_balancer::balance() {
          * to avoid spinning on sending transfer requests to a failed node. of
          * course failure can happen for other reasons, so don't delay a lot.
          */
-        _probe.leader_transfer_error();
         co_await ss::sleep_abortable(5s, _as.local());
     }
 
-    _probe.leader_transfer_succeeded();
-
-    /*
-     * if leadership moved, or it timed out we'll mute the group for a while and
-     * continue to avoid any thrashing. notice that we don't check for movement
-     * to the exact shard we requested. this is because we want to avoid
-     * thrashing (we'll still mute the group), but also because we may have
-     * simply been racing with organic leadership movement.
-     */
-    _muted.try_emplace(transfer->group, clock_type::now() + _mute_timeout());
     co_return ss::stop_iteration::no;
 }
 
@@ -818,4 +859,144 @@ ss::future<bool> leader_balancer::do_transfer_remote(reassignment transfer) {
     }
 }
 
+ss::future<std::vector<bool>>
+leader_balancer::do_transfers(std::vector<reassignment> transfers) {
+    std::vector<bool> results(transfers.size(), false);
+
+    absl::flat_hash_map<model::node_id, std::vector<size_t>> by_node;
+    for (size_t i = 0; i < transfers.size(); ++i) {
+        by_node[transfers[i].from.node_id].push_back(i);
+    }
+
+    std::vector<ss::future<>> node_transfers;
+    node_transfers.reserve(by_node.size());
+    for (const auto& [node, indices] : by_node) {
+        node_transfers.push_back(
+          do_node_transfers(node, indices, transfers, results));
+    }
+    co_await ss::when_all_succeed(node_transfers.begin(), node_transfers.end());
+
+    co_return results;
+}
+
+ss::future<> leader_balancer::do_node_transfers(
+  model::node_id node,
+  const std::vector<size_t>& indices,
+  const std::vector<reassignment>& transfers,
+  std::vector<bool>& results) {
+    /*
+     * local transfers don't need an rpc, and a single remote transfer uses the
+     * per group request which is understood by every node.
+     */
+    if (node == _raft0->self().id() || indices.size() == 1) {
+        co_await ss::max_concurrent_for_each(
+          indices,
+          _transfer_batch_concurrency(),
+          [this, &transfers, &results](size_t i) {
+              return do_transfer(transfers[i]).then([&results, i](bool ok) {
+                  results[i] = ok;
+              });
+          });
+        co_return;
+    }
+
+    std::vector<reassignment> batch;
+    batch.reserve(indices.size());
+    for (auto i : indices) {
+        batch.push_back(transfers[i]);
+    }
+    auto batch_results = co_await do_transfer_remote_batch(
+      node, std::move(batch));
+    for (size_t i = 0; i < indices.size(); ++i) {
+        results[indices[i]] = batch_results[i];
+    }
+}
+
+ss::future<std::vector<bool>> leader_balancer::do_transfer_remote_batch(
+  model::node_id node, std::vector<reassignment> transfers) {
+    transfer_leadership_batch_request req;
+    req.transfers.reserve(transfers.size());
+    for (const auto& transfer : transfers) {
+        req.transfers.push_back(transfer_leadership_request{
+          .group = transfer.group, .target = transfer.to.node_id});
+    }
+
+    // The receiving node runs the transfers with the same concurrency
+    // limit, give every round of transfers the time of a single transfer.
+    auto concurrency = std::max<size_t>(_transfer_batch_concurrency(), 1);
+    auto rounds = static_cast<int64_t>(
+      (transfers.size() + concurrency - 1) / concurrency);
+    clock_type::duration timeout = leader_transfer_rpc_timeout * rounds;
+
+    vlog(
+      clusterlog.debug,
+      "Transferring leadership for {} groups led by node {}, timeout {}s",
+      transfers.size(),
+      node,
+      std::chrono::duration_cast<std::chrono::seconds>(timeout).count());
+
+    auto res = co_await _connections.local()
+                 .with_node_client<controller_client_protocol>(
+                   _raft0->self().id(),
+                   ss::this_shard_id(),
+                   node,
+                   timeout,
+                   [req = std::move(req), timeout](
+                     controller_client_protocol ccp) mutable {
+                       return ccp.transfer_leadership_batch(
+                         std::move(req), rpc::client_opts(timeout));
+                   });
+
+    std::vector<bool> results(transfers.size(), false);
+
+    if (res.has_error() && res.error() == rpc::errc::method_not_found) {
+        // Batched leadership transfer unavailable: fall back to one request
+        // per group
+        co_await ss::max_concurrent_for_each(
+          boost::irange<size_t>(0, transfers.size()),
+          _transfer_batch_concurrency(),
+          [this, &transfers, &results](size_t i) {
+              return do_transfer_remote(transfers[i])
+                .then([&results, i](bool ok) { results[i] = ok; });
+          });
+        co_return results;
+    } else if (res.has_error()) {
+        vlog(
+          clusterlog.info,
+          "Leadership transfer of {} groups led by node {} failed with "
+          "error: {}",
+          transfers.size(),
+          node,
+          res.error().message());
+        co_return results;
+    }
+
+    absl::flat_hash_map<raft::group_id, raft::errc> outcomes;
+    for (const auto& r : res.value().data.results) {
+        outcomes.emplace(r.group, r.result);
+    }
+    for (size_t i = 0; i < transfers.size(); ++i) {
+        auto it = outcomes.find(transfers[i].group);
+        if (it == outcomes.end()) {
+            vlog(
+              clusterlog.info,
+              "Leadership transfer of group {} failed: no result reported",
+              transfers[i].group);
+        } else if (it->second != raft::errc::success) {
+            vlog(
+              clusterlog.info,
+              "Leadership transfer of group {} failed with error: {}",
+              transfers[i].group,
+              raft::make_error_code(it->second).message());
+        } else {
+            vlog(
+              clusterlog.trace,
+              "Leadership transfer of group {} succeeded",
+              transfers[i].group);
+            results[i] = true;
+        }
+    }
+    co_return results;
+}
+
 } // namespace cluster
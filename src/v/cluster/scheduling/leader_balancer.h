@@ -83,6 +83,8 @@ public:
       config::binding<std::chrono::milliseconds>&&,
       config::binding<std::chrono::milliseconds>&&,
       config::binding<size_t>&&,
+      config::binding<size_t>&&,
+      config::binding<size_t>&&,
       consensus_ptr);
 
     ss::future<> start();
@@ -101,6 +103,20 @@ private:
     ss::future<bool> do_transfer_remote(reassignment);
     ss::future<bool> do_transfer_remote_legacy(reassignment);
 
+    /*
+     * Execute a set of transfers. Transfers led by the same remote node are
+     * sent in a single batched request. Returns a success flag per transfer,
+     * in the order of the input.
+     */
+    ss::future<std::vector<bool>> do_transfers(std::vector<reassignment>);
+    ss::future<> do_node_transfers(
+      model::node_id,
+      const std::vector<size_t>&,
+      const std::vector<reassignment>&,
+      std::vector<bool>&);
+    ss::future<std::vector<bool>>
+      do_transfer_remote_batch(model::node_id, std::vector<reassignment>);
+
     void on_enable_changed();
 
     void check_if_controller_leader(
@@ -163,6 +179,18 @@ private:
      */
     config::binding<size_t> _transfer_limit_per_shard;
 
+    /*
+     * maximum number of transfers planned in a single balancer tick. the
+     * transfers are dispatched together, one request per source node.
+     */
+    config::binding<size_t> _transfer_batch_size;
+
+    /*
+     * maximum number of transfers of a batch executed concurrently. the
+     * receiving node applies the same limit to a batched request.
+     */
+    config::binding<size_t> _transfer_batch_concurrency;
+
     struct last_known_leader {
         model::broker_shard shard;
         clock_type::time_point expires;
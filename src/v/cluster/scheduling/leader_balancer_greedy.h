@@ -149,6 +149,21 @@ public:
         return std::nullopt;
     }
 
+    /*
+     * Update the index as if the reassignment had completed. This allows
+     * several movements to be planned against a single index.
+     */
+    void apply_movement(const reassignment& r) final {
+        auto& from_groups = _cores.at(r.from);
+        auto it = from_groups.find(r.group);
+        if (it == from_groups.end()) {
+            return;
+        }
+        _cores[r.to][r.group] = std::move(it->second);
+        from_groups.erase(it);
+        rebuild_load_index();
+    }
+
     std::vector<shard_load> stats() const final {
         std::vector<shard_load> ret;
         ret.reserve(_load.size());
@@ -197,6 +212,7 @@ private:
      */
     void rebuild_load_index() {
         _load.clear();
+        _load_map.clear();
         _load.reserve(_cores.size());
         _load_map.reserve(_cores.size());
         for (auto it = _cores.cbegin(); it != _cores.cend(); ++it) {
@@ -68,6 +68,11 @@ public:
     virtual std::optional<reassignment>
     find_movement(const absl::flat_hash_set<raft::group_id>& skip) const = 0;
 
+    /*
+     * Update the strategy state as if the reassignment had completed.
+     */
+    virtual void apply_movement(const reassignment&) = 0;
+
     /*
      * Return current strategy stats.
      */
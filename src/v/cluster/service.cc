@@ -32,8 +32,11 @@
 
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/future.hh>
+#include <seastar/core/loop.hh>
 #include <seastar/core/sharded.hh>
 
+#include <boost/range/irange.hpp>
+
 namespace cluster {
 service::service(
   ss::scheduling_group sg,
@@ -64,7 +67,10 @@ service::service(
   , _feature_table(feature_table)
   , _hm_frontend(hm_frontend)
   , _conn_cache(conn_cache)
-  , _partition_manager(partition_manager) {}
+  , _partition_manager(partition_manager)
+  , _transfer_batch_concurrency(
+      config::shard_local_cfg()
+        .leader_balancer_transfer_batch_concurrency.bind()) {}
 
 ss::future<join_reply>
 service::join(join_request&& req, rpc::streaming_context& context) {
@@ -650,29 +656,54 @@ service::do_cancel_node_partition_movements(
       .partition_results = std::move(ret.value())};
 }
 
-ss::future<transfer_leadership_reply> service::transfer_leadership(
-  transfer_leadership_request&& r, rpc::streaming_context&) {
+ss::future<raft::errc>
+service::do_transfer_leadership(transfer_leadership_request r) {
     auto shard_id = _api.local().shard_for(r.group);
     if (!shard_id.has_value()) {
-        co_return transfer_leadership_reply{
-          .success = false, .result = raft::errc::group_not_exists};
-    } else {
-        auto errc = co_await _partition_manager.invoke_on(
-          shard_id.value(),
-          [r = std::move(r)](
-            partition_manager& pm) -> ss::future<std::error_code> {
-              auto partition_ptr = pm.partition_for(r.group);
-              if (!partition_ptr) {
-                  return ss::make_ready_future<std::error_code>(
-                    raft::errc::group_not_exists);
-              } else {
-                  return partition_ptr->transfer_leadership(r.target);
-              }
-          });
-        co_return transfer_leadership_reply{
-          .success = (errc == raft::make_error_code(raft::errc::success)),
-          .result = raft::errc{int16_t(errc.value())}};
+        co_return raft::errc::group_not_exists;
+    }
+    auto errc = co_await _partition_manager.invoke_on(
+      shard_id.value(),
+      [r = std::move(r)](
+        partition_manager& pm) -> ss::future<std::error_code> {
+          auto partition_ptr = pm.partition_for(r.group);
+          if (!partition_ptr) {
+              return ss::make_ready_future<std::error_code>(
+                raft::errc::group_not_exists);
+          } else {
+              return partition_ptr->transfer_leadership(r.target);
+          }
+      });
+    co_return raft::errc{int16_t(errc.value())};
+}
+
+ss::future<transfer_leadership_reply> service::transfer_leadership(
+  transfer_leadership_request&& r, rpc::streaming_context&) {
+    auto result = co_await do_transfer_leadership(std::move(r));
+    co_return transfer_leadership_reply{
+      .success = (result == raft::errc::success), .result = result};
+}
+
+ss::future<transfer_leadership_batch_reply> service::transfer_leadership_batch(
+  transfer_leadership_batch_request&& r, rpc::streaming_context&) {
+    transfer_leadership_batch_reply reply;
+    reply.results.resize(r.transfers.size());
+    for (size_t i = 0; i < r.transfers.size(); ++i) {
+        reply.results[i].group = r.transfers[i].group;
     }
+
+    auto indices = boost::irange<size_t>(0, r.transfers.size());
+    co_await ss::max_concurrent_for_each(
+      indices,
+      _transfer_batch_concurrency(),
+      [this, &r, &reply](size_t i) {
+          return do_transfer_leadership(r.transfers[i])
+            .then([&reply, i](raft::errc result) {
+                reply.results[i].result = result;
+            });
+      });
+
+    co_return reply;
 }
 
 } // namespace cluster
@@ -13,6 +13,7 @@
 #include "cluster/controller_service.h"
 #include "cluster/fwd.h"
 #include "cluster/types.h"
+#include "config/property.h"
 #include "features/feature_table.h"
 #include "rpc/fwd.h"
 #include "rpc/types.h"
@@ -115,6 +116,9 @@ public:
     ss::future<transfer_leadership_reply> transfer_leadership(
       transfer_leadership_request&& r, rpc::streaming_context&) final;
 
+    ss::future<transfer_leadership_batch_reply> transfer_leadership_batch(
+      transfer_leadership_batch_request&& r, rpc::streaming_context&) final;
+
 private:
     static constexpr auto default_move_interruption_timeout = 10s;
     std::
@@ -124,6 +128,8 @@ private:
     ss::future<finish_partition_update_reply>
     do_finish_partition_update(finish_partition_update_request&&);
 
+    ss::future<raft::errc> do_transfer_leadership(transfer_leadership_request);
+
     ss::future<update_topic_properties_reply>
     do_update_topic_properties(update_topic_properties_request&&);
 
@@ -162,5 +168,6 @@ private:
     ss::sharded<health_monitor_frontend>& _hm_frontend;
     ss::sharded<rpc::connection_cache>& _conn_cache;
     ss::sharded<partition_manager>& _partition_manager;
+    config::binding<size_t> _transfer_batch_concurrency;
 };
 } // namespace cluster
@@ -361,3 +361,31 @@ BOOST_AUTO_TEST_CASE(greedy_skip) {
       raft::group_id(5), raft::group_id(6)};
     BOOST_REQUIRE(no_movement(spec, {0}, skip));
 }
+
+BOOST_AUTO_TEST_CASE(greedy_apply_movement) {
+    // planning several movements against one index converges to balance
+    auto [index, balancer] = from_spec({
+      // clang-format off
+      {{1, 2, 3, 4}, {-1}},
+      {{5, 6},       {-1}},
+      {{},           {-1}},
+      // clang-format on
+    });
+
+    std::vector<reassignment> planned;
+    absl::flat_hash_set<raft::group_id> skip;
+    while (auto movement = balancer.find_movement(skip)) {
+        check_valid(index, *movement);
+        balancer.apply_movement(*movement);
+        skip.insert(movement->group);
+        planned.push_back(*movement);
+    }
+
+    BOOST_REQUIRE_EQUAL(planned.size(), 2);
+    BOOST_REQUIRE(planned[0] == re(1, 0, 2));
+    BOOST_REQUIRE(planned[1] == re(2, 0, 2));
+    BOOST_REQUIRE_EQUAL(balancer.error(), 0);
+    for (const auto& load : balancer.stats()) {
+        BOOST_REQUIRE_EQUAL(load.leaders, 2);
+    }
+}
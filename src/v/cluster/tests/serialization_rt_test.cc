@@ -1884,6 +1884,31 @@ SEASTAR_THREAD_TEST_CASE(serde_reflection_roundtrip) {
         };
         roundtrip_test(data);
     }
+    {
+        cluster::transfer_leadership_batch_request data;
+        for (auto i = 0, mi = random_generators::get_int(10); i < mi; ++i) {
+            cluster::transfer_leadership_request transfer{
+              .group = tests::random_named_int<raft::group_id>(),
+            };
+            if (tests::random_bool()) {
+                transfer.target = tests::random_named_int<model::node_id>();
+            }
+            data.transfers.push_back(transfer);
+        }
+        serde_roundtrip_test(data);
+    }
+    {
+        cluster::transfer_leadership_batch_reply data;
+        for (auto i = 0, mi = random_generators::get_int(10); i < mi; ++i) {
+            data.results.push_back(cluster::transfer_leadership_result{
+              .group = tests::random_named_int<raft::group_id>(),
+              .result = tests::random_bool()
+                          ? raft::errc::success
+                          : raft::errc::not_leader,
+            });
+        }
+        serde_roundtrip_test(data);
+    }
     {
         raft::vnode data{
           tests::random_named_int<model::node_id>(),
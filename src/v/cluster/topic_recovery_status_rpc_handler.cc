@@ -35,7 +35,8 @@ status_response map_log_to_response(
               {.tp_ns = tp_ns,
                .pending_downloads = count.pending_downloads,
                .successful_downloads = count.successful_downloads,
-               .failed_downloads = count.failed_downloads});
+               .failed_downloads = count.failed_downloads,
+               .downloaded_bytes = count.downloaded_bytes});
         }
 
         recovery_request_params request_params;
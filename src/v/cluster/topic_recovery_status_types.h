@@ -27,15 +27,20 @@ struct status_request
 
 struct topic_downloads
   : serde::
-      envelope<topic_downloads, serde::version<0>, serde::compat_version<0>> {
+      envelope<topic_downloads, serde::version<1>, serde::compat_version<0>> {
     model::topic_namespace tp_ns;
     int pending_downloads;
     int successful_downloads;
     int failed_downloads;
+    uint64_t downloaded_bytes{0};
 
     auto serde_fields() {
         return std::tie(
-          tp_ns, pending_downloads, successful_downloads, failed_downloads);
+          tp_ns,
+          pending_downloads,
+          successful_downloads,
+          failed_downloads,
+          downloaded_bytes);
     }
 
     friend bool operator==(const topic_downloads&, const topic_downloads&)
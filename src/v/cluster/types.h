@@ -3026,6 +3026,77 @@ struct revert_cancel_partition_move_reply
       = default;
 };
 
+/*
+ * Bulk leadership transfer. The controller leader sends a single request
+ * carrying all transfers for groups led by the receiving node. Transfers are
+ * executed concurrently and the reply carries one result per group.
+ */
+struct transfer_leadership_batch_request
+  : serde::envelope<
+      transfer_leadership_batch_request,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    using rpc_adl_exempt = std::true_type;
+    std::vector<transfer_leadership_request> transfers;
+
+    auto serde_fields() { return std::tie(transfers); }
+
+    friend bool operator==(
+      const transfer_leadership_batch_request&,
+      const transfer_leadership_batch_request&)
+      = default;
+
+    friend std::ostream&
+    operator<<(std::ostream& o, const transfer_leadership_batch_request& r) {
+        fmt::print(o, "{{transfers: {}}}", r.transfers.size());
+        return o;
+    }
+};
+
+struct transfer_leadership_result
+  : serde::envelope<
+      transfer_leadership_result,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    using rpc_adl_exempt = std::true_type;
+    raft::group_id group;
+    raft::errc result;
+
+    auto serde_fields() { return std::tie(group, result); }
+
+    friend bool operator==(
+      const transfer_leadership_result&, const transfer_leadership_result&)
+      = default;
+
+    friend std::ostream&
+    operator<<(std::ostream& o, const transfer_leadership_result& r) {
+        fmt::print(o, "{{group: {}, result: {}}}", r.group, r.result);
+        return o;
+    }
+};
+
+struct transfer_leadership_batch_reply
+  : serde::envelope<
+      transfer_leadership_batch_reply,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    using rpc_adl_exempt = std::true_type;
+    std::vector<transfer_leadership_result> results;
+
+    auto serde_fields() { return std::tie(results); }
+
+    friend bool operator==(
+      const transfer_leadership_batch_reply&,
+      const transfer_leadership_batch_reply&)
+      = default;
+
+    friend std::ostream&
+    operator<<(std::ostream& o, const transfer_leadership_batch_reply& r) {
+        fmt::print(o, "{{results: {}}}", r.results);
+        return o;
+    }
+};
+
 /**
  * Broker state transitions are coordinated centrally as opposite to
  * configuration which change is requested by the described node itself. Broker
@@ -0,0 +1,151 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "compression/async_stream_lz4.h"
+
+#include "compression/internal/lz4_frame_compressor.h"
+#include "static_deleter_fn.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/temporary_buffer.hh>
+#include <seastar/coroutine/maybe_yield.hh>
+
+#include <fmt/format.h>
+#include <lz4frame.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace compression {
+
+[[noreturn]] [[gnu::cold]] static void
+throw_lz4_error(const char* fmt, LZ4F_errorCode_t err) {
+    throw std::runtime_error(
+      fmt::format(fmt::runtime(fmt), LZ4F_getErrorName(err)));
+}
+static inline void check_lz4_error(const char* fmt, LZ4F_errorCode_t code) {
+    if (unlikely(LZ4F_isError(code))) {
+        throw_lz4_error(fmt, code);
+    }
+}
+
+using lz4_compression_ctx = std::unique_ptr<
+  LZ4F_cctx,
+  static_retval_deleter_fn<
+    LZ4F_cctx,
+    LZ4F_errorCode_t,
+    &LZ4F_freeCompressionContext>>;
+
+using lz4_decompression_ctx = std::unique_ptr<
+  LZ4F_dctx,
+  static_retval_deleter_fn<
+    LZ4F_dctx,
+    LZ4F_errorCode_t,
+    &LZ4F_freeDecompressionContext>>;
+
+ss::future<iobuf> async_stream_lz4::compress(iobuf i_buf) {
+    if (i_buf.size_bytes() <= window_size) {
+        co_return internal::lz4_frame_compressor::compress(i_buf);
+    }
+
+    LZ4F_cctx* c = nullptr;
+    check_lz4_error(
+      "LZ4F_createCompressionContext error: {}",
+      LZ4F_createCompressionContext(&c, LZ4F_VERSION));
+    lz4_compression_ctx ctx(c);
+
+    // same frame parameters as lz4_frame_compressor, required by Kafka
+    LZ4F_preferences_t prefs;
+    std::memset(&prefs, 0, sizeof(prefs));
+    prefs.compressionLevel = 1;
+    prefs.frameInfo = {
+      .blockMode = LZ4F_blockIndependent, .contentSize = i_buf.size_bytes()};
+
+    const size_t out_size = std::max<size_t>(
+      LZ4F_compressBound(window_size, &prefs), LZ4F_HEADER_SIZE_MAX);
+    check_lz4_error("lz4_compressbound error: {}", out_size);
+    ss::temporary_buffer<char> out(out_size);
+
+    iobuf ret_buf;
+    auto code = LZ4F_compressBegin(
+      ctx.get(), out.get_write(), out.size(), &prefs);
+    check_lz4_error("lz4f_compressbegin error: {}", code);
+    ret_buf.append(out.get(), code);
+
+    for (auto& frag : i_buf) {
+        for (size_t pos = 0; pos < frag.size(); pos += window_size) {
+            const auto len = std::min(window_size, frag.size() - pos);
+            code = LZ4F_compressUpdate(
+              ctx.get(),
+              out.get_write(),
+              out.size(),
+              // NOLINTNEXTLINE
+              frag.get() + pos,
+              len,
+              nullptr);
+            check_lz4_error("lz4f_compressupdate error: {}", code);
+            ret_buf.append(out.get(), code);
+            co_await ss::coroutine::maybe_yield();
+        }
+    }
+
+    code = LZ4F_compressEnd(ctx.get(), out.get_write(), out.size(), nullptr);
+    check_lz4_error("lz4f_compressend error: {}", code);
+    ret_buf.append(out.get(), code);
+    co_return ret_buf;
+}
+
+ss::future<iobuf> async_stream_lz4::uncompress(iobuf i_buf) {
+    if (unlikely(i_buf.empty())) {
+        throw std::runtime_error(
+          "Asked to async_stream_lz4::uncompress empty buffer");
+    }
+
+    LZ4F_dctx* d = nullptr;
+    check_lz4_error(
+      "LZ4F_createDecompressionContext error: {}",
+      LZ4F_createDecompressionContext(&d, LZ4F_VERSION));
+    lz4_decompression_ctx ctx(d);
+
+    ss::temporary_buffer<char> out(window_size);
+    iobuf ret_buf;
+    // hint returned by LZ4F_decompress, 0 once the frame is complete
+    size_t code = 1;
+    for (auto& frag : i_buf) {
+        const char* src = frag.get();
+        size_t remaining = frag.size();
+        bool out_full = false;
+        while (remaining > 0 || (out_full && code != 0)) {
+            if (code == 0) {
+                throw std::runtime_error(fmt::format(
+                  "lz4 error. {} bytes left after the end of the frame",
+                  remaining));
+            }
+            size_t out_sz = out.size();
+            size_t in_sz = remaining;
+            code = LZ4F_decompress(
+              ctx.get(), out.get_write(), &out_sz, src, &in_sz, nullptr);
+            check_lz4_error("lz4f_decompress error: {}", code);
+            // NOLINTNEXTLINE
+            src += in_sz;
+            remaining -= in_sz;
+            out_full = out_sz == out.size();
+            ret_buf.append(out.get(), out_sz);
+            co_await ss::coroutine::maybe_yield();
+        }
+    }
+
+    if (code != 0) {
+        throw std::runtime_error("lz4 error. input truncated before end of "
+                                 "the frame");
+    }
+    co_return ret_buf;
+}
+
+} // namespace compression
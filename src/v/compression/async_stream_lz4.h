@@ -0,0 +1,38 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "seastarx.h"
+#include "units.h"
+
+#include <seastar/core/future.hh>
+
+namespace compression {
+/*
+ * A streaming lz4 frame compression class
+ *
+ * Produces and accepts the same frames as the lz4 frame compressor behind
+ * compression::compressor. Both compress and uncompress process the data in
+ * window sized steps and allow for a scheduling point after each step.
+ * Inputs which fit in a single window are compressed synchronously, the
+ * output of decompression is not bounded by its input so it always streams.
+ */
+class async_stream_lz4 {
+public:
+    static constexpr size_t window_size = 64_KiB;
+
+    static ss::future<iobuf> compress(iobuf);
+    static ss::future<iobuf> uncompress(iobuf);
+};
+
+} // namespace compression
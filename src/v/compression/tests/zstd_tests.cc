@@ -7,6 +7,7 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "compression/async_stream_lz4.h"
 #include "compression/async_stream_zstd.h"
 #include "compression/internal/gzip_compressor.h"
 #include "compression/internal/lz4_frame_compressor.h"
@@ -162,6 +163,37 @@ SEASTAR_THREAD_TEST_CASE(lz4_block_tests) {
     using fn = compression::internal::lz4_frame_compressor;
     roundtrip_compression(fn::compress, fn::uncompress);
 }
+SEASTAR_THREAD_TEST_CASE(async_stream_lz4_test) {
+    using fn = compression::async_stream_lz4;
+    auto test_sizes = get_test_sizes();
+    test_sizes.push_back(fn::window_size * 3 + 17);
+    test_sizes.push_back(1_MiB);
+    for (size_t i : test_sizes) {
+        iobuf buf = gen(i);
+        auto cbuf = fn::compress(buf.share(0, i)).get();
+        auto dbuf = fn::uncompress(cbuf.copy()).get();
+        BOOST_CHECK_EQUAL(dbuf, buf);
+
+        // frames are interchangeable with the synchronous compressor
+        using sync_fn = compression::internal::lz4_frame_compressor;
+        BOOST_CHECK_EQUAL(sync_fn::uncompress(cbuf), buf);
+        BOOST_CHECK_EQUAL(fn::uncompress(sync_fn::compress(buf)).get(), buf);
+    }
+}
+SEASTAR_THREAD_TEST_CASE(async_stream_lz4_rejects_bad_frames) {
+    using fn = compression::async_stream_lz4;
+    iobuf buf = gen(fn::window_size * 2);
+    auto cbuf = fn::compress(buf.share(0, buf.size_bytes())).get();
+
+    auto truncated = cbuf.share(0, cbuf.size_bytes() - 8);
+    BOOST_CHECK_THROW(
+      fn::uncompress(std::move(truncated)).get(), std::runtime_error);
+
+    auto trailing = cbuf.copy();
+    trailing.append(cbuf.copy());
+    BOOST_CHECK_THROW(
+      fn::uncompress(std::move(trailing)).get(), std::runtime_error);
+}
 SEASTAR_THREAD_TEST_CASE(snapy_java_test) {
     using fn = compression::internal::snappy_java_compressor;
     roundtrip_compression(fn::compress, fn::uncompress);
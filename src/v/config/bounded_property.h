@@ -12,6 +12,8 @@
 #include "config/base_property.h"
 #include "config/property.h"
 
+#include <concepts>
+
 namespace config {
 
 /**
@@ -24,12 +26,17 @@ namespace detail {
  * Traits required for a type to be usable with `numeric_bounds`
  */
 template<typename T>
-concept numeric = requires(const T& x) {
+concept has_modulo = requires(const T& x) {
     {x % x};
-    { x < x } -> std::same_as<bool>;
-    { x > x } -> std::same_as<bool>;
 };
 
+template<typename T>
+concept numeric = (has_modulo<T> || std::floating_point<T>)
+                  && requires(const T& x) {
+                         { x < x } -> std::same_as<bool>;
+                         { x > x } -> std::same_as<bool>;
+                     };
+
 /**
  * Concept that is true for stdlib containers which publish their
  * inner contained type as ::value_type
@@ -68,15 +75,18 @@ requires detail::numeric<T>
 struct numeric_bounds {
     std::optional<T> min = std::nullopt;
     std::optional<T> max = std::nullopt;
+    // align and oddeven are only applied to types with a modulo operator
     std::optional<T> align = std::nullopt;
     std::optional<odd_even_constraint> oddeven = std::nullopt;
 
     T clamp(T& original) {
         T result = original;
 
-        if (align.has_value()) {
-            auto remainder = result % align.value();
-            result -= remainder;
+        if constexpr (detail::has_modulo<T>) {
+            if (align.has_value()) {
+                auto remainder = result % align.value();
+                result -= remainder;
+            }
         }
 
         if (min.has_value()) {
@@ -95,7 +105,15 @@ struct numeric_bounds {
             return fmt::format("too small, must be at least {}", min.value());
         } else if (max.has_value() && value > max.value()) {
             return fmt::format("too large, must be at most {}", max.value());
-        } else if (align.has_value() && value % align.value() != T{0}) {
+        }
+        if constexpr (detail::has_modulo<T>) {
+            return validate_modulo(value);
+        }
+        return std::nullopt;
+    }
+
+    std::optional<ss::sstring> validate_modulo(T& value) {
+        if (align.has_value() && value % align.value() != T{0}) {
             return fmt::format(
               "not aligned, must be aligned to nearest {}", align.value());
         } else if (
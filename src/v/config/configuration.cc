@@ -130,6 +130,23 @@ configuration::configuration()
       {.example = "65536"},
       std::nullopt,
       {.min = 32_KiB, .align = 4_KiB})
+  , rpc_server_stream_recv_buf(
+      *this,
+      "rpc_server_stream_recv_buf",
+      "Internal RPC userspace receive buffer max size in bytes",
+      {.example = "65536", .visibility = visibility::tunable},
+      std::nullopt,
+      // See kafka_rpc_server_stream_recv_buf for the bounds
+      {.min = 512, .max = 512_KiB, .align = 4_KiB})
+  , tls_enable_session_resumption(
+      *this,
+      "tls_enable_session_resumption",
+      "Issue TLS 1.3 session tickets on the Kafka and internal RPC listeners "
+      "so that reconnecting clients can skip the full handshake. The ticket "
+      "key is generated per shard, a session is only resumed if the client "
+      "reconnects to the same shard.",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      false)
   , enable_coproc(
       *this,
       "enable_coproc",
@@ -437,6 +454,20 @@ configuration::configuration()
       "wasn't reached",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       1ms)
+  , enable_follower_fetching(
+      *this,
+      "enable_follower_fetching",
+      "Allow consumers which provide a rack id to fetch from in sync follower "
+      "replicas located in the same rack (KIP-392)",
+      {.needs_restart = needs_restart::no, .visibility = visibility::user},
+      false)
+  , follower_fetching_max_staleness_ms(
+      *this,
+      "follower_fetching_max_staleness_ms",
+      "Follower replica stops serving consumer fetches if it did not hear "
+      "from the leader for longer than this interval",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      5s)
   , alter_topic_cfg_timeout_ms(
       *this,
       "alter_topic_cfg_timeout_ms",
@@ -681,6 +712,22 @@ configuration::configuration()
       "one follower",
       {.visibility = visibility::tunable},
       16)
+  , raft_install_snapshot_chunk_size(
+      *this,
+      "raft_install_snapshot_chunk_size",
+      "Size of a single snapshot chunk sent by leader to follower during "
+      "snapshot delivery",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      256_KiB,
+      {.min = 4_KiB, .max = 8_MiB})
+  , raft_install_snapshot_max_chunks_in_flight(
+      *this,
+      "raft_install_snapshot_max_chunks_in_flight",
+      "Maximum number of snapshot chunks sent by leader to one follower "
+      "without waiting for a reply",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      4,
+      {.min = 1, .max = 64})
   , reclaim_min_size(
       *this,
       "reclaim_min_size",
@@ -961,6 +1008,17 @@ configuration::configuration()
       "limit applies to compressed batch size",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       1_MiB)
+  , kafka_max_pipelined_requests_per_connection(
+      *this,
+      "kafka_max_pipelined_requests_per_connection",
+      "Maximum number of read only requests (fetch, list offsets and "
+      "describe requests) of a single connection that are processed "
+      "concurrently with the requests that follow them. Responses are always "
+      "sent in request order and requests with side effects wait for the "
+      "pipelined requests received before them. Zero processes requests one "
+      "at a time. Applies to new connections",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0)
   , kafka_nodelete_topics(
       *this,
       "kafka_nodelete_topics",
@@ -1294,12 +1352,37 @@ configuration::configuration()
       "Enable re-uploading data for compacted topics",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       true)
+  , cloud_storage_enable_binary_manifest(
+      *this,
+      "cloud_storage_enable_binary_manifest",
+      "Upload partition manifests in the compact binary format (manifest.bin) "
+      "instead of json. Manifests in both formats can always be read.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
+  , cloud_storage_spillover_manifest_size(
+      *this,
+      "cloud_storage_spillover_manifest_size",
+      "Maximum number of segments in the partition manifest. Once the limit "
+      "is exceeded the oldest segments are moved to an immutable spillover "
+      "manifest. Partition manifests that reference spillover manifests are "
+      "always uploaded in the binary format. If not set the partition "
+      "manifest is never split.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      std::nullopt)
   , cloud_storage_recovery_temporary_retention_bytes_default(
       *this,
       "cloud_storage_recovery_temporary_retention_bytes_default",
       "Retention in bytes for topics created during automated recovery",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       1_GiB)
+  , cloud_storage_recovery_download_concurrency(
+      *this,
+      "cloud_storage_recovery_download_concurrency",
+      "Max number of segments of a single partition which are downloaded "
+      "concurrently when the partition is restored from the cloud storage.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      4,
+      {.min = 1})
   , cloud_storage_segment_size_target(
       *this,
       "cloud_storage_segment_size_target",
@@ -1430,6 +1513,88 @@ configuration::configuration()
       "value of `topic_partitions_per_shard` multiplied by 2 is used.",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       std::nullopt)
+  , cloud_storage_disable_chunk_reads(
+      *this,
+      "cloud_storage_disable_chunk_reads",
+      "Disable chunk reads and switch back to downloading whole segments "
+      "from object storage into the cache.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
+  , cloud_storage_cache_chunk_size(
+      *this,
+      "cloud_storage_cache_chunk_size",
+      "Size of the chunks of the segments downloaded into the cache. Chunks "
+      "are fetched with ranged requests and stored in the cache "
+      "independently, so reads only hydrate the part of the segment they "
+      "need.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      16_MiB,
+      {.min = 1_MiB})
+  , cloud_storage_chunk_prefetch(
+      *this,
+      "cloud_storage_chunk_prefetch",
+      "Number of chunks following the one being read which are downloaded "
+      "in the background when the segment is read sequentially.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      1)
+  , cloud_storage_segment_prefetch(
+      *this,
+      "cloud_storage_segment_prefetch",
+      "Number of segments following the one being read which are hydrated "
+      "in the background when the partition is read sequentially. Segments "
+      "are only prefetched if they fit into the cache without eviction.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      1)
+  , cloud_storage_multipart_upload_threshold(
+      *this,
+      "cloud_storage_multipart_upload_threshold",
+      "Segments larger than this size are uploaded in multiple parts which "
+      "are sent in parallel and retried individually. If not set, segments "
+      "are always uploaded using a single request.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      64_MiB)
+  , cloud_storage_multipart_upload_part_size(
+      *this,
+      "cloud_storage_multipart_upload_part_size",
+      "Size of the part of a multipart upload. Every part which is being "
+      "uploaded is kept in memory.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      8_MiB,
+      {.min = 5_MiB})
+  , cloud_storage_multipart_upload_concurrency(
+      *this,
+      "cloud_storage_multipart_upload_concurrency",
+      "Max number of parts of a single multipart upload which are uploaded "
+      "concurrently.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      4,
+      {.min = 1})
+  , cloud_storage_multipart_upload_memory(
+      *this,
+      "cloud_storage_multipart_upload_memory",
+      "Max size of the parts of multipart uploads which are kept in memory "
+      "on each shard. The uploads wait for memory when the limit is reached.",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      64_MiB,
+      {.min = 5_MiB})
+  , cloud_storage_upload_catchup_batch_size(
+      *this,
+      "cloud_storage_upload_catchup_batch_size",
+      "Max number of segments which are uploaded and added to the manifest "
+      "at once when the partition lags behind (e.g. after the bucket was "
+      "unavailable). The catch-up mode is disabled if the value is not "
+      "greater than the regular upload concurrency.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      32,
+      {.min = 1, .max = 256})
+  , cloud_storage_upload_catchup_concurrency(
+      *this,
+      "cloud_storage_upload_catchup_concurrency",
+      "Max number of segments of a single partition which are uploaded "
+      "concurrently in the catch-up mode.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      8,
+      {.min = 1})
   , superusers(
       *this,
       "superusers",
@@ -1496,6 +1661,44 @@ configuration::configuration()
       "Update frequency for kafka queue depth control.",
       {.visibility = visibility::tunable},
       7s)
+  , kafka_load_shedding_enable(
+      *this,
+      "kafka_load_shedding_enable",
+      "Throttle low priority kafka requests (metadata, list offsets, describe "
+      "requests) on shards whose reactor is saturated",
+      {.needs_restart = needs_restart::no, .visibility = visibility::user},
+      false)
+  , kafka_load_shedding_utilization_threshold(
+      *this,
+      "kafka_load_shedding_utilization_threshold",
+      "Smoothed fraction of time the reactor is busy (between 0.5 and 1) "
+      "above which low priority kafka requests are throttled",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0.9,
+      {.min = 0.5, .max = 1.0})
+  , kafka_load_shedding_max_task_latency_ms(
+      *this,
+      "kafka_load_shedding_max_task_latency_ms",
+      "Task queue latency above which a saturated shard delays low priority "
+      "kafka requests before processing them, in addition to asking clients "
+      "to throttle",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      50ms)
+  , kafka_load_shedding_throttle_ms(
+      *this,
+      "kafka_load_shedding_throttle_ms",
+      "Throttle delay applied to low priority kafka requests while a shard is "
+      "overloaded",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      100ms)
+  , kafka_shard_affinity_tracking_enable(
+      *this,
+      "kafka_shard_affinity_tracking_enable",
+      "Measure how many partitions accessed by produce and fetch requests are "
+      "owned by a shard other than the one handling the connection. This only "
+      "collects metrics, connections are not moved between shards",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      false)
   , zstd_decompress_workspace_bytes(
       *this,
       "zstd_decompress_workspace_bytes",
@@ -1593,6 +1796,22 @@ configuration::configuration()
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       512,
       {.min = 1, .max = 2048})
+  , leader_balancer_transfer_batch_size(
+      *this,
+      "leader_balancer_transfer_batch_size",
+      "Maximum number of leadership transfers planned in one balancer tick. "
+      "Transfers for groups led by the same node are sent in a single request",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      64,
+      {.min = 1, .max = 2048})
+  , leader_balancer_transfer_batch_concurrency(
+      *this,
+      "leader_balancer_transfer_batch_concurrency",
+      "Maximum number of leadership transfers from a single batched request "
+      "that a node executes concurrently",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      16,
+      {.min = 1, .max = 512})
   , internal_topic_replication_factor(
       *this,
       "internal_topic_replication_factor",
@@ -56,6 +56,8 @@ struct configuration final : public config_store {
     bounded_property<std::optional<int>> rpc_server_listen_backlog;
     bounded_property<std::optional<int>> rpc_server_tcp_recv_buf;
     bounded_property<std::optional<int>> rpc_server_tcp_send_buf;
+    bounded_property<std::optional<size_t>> rpc_server_stream_recv_buf;
+    property<bool> tls_enable_session_resumption;
     // Coproc
     property<bool> enable_coproc;
     property<size_t> coproc_max_inflight_bytes;
@@ -111,6 +113,8 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds> tx_timeout_delay_ms;
     deprecated_property rm_violation_recovery_policy;
     property<std::chrono::milliseconds> fetch_reads_debounce_timeout;
+    property<bool> enable_follower_fetching;
+    property<std::chrono::milliseconds> follower_fetching_max_staleness_ms;
     property<std::chrono::milliseconds> alter_topic_cfg_timeout_ms;
     property<model::cleanup_policy_bitflags> log_cleanup_policy;
     enum_property<model::timestamp_type> log_message_timestamp_type;
@@ -154,6 +158,8 @@ struct configuration final : public config_store {
     property<size_t> raft_learner_recovery_rate;
     property<std::optional<uint32_t>> raft_smp_max_non_local_requests;
     property<uint32_t> raft_max_concurrent_append_requests_per_follower;
+    bounded_property<size_t> raft_install_snapshot_chunk_size;
+    bounded_property<uint32_t> raft_install_snapshot_max_chunks_in_flight;
 
     property<size_t> reclaim_min_size;
     property<size_t> reclaim_max_size;
@@ -199,6 +205,7 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds> node_management_operation_timeout_ms;
     property<uint32_t> kafka_request_max_bytes;
     property<uint32_t> kafka_batch_max_bytes;
+    property<uint32_t> kafka_max_pipelined_requests_per_connection;
     property<std::vector<ss::sstring>> kafka_nodelete_topics;
     property<std::vector<ss::sstring>> kafka_noproduce_topics;
 
@@ -261,7 +268,10 @@ struct configuration final : public config_store {
     property<bool> cloud_storage_enable_segment_merging;
     property<size_t> cloud_storage_max_segments_pending_deletion_per_partition;
     property<bool> cloud_storage_enable_compacted_topic_reupload;
+    property<bool> cloud_storage_enable_binary_manifest;
+    property<std::optional<size_t>> cloud_storage_spillover_manifest_size;
     property<size_t> cloud_storage_recovery_temporary_retention_bytes_default;
+    bounded_property<size_t> cloud_storage_recovery_download_concurrency;
     property<std::optional<size_t>> cloud_storage_segment_size_target;
     property<std::optional<size_t>> cloud_storage_segment_size_min;
     property<std::optional<std::chrono::milliseconds>>
@@ -292,6 +302,16 @@ struct configuration final : public config_store {
     property<std::optional<uint32_t>> cloud_storage_max_readers_per_shard;
     property<std::optional<uint32_t>>
       cloud_storage_max_materialized_segments_per_shard;
+    property<bool> cloud_storage_disable_chunk_reads;
+    bounded_property<size_t> cloud_storage_cache_chunk_size;
+    property<uint16_t> cloud_storage_chunk_prefetch;
+    property<uint16_t> cloud_storage_segment_prefetch;
+    property<std::optional<size_t>> cloud_storage_multipart_upload_threshold;
+    bounded_property<size_t> cloud_storage_multipart_upload_part_size;
+    bounded_property<size_t> cloud_storage_multipart_upload_concurrency;
+    bounded_property<size_t> cloud_storage_multipart_upload_memory;
+    bounded_property<size_t> cloud_storage_upload_catchup_batch_size;
+    bounded_property<size_t> cloud_storage_upload_catchup_concurrency;
 
     one_or_many_property<ss::sstring> superusers;
 
@@ -308,6 +328,13 @@ struct configuration final : public config_store {
     property<size_t> kafka_qdc_min_depth;
     property<size_t> kafka_qdc_max_depth;
     property<std::chrono::milliseconds> kafka_qdc_depth_update_ms;
+
+    // kafka load shedding based on reactor utilization
+    property<bool> kafka_load_shedding_enable;
+    bounded_property<double> kafka_load_shedding_utilization_threshold;
+    property<std::chrono::milliseconds> kafka_load_shedding_max_task_latency_ms;
+    property<std::chrono::milliseconds> kafka_load_shedding_throttle_ms;
+    property<bool> kafka_shard_affinity_tracking_enable;
     property<size_t> zstd_decompress_workspace_bytes;
     one_or_many_property<ss::sstring> full_raft_configuration_recovery_pattern;
     property<bool> enable_auto_rebalance_on_node_add;
@@ -327,6 +354,8 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds> leader_balancer_mute_timeout;
     property<std::chrono::milliseconds> leader_balancer_node_mute_timeout;
     bounded_property<size_t> leader_balancer_transfer_limit_per_shard;
+    bounded_property<size_t> leader_balancer_transfer_batch_size;
+    bounded_property<size_t> leader_balancer_transfer_batch_concurrency;
     property<int> internal_topic_replication_factor;
     property<std::chrono::milliseconds> health_manager_tick_interval;
 
@@ -18,6 +18,7 @@ struct test_config : public config::config_store {
     config::bounded_property<int32_t> bounded_int;
     config::bounded_property<std::optional<int32_t>> bounded_int_opt;
     config::bounded_property<int16_t> odd_constraint;
+    config::bounded_property<double> bounded_double;
 
     test_config()
       : bounded_int(
@@ -40,7 +41,14 @@ struct test_config : public config::config_store {
           "Property value has to be odd",
           {},
           1,
-          {.oddeven = config::odd_even_constraint::odd}) {}
+          {.oddeven = config::odd_even_constraint::odd})
+      , bounded_double(
+          *this,
+          "bounded_double",
+          "A floating point number with some bounds set",
+          {},
+          0.5,
+          {.min = 0.1, .max = 1.0}) {}
 };
 
 SEASTAR_THREAD_TEST_CASE(numeric_bounds) {
@@ -101,4 +109,22 @@ SEASTAR_THREAD_TEST_CASE(numeric_bounds) {
     BOOST_CHECK(cfg.bounded_int() == 8192);
 }
 
+SEASTAR_THREAD_TEST_CASE(floating_point_bounds) {
+    auto cfg = test_config();
+
+    for (const auto& v : {"0.1", "0.75", "1", "1.0"}) {
+        BOOST_CHECK(!cfg.bounded_double.validate(YAML::Load(v)).has_value());
+    }
+    for (const auto& v : {"0", "0.09", "-0.5", "1.01", "2"}) {
+        BOOST_CHECK(cfg.bounded_double.validate(YAML::Load(v)).has_value());
+    }
+
+    cfg.bounded_double.set_value(YAML::Load("1.5"));
+    BOOST_CHECK(cfg.bounded_double() == 1.0);
+    cfg.bounded_double.set_value(YAML::Load("0.05"));
+    BOOST_CHECK(cfg.bounded_double() == 0.1);
+    cfg.bounded_double.set_value(YAML::Load("0.25"));
+    BOOST_CHECK(cfg.bounded_double() == 0.25);
+}
+
 } // namespace
\ No newline at end of file
@@ -69,6 +69,16 @@ std::string_view to_string_view(feature f) {
         return "rpc_transport_unknown_errc";
     case feature::membership_change_controller_cmds:
         return "membership_change_controller_cmds";
+    case feature::raft_packed_append_entries:
+        return "raft_packed_append_entries";
+    case feature::rpc_lz4_compression:
+        return "rpc_lz4_compression";
+    case feature::cloud_storage_manifest_format_v2:
+        return "cloud_storage_manifest_format_v2";
+    case feature::cloud_storage_manifest_spillover:
+        return "cloud_storage_manifest_spillover";
+    case feature::raft_snapshot_pipelining:
+        return "raft_snapshot_pipelining";
     /*
      * testing features
      */
@@ -110,12 +120,13 @@ std::string_view to_string_view(feature_state::state s) {
 //  22.3.1 -> 7  (22.3.6 later proceeds to verison 8)
 //  23.1.1 -> 9
 //  23.2.1 -> 10
+//  23.3.1 -> 11
 //
 // Although some previous stable branches have included feature version
 // bumps, this is _not_ the intended usage, as stable branches are
 // meant to be safely downgradable within the branch, and new features
 // imply that new data formats may be written.
-static constexpr cluster_version latest_version = cluster_version{10};
+static constexpr cluster_version latest_version = cluster_version{11};
 
 // The earliest version we can upgrade from.  This is the version that
 // a freshly initialized node will start at: e.g. a 23.1 Redpanda joining
@@ -55,6 +55,11 @@ enum class feature : std::uint64_t {
     group_offset_retention = 1ULL << 20U,
     rpc_transport_unknown_errc = 1ULL << 21U,
     membership_change_controller_cmds = 1ULL << 22U,
+    raft_packed_append_entries = 1ULL << 23U,
+    rpc_lz4_compression = 1ULL << 24U,
+    cloud_storage_manifest_format_v2 = 1ULL << 25U,
+    cloud_storage_manifest_spillover = 1ULL << 26U,
+    raft_snapshot_pipelining = 1ULL << 27U,
 
     // Dummy features for testing only
     test_alpha = 1ULL << 62U,
@@ -246,6 +251,36 @@ constexpr static std::array feature_schema{
     feature::membership_change_controller_cmds,
     feature_spec::available_policy::always,
     feature_spec::prepare_policy::always},
+  feature_spec{
+    cluster::cluster_version{11},
+    "raft_packed_append_entries",
+    feature::raft_packed_append_entries,
+    feature_spec::available_policy::always,
+    feature_spec::prepare_policy::always},
+  feature_spec{
+    cluster::cluster_version{11},
+    "rpc_lz4_compression",
+    feature::rpc_lz4_compression,
+    feature_spec::available_policy::always,
+    feature_spec::prepare_policy::always},
+  feature_spec{
+    cluster::cluster_version{11},
+    "cloud_storage_manifest_format_v2",
+    feature::cloud_storage_manifest_format_v2,
+    feature_spec::available_policy::always,
+    feature_spec::prepare_policy::always},
+  feature_spec{
+    cluster::cluster_version{11},
+    "cloud_storage_manifest_spillover",
+    feature::cloud_storage_manifest_spillover,
+    feature_spec::available_policy::always,
+    feature_spec::prepare_policy::always},
+  feature_spec{
+    cluster::cluster_version{11},
+    "raft_snapshot_pipelining",
+    feature::raft_snapshot_pipelining,
+    feature_spec::available_policy::always,
+    feature_spec::prepare_policy::always},
 
   // For testing, a feature that does not auto-activate
   feature_spec{
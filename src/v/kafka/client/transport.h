@@ -106,6 +106,12 @@ private:
                         // Finally, read the rest of the response from the
                         // buffer
                         return read_iobuf_exactly(_in, remaining);
+                    })
+                    .then([this](iobuf response) {
+                        return maybe_save_tls_session().then(
+                          [response = std::move(response)]() mutable {
+                              return std::move(response);
+                          });
                     });
               });
           });
@@ -0,0 +1,59 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "kafka/protocol/types.h"
+#include "seastarx.h"
+
+#include <seastar/core/shared_ptr.hh>
+
+namespace kafka {
+
+/**
+ * Wire encoding of a message struct for a single api version.
+ *
+ * The bytes are immutable once encoded, copies of the fragment refer to the
+ * same buffer and the responses which include it append zero copy references
+ * to it. Generated structs listed in generator.py:enable_preencoding write the
+ * fragment in place of their fields when it matches the response version.
+ */
+class encoded_fragment {
+public:
+    encoded_fragment() = default;
+
+    encoded_fragment(api_version version, iobuf buf)
+      : _version(version)
+      , _buf(ss::make_lw_shared<iobuf>(std::move(buf))) {}
+
+    /// True if the fragment holds the encoding for the api version
+    bool has_version(api_version version) const {
+        return _buf && _version == version;
+    }
+
+    size_t size_bytes() const { return _buf ? _buf->size_bytes() : 0; }
+
+    /// Zero copy reference to the encoded bytes
+    iobuf share() const {
+        return _buf ? _buf->share(0, _buf->size_bytes()) : iobuf{};
+    }
+
+    /// Fragments are equal if they share the same encoded bytes
+    friend bool operator==(const encoded_fragment&, const encoded_fragment&)
+      = default;
+
+private:
+    api_version _version{};
+    ss::lw_shared_ptr<iobuf> _buf;
+};
+
+} // namespace kafka
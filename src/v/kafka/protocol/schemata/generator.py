@@ -441,6 +441,12 @@ extra_headers = {
 # a vector implementation which resists fragmentation.
 enable_fragmentation_resistance = {'metadata_response_partition'}
 
+# These nested types can be encoded ahead of time for a single api version and
+# shared between responses. They get an encode method of their own, used by the
+# encoder of the enclosing struct, which writes the pre-encoded bytes in place
+# of the fields when they match the version of the response.
+enable_preencoding = {'metadata_response_topic'}
+
 
 def make_context_field(path):
     """
@@ -736,6 +742,10 @@ class StructType(FieldType):
     def is_struct(self):
         return True
 
+    @property
+    def is_preencodable(self):
+        return self.name in enable_preencoding
+
     @property
     def format(self):
         """Format string for output operator"""
@@ -1044,6 +1054,9 @@ HEADER_TEMPLATE = """
 #include "kafka/protocol/errors.h"
 #include "seastarx.h"
 #include "utils/fragmented_vector.h"
+{%- if struct.structs()|selectattr("is_preencodable")|list %}
+#include "kafka/protocol/encoded_fragment.h"
+{%- endif %}
 
 {%- for header in struct.headers("header") %}
 {%- if header.startswith("<") %}
@@ -1097,6 +1110,14 @@ class response;
 
 {% for struct in struct.structs() %}
 {{ render_struct(struct) }}
+{%- if struct.is_preencodable %}
+
+    // encoding of the struct for a single api version, written in place of
+    // the fields when the versions match. see generator.py:enable_preencoding.
+    encoded_fragment encoded;
+
+    void encode(response_writer&, api_version);
+{%- endif %}
     friend std::ostream& operator<<(std::ostream&, const {{ struct.name }}&);
 };
 
@@ -1222,7 +1243,9 @@ if ({{ cond }}) {
 {%- endif %}
 {%- endif %}
     (void)version;
-{%- if field.type().value_type().is_struct %}
+{%- if field.type().value_type().is_struct and field.type().value_type().is_preencodable %}
+    v.encode(writer, version);
+{%- elif field.type().value_type().is_struct %}
 {{- struct_serde(field.type().value_type(), methods, "v") | indent }}
 {%- elif flex and field.type().value_type().potentially_flexible_type %}
     {{ writer }}.write_flex(v);
@@ -1410,6 +1433,27 @@ writer.write_tags(std::move({{ tf }}));
 
 namespace kafka {
 
+{%- for nested in struct.structs() if nested.is_preencodable %}
+void {{ nested.name }}::encode(response_writer& writer, api_version version) {
+    if (encoded.has_version(version)) {
+        writer.write_direct(encoded.share());
+        return;
+    }
+{%- if first_flex > 0 %}
+    if (version >= api_version({{ first_flex }})) {
+{{- struct_serde(nested, flex_encoder) | indent | indent }}
+    } else {
+{{- struct_serde(nested, encoder) | indent | indent }}
+    }
+{%- elif first_flex < 0 %}
+{{- struct_serde(nested, encoder) | indent }}
+{%- else %}
+{{- struct_serde(nested, flex_encoder) | indent }}
+{%- endif %}
+}
+
+{%- endfor %}
+
 {%- if struct.fields %}
 {%- if first_flex > 0 %}
 void {{ struct.name }}::encode(response_writer& writer, api_version version) {
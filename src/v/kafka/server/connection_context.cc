@@ -38,11 +38,31 @@
 
 #include <chrono>
 #include <memory>
+#include <vector>
 
 using namespace std::chrono_literals;
 
 namespace kafka {
 
+namespace {
+/*
+ * Moves the dispatch stage of a request into its response stage, so that the
+ * request is dispatched as soon as processing starts.
+ */
+process_result_stages process_in_background(process_result_stages res) {
+    auto response = res.dispatched.then_wrapped(
+      [f = std::move(res.response)](ss::future<> d) mutable {
+          if (d.failed()) {
+              f.ignore_ready_future();
+              return ss::make_exception_future<response_ptr>(
+                d.get_exception());
+          }
+          return std::move(f);
+      });
+    return {ss::now(), std::move(response)};
+}
+} // namespace
+
 ss::future<> connection_context::process() {
     while (true) {
         if (is_finished_parsing()) {
@@ -216,26 +236,35 @@ connection_context::record_tp_and_calculate_throttle(
     const snc_quota_manager::delays_t shard_delays
       = _server.snc_quota_mgr().get_shard_delays(_throttled_until, now);
 
+    // Throttle low priority requests while the reactor is saturated
+    const load_shedder::delays_t load_delays
+      = _server.load_shedder().get_delays(hdr.key);
+
     // Sum up
     const clock::duration delay_enforce = std::max(
-      shard_delays.enforce, client_quota_delay.enforce_duration());
+      {shard_delays.enforce,
+       client_quota_delay.enforce_duration(),
+       load_delays.enforce});
     const clock::duration delay_request = std::max(
       {shard_delays.request,
        client_quota_delay.duration,
+       load_delays.request,
        clock::duration::zero()});
     if (
       delay_enforce != clock::duration::zero()
       || delay_request != clock::duration::zero()) {
         vlog(
           klog.trace,
-          "[{}:{}] throttle request:{{snc:{}, client:{}}}, "
-          "enforce:{{snc:{}, client:{}}}, key:{}, request_size:{}",
+          "[{}:{}] throttle request:{{snc:{}, client:{}, load:{}}}, "
+          "enforce:{{snc:{}, client:{}, load:{}}}, key:{}, request_size:{}",
           _client_addr,
           client_port(),
           shard_delays.request,
           client_quota_delay.duration,
+          load_delays.request,
           shard_delays.enforce,
           client_quota_delay.enforce_duration(),
+          load_delays.enforce,
           hdr.key,
           request_size);
     }
@@ -290,9 +319,30 @@ ss::future<session_resources> connection_context::throttle_request(
                 }
                 return r;
             });
+      })
+      .then([this](session_resources r) {
+          return reserve_pipeline_units(std::move(r));
       });
 }
 
+ss::future<session_resources>
+connection_context::reserve_pipeline_units(session_resources r) {
+    const auto key = r.request_data.request_key;
+    if (!_pipeline.enabled()) {
+        co_return r;
+    }
+    if (!is_pipelinable(key) || (_sasl && !_sasl->complete())) {
+        // The side effects of this request must not be visible to the
+        // requests received before it.
+        co_await _pipeline.drain();
+        co_return r;
+    }
+    // fetches of a connection share a fetch session and must not overlap
+    r.pipeline_units = co_await _pipeline.reserve(key == fetch_api::key);
+    r.pipelined = true;
+    co_return r;
+}
+
 ss::future<ssx::semaphore_units>
 connection_context::reserve_request_units(api_key key, size_t size) {
     // Defer to the handler for the request type for the memory estimate, but
@@ -370,6 +420,15 @@ connection_context::dispatch_method_once(request_header hdr, size_t size) {
                 _seq_idx = _seq_idx + sequence_id(1);
                 auto res = kafka::process_request(
                   std::move(rctx), _server.smp_group(), *sres);
+                if (sres->pipelined) {
+                    /*
+                     * requests without side effects don't need to complete
+                     * before the next request is read, so the whole request
+                     * is processed in the background. the response is still
+                     * sent in request order.
+                     */
+                    res = process_in_background(std::move(res));
+                }
                 /**
                  * first stage processed in a foreground.
                  */
@@ -484,46 +543,64 @@ connection_context::dispatch_method_once(request_header hdr, size_t size) {
  */
 ss::future<> connection_context::maybe_process_responses() {
     return ss::repeat([this]() mutable {
-        auto it = _responses.find(_next_response);
-        if (it == _responses.end()) {
-            return ss::make_ready_future<ss::stop_iteration>(
-              ss::stop_iteration::yes);
+        ss::scattered_message<char> msg;
+        std::vector<session_resources::pointer> resources;
+        size_t fragments = 0;
+        // gather every in-order ready response into a single write, up to
+        // roughly the number of buffers a single writev can carry
+        while (fragments < max_fragments_per_write) {
+            auto it = _responses.find(_next_response);
+            if (it == _responses.end()) {
+                break;
+            }
+            // found one; increment counter
+            _next_response = _next_response + sequence_id(1);
+
+            auto resp_and_res = std::move(it->second);
+
+            _responses.erase(it);
+
+            if (resp_and_res.response->is_noop()) {
+                continue;
+            }
+
+            const auto size_before = msg.size();
+            fragments += append_response(
+              msg, std::move(resp_and_res.response));
+            const auto response_size = msg.size() - size_before;
+            if (
+              resp_and_res.resources->request_data.request_key
+              == fetch_api::key) {
+                _server.quota_mgr().record_fetch_tp(
+                  resp_and_res.resources->request_data.client_id,
+                  response_size);
+            }
+            // Respose sizes only take effect on throttling at the next
+            // request processing. The better way was to measure throttle
+            // delay right here and apply it to the immediate response, but
+            // that would require drastic changes to kafka message processing
+            // framework - because throttle_ms has been serialized long ago
+            // already. With the current approach, egress token bucket level
+            // will always be an extra burst into the negative while under
+            // pressure.
+            _server.snc_quota_mgr().record_response(response_size);
+            resources.push_back(std::move(resp_and_res.resources));
         }
-        // found one; increment counter
-        _next_response = _next_response + sequence_id(1);
 
-        auto resp_and_res = std::move(it->second);
-
-        _responses.erase(it);
-
-        if (resp_and_res.response->is_noop()) {
+        if (resources.empty()) {
             return ss::make_ready_future<ss::stop_iteration>(
-              ss::stop_iteration::no);
+              ss::stop_iteration::yes);
         }
 
-        auto msg = response_as_scattered(std::move(resp_and_res.response));
-        if (
-          resp_and_res.resources->request_data.request_key == fetch_api::key) {
-            _server.quota_mgr().record_fetch_tp(
-              resp_and_res.resources->request_data.client_id, msg.size());
-        }
-        // Respose sizes only take effect on throttling at the next request
-        // processing. The better way was to measure throttle delay right here
-        // and apply it to the immediate response, but that would require
-        // drastic changes to kafka message processing framework - because
-        // throttle_ms has been serialized long ago already. With the current
-        // approach, egress token bucket level will always be an extra burst
-        // into the negative while under pressure.
-        _server.snc_quota_mgr().record_response(msg.size());
         try {
             return conn->write(std::move(msg))
               .then([] {
                   return ss::make_ready_future<ss::stop_iteration>(
                     ss::stop_iteration::no);
               })
-              // release the resources only once it has been written to the
-              // connection.
-              .finally([resources = std::move(resp_and_res.resources)] {});
+              // release the resources only once they have been written to
+              // the connection.
+              .finally([resources = std::move(resources)] {});
         } catch (...) {
             vlog(
               klog.debug,
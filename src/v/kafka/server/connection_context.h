@@ -9,9 +9,12 @@
  * by the Apache License, Version 2.0
  */
 #pragma once
+#include "config/configuration.h"
 #include "config/property.h"
+#include "kafka/server/request_pipeline.h"
 #include "kafka/server/response.h"
 #include "kafka/server/server.h"
+#include "kafka/server/shard_affinity.h"
 #include "kafka/types.h"
 #include "net/server.h"
 #include "seastarx.h"
@@ -86,6 +89,10 @@ struct session_resources {
     std::unique_ptr<hdr_hist::measurement> method_latency;
     std::unique_ptr<request_tracker> tracker;
     request_data request_data;
+    // held by requests that are processed concurrently with the requests
+    // following them on the connection, see is_pipelinable()
+    request_pipeline::units pipeline_units;
+    bool pipelined{false};
 };
 
 class connection_context final
@@ -106,7 +113,10 @@ public:
       , _enable_authorizer(enable_authorizer)
       , _authlog(_client_addr, client_port())
       , _mtls_state(std::move(mtls_state))
-      , _max_request_size(std::move(max_request_size)) {}
+      , _max_request_size(std::move(max_request_size))
+      , _shard_affinity(s.shard_affinity_probe())
+      , _pipeline(config::shard_local_cfg()
+                    .kafka_max_pipelined_requests_per_connection()) {}
 
     ~connection_context() noexcept = default;
     connection_context(const connection_context&) = delete;
@@ -199,6 +209,10 @@ public:
     ss::net::inet_address client_host() const { return _client_addr; }
     uint16_t client_port() const { return conn ? conn->addr.port() : 0; }
 
+    /// tracks the shards owning the partitions this connection produces to
+    /// and fetches from
+    shard_affinity_tracker& shard_affinity() { return _shard_affinity; }
+
 private:
     bool is_finished_parsing() const;
 
@@ -238,6 +252,12 @@ private:
     ss::future<session_resources>
     throttle_request(const request_header&, size_t sz);
 
+    // Reserve a pipelining slot for requests that may be processed
+    // concurrently with the requests that follow them. The reservation
+    // bounds the number of such requests in flight on the connection.
+    // Other requests wait for the pipelined requests received before them.
+    ss::future<session_resources> reserve_pipeline_units(session_resources);
+
     ss::future<> dispatch_method_once(request_header, size_t sz);
 
     /**
@@ -248,7 +268,8 @@ private:
      * ready responses. In particular, responses which are ready may not be
      * processed if there are earlier (lower sequence number) responses
      * which are not yet ready: they will be processed by a future
-     * invocation.
+     * invocation. Responses that are ready together are written to the
+     * connection as a single message.
      *
      * @return ss::future<> a future which as described above.
      */
@@ -266,6 +287,10 @@ private:
         session_resources::pointer resources;
     };
 
+    // soft limit on the buffers gathered into a single connection write,
+    // matching the usual IOV_MAX of a writev
+    static constexpr size_t max_fragments_per_write = 1024;
+
     using sequence_id = named_type<uint64_t, struct kafka_protocol_sequence>;
     using map_t = absl::flat_hash_map<sequence_id, response_and_resources>;
 
@@ -331,6 +356,8 @@ private:
     std::optional<security::tls::mtls_state> _mtls_state;
     config::binding<uint32_t> _max_request_size;
     ss::lowres_clock::time_point _throttled_until;
+    shard_affinity_tracker _shard_affinity;
+    request_pipeline _pipeline;
 };
 
 } // namespace kafka
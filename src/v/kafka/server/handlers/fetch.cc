@@ -75,9 +75,11 @@ static ss::future<read_result> read_from_partition(
     }
     auto hw = part.high_watermark();
     auto start_o = part.start_offset();
-    // if we have no data read, return fast
+    // if we have no data read, return fast. A consumer that caught up fetches
+    // at the high watermark, there is nothing to read there either so idle
+    // consumers polling do not create log readers.
     if (
-      hw < config.start_offset || config.skip_read
+      hw <= config.start_offset || config.skip_read
       || config.start_offset > config.max_offset) {
         co_return read_result(start_o, hw, lso.value());
     }
@@ -139,6 +141,25 @@ static ss::future<read_result> read_from_partition(
       std::move(aborted_transactions));
 }
 
+/**
+ * Select in sync replica from the consumer rack, candidates are rotated by
+ * partition id to spread consumers of different partitions across replicas.
+ */
+static std::optional<model::node_id> select_preferred_read_replica(
+  const kafka::partition_proxy& part,
+  const std::vector<model::node_id>& candidates) {
+    auto in_sync = part.in_sync_followers();
+    const auto start = static_cast<size_t>(part.ntp().tp.partition());
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        const auto& candidate = candidates[(start + i) % candidates.size()];
+        if (std::find(in_sync.begin(), in_sync.end(), candidate)
+            != in_sync.end()) {
+            return candidate;
+        }
+    }
+    return std::nullopt;
+}
+
 /**
  * Entry point for reading from an ntp. This is executed on NTP home core and
  * build error responses if anything goes wrong.
@@ -157,7 +178,13 @@ static ss::future<read_result> do_read_from_ntp(
     if (unlikely(!kafka_partition)) {
         co_return read_result(error_code::unknown_topic_or_partition);
     }
-    if (unlikely(!kafka_partition->is_leader())) {
+    const bool is_leader = kafka_partition->is_leader();
+    if (unlikely(
+          !is_leader
+          && !(ntp_config.cfg.follower_read_allowed
+               && kafka_partition->may_serve_follower_reads(
+                 config::shard_local_cfg()
+                   .follower_fetching_max_staleness_ms())))) {
         co_return read_result(error_code::not_leader_for_partition);
     }
 
@@ -169,9 +196,39 @@ static ss::future<read_result> do_read_from_ntp(
     if (leader_epoch_err != error_code::none) {
         co_return read_result(leader_epoch_err);
     }
-    auto offset_ec = co_await kafka_partition->validate_fetch_offset(
-      ntp_config.cfg.start_offset,
-      default_fetch_timeout + model::timeout_clock::now());
+
+    if (is_leader && !ntp_config.cfg.preferred_replica_candidates.empty()) {
+        auto preferred = select_preferred_read_replica(
+          *kafka_partition, ntp_config.cfg.preferred_replica_candidates);
+        if (preferred) {
+            auto lso = kafka_partition->last_stable_offset();
+            if (unlikely(!lso)) {
+                co_return read_result(lso.error());
+            }
+            read_result res(
+              kafka_partition->start_offset(),
+              kafka_partition->high_watermark(),
+              lso.value());
+            res.preferred_replica = preferred;
+            co_return res;
+        }
+    }
+
+    error_code offset_ec = error_code::none;
+    if (is_leader) {
+        offset_ec = co_await kafka_partition->validate_fetch_offset(
+          ntp_config.cfg.start_offset,
+          default_fetch_timeout + model::timeout_clock::now());
+    } else if (ntp_config.cfg.start_offset < kafka_partition->start_offset()) {
+        /**
+         * Follower can not tell if the offset is out of range as its start
+         * offset may differ from the leader one, force consumer to go back to
+         * the leader. Offsets above follower high watermark are not an error,
+         * the consumer receives an empty response until the follower catches
+         * up.
+         */
+        offset_ec = error_code::not_leader_for_partition;
+    }
 
     if (config::shard_local_cfg().enable_transactions.value()) {
         if (
@@ -261,6 +318,9 @@ static void fill_fetch_responses(
         resp.log_start_offset = res.start_offset;
         resp.high_watermark = res.high_watermark;
         resp.last_stable_offset = res.last_stable_offset;
+        if (res.preferred_replica) {
+            resp.preferred_read_replica = (*res.preferred_replica)();
+        }
 
         /**
          * According to KIP-74 we have to return first batch even if it would
@@ -414,6 +474,38 @@ class parallel_fetch_plan_executor final : public fetch_plan_executor::impl {
     }
 };
 
+/**
+ * Replicas of the partition located in the consumer rack. Empty if the
+ * consumer did not provide its rack or this node is in the same rack as the
+ * consumer.
+ */
+static std::vector<model::node_id>
+preferred_replica_candidates(const op_context& octx, const model::ntp& ntp) {
+    std::vector<model::node_id> candidates;
+    const auto& client_rack = octx.request.data.rack_id;
+    if (!octx.follower_fetching_enabled() || client_rack.empty()) {
+        return candidates;
+    }
+    const auto& local_rack = config::node().rack();
+    if (local_rack && (*local_rack)() == client_rack) {
+        return candidates;
+    }
+    auto assignment = octx.rctx.metadata_cache().get_partition_assignment(ntp);
+    if (!assignment) {
+        return candidates;
+    }
+    for (const auto& r : assignment->replicas) {
+        if (r.node_id == config::node().node_id()) {
+            continue;
+        }
+        auto md = octx.rctx.metadata_cache().get_node_metadata(r.node_id);
+        if (md && md->broker.rack() && (*md->broker.rack())() == client_rack) {
+            candidates.push_back(r.node_id);
+        }
+    }
+    return candidates;
+}
+
 class simple_fetch_planner final : public fetch_planner::impl {
     fetch_plan create_plan(op_context& octx) final {
         fetch_plan plan(ss::smp::count);
@@ -472,6 +564,11 @@ class simple_fetch_planner final : public fetch_planner::impl {
                   ++resp_it;
                   return;
               }
+              if (octx.initial_fetch) {
+                  // count each partition once per request, not once per
+                  // debounced retry of the plan
+                  octx.rctx.connection()->shard_affinity().record(*shard);
+              }
 
               auto fetch_md = octx.rctx.get_fetch_metadata_cache().get(ntp);
               auto max_bytes = std::min(
@@ -492,6 +589,9 @@ class simple_fetch_planner final : public fetch_planner::impl {
                 .strict_max_bytes = octx.response_size > 0,
                 .skip_read = bytes_left_in_plan == 0 && max_bytes == 0,
                 .current_leader_epoch = fp.current_leader_epoch,
+                .follower_read_allowed = octx.follower_fetching_enabled(),
+                .preferred_replica_candidates = preferred_replica_candidates(
+                  octx, ntp),
               };
 
               plan.fetches_per_shard[*shard].push_back(
@@ -677,6 +777,10 @@ bool update_fetch_partition(
         include = true;
         partition.last_stable_offset = model::offset(resp.last_stable_offset);
     }
+    if (resp.preferred_read_replica != -1) {
+        // Partitions redirected to preferred read replica are always included
+        include = true;
+    }
     if (include) {
         return include;
     }
@@ -722,6 +826,8 @@ ss::future<response_ptr> op_context::send_response() && {
           .last_stable_offset = it->partition_response->last_stable_offset,
           .log_start_offset = it->partition_response->log_start_offset,
           .aborted = std::move(it->partition_response->aborted),
+          .preferred_read_replica
+          = it->partition_response->preferred_read_replica,
           .records = std::move(it->partition_response->records)};
 
         final_response.data.topics.back().partitions.push_back(std::move(r));
@@ -747,6 +853,9 @@ void op_context::response_placeholder::set(
     if (response.error_code != error_code::none) {
         _ctx->response_error = true;
     }
+    if (response.preferred_read_replica != -1) {
+        _ctx->preferred_replica_selected = true;
+    }
     auto& current_resp_data = _it->partition_response->records;
     if (current_resp_data) {
         auto sz = current_resp_data->size_bytes();
@@ -10,6 +10,7 @@
  */
 #pragma once
 #include "cluster/rm_stm.h"
+#include "config/configuration.h"
 #include "kafka/protocol/fetch.h"
 #include "kafka/server/handlers/handler.h"
 #include "kafka/types.h"
@@ -97,9 +98,18 @@ struct op_context {
     bool should_stop_fetch() const {
         return !request.debounce_delay() || over_min_bytes()
                || is_empty_request() || response_error
+               || preferred_replica_selected
                || deadline <= model::timeout_clock::now();
     }
 
+    /// Follower fetching is only available to consumers (not brokers) using
+    /// fetch v11+ which carries the client rack and preferred read replica
+    bool follower_fetching_enabled() const {
+        return config::shard_local_cfg().enable_follower_fetching()
+               && request.data.replica_id == -1
+               && rctx.header().version >= api_version(11);
+    }
+
     bool over_min_bytes() const {
         return static_cast<int32_t>(response_size) >= request.data.min_bytes;
     }
@@ -154,6 +164,8 @@ struct op_context {
     size_t response_size;
     // does the response contain an error
     bool response_error;
+    // does the response redirect consumer to a preferred read replica
+    bool preferred_replica_selected{false};
 
     bool initial_fetch = true;
     fetch_session_ctx session_ctx;
@@ -169,6 +181,12 @@ struct fetch_config {
     bool strict_max_bytes{false};
     bool skip_read{false};
     kafka::leader_epoch current_leader_epoch;
+    // consumer understands preferred read replicas and may be served by a
+    // follower (KIP-392)
+    bool follower_read_allowed{false};
+    // replicas located in the consumer rack, leader redirects the consumer to
+    // one of them if it is in sync
+    std::vector<model::node_id> preferred_replica_candidates;
 
     friend std::ostream& operator<<(std::ostream& o, const fetch_config& cfg) {
         fmt::print(
@@ -271,6 +289,8 @@ struct read_result {
     error_code error;
     model::partition_id partition;
     std::vector<cluster::rm_stm::tx_range> aborted_transactions;
+    // replica the consumer should fetch from instead of the leader
+    std::optional<model::node_id> preferred_replica;
 };
 // struct aggregating fetch requests and corresponding response iterators for
 // the same shard
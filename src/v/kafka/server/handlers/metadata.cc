@@ -21,6 +21,7 @@
 #include "kafka/server/handlers/details/leader_epoch.h"
 #include "kafka/server/handlers/details/security.h"
 #include "kafka/server/handlers/topics/topic_utils.h"
+#include "kafka/server/metadata_response_cache.h"
 #include "kafka/server/response.h"
 #include "kafka/types.h"
 #include "likely.h"
@@ -36,6 +37,7 @@
 #include <boost/numeric/conversion/cast.hpp>
 #include <fmt/ostream.h>
 
+#include <algorithm>
 #include <iterator>
 #include <type_traits>
 
@@ -227,11 +229,58 @@ make_error_topic_response(model::topic tp, error_code ec) {
     return metadata_response::topic{.error_code = ec, .name = std::move(tp)};
 }
 
+static bool all_partitions_have_leader(
+  const cluster::metadata_cache& md_cache, const cluster::topic_metadata& md) {
+    model::topic_namespace_view tp_ns = md.get_configuration().tp_ns;
+    return std::all_of(
+      md.get_assignments().begin(),
+      md.get_assignments().end(),
+      [&md_cache, tp_ns](const cluster::partition_assignment& p_as) {
+          return md_cache.get_leader_id(tp_ns, p_as.id).has_value();
+      });
+}
+
+/**
+ * Topic response of a node that is not isolated, encoded once per api version
+ * and kept in the shard local metadata response cache. A cache hit carries
+ * only the topic name and the shared encoding, the partitions are neither
+ * built nor encoded again. Topics with a leaderless partition are not cached,
+ * their response depends on the heuristics of get_leader_term which are meant
+ * to be evaluated on every request.
+ */
+static metadata_response::topic
+get_topic_response(request_context& ctx, const cluster::topic_metadata& md) {
+    const auto& tp_ns = md.get_configuration().tp_ns;
+    if (tp_ns.ns != model::kafka_namespace) {
+        return make_topic_response_from_topic_metadata(
+          ctx.metadata_cache(), md, is_node_isolated_or_decommissioned::no);
+    }
+    const auto version = ctx.header().version;
+    auto& cache = ctx.metadata_response_cache();
+    if (auto encoded = cache.get(tp_ns.tp, version); encoded) {
+        return metadata_response::topic{
+          .name = tp_ns.tp, .encoded = std::move(*encoded)};
+    }
+    auto res = make_topic_response_from_topic_metadata(
+      ctx.metadata_cache(), md, is_node_isolated_or_decommissioned::no);
+    // the authorized operations weren't requested, they're reported as 0
+    // by every response sharing the encoding
+    res.topic_authorized_operations = 0;
+    if (all_partitions_have_leader(ctx.metadata_cache(), md)) {
+        res.encoded = cache.put(tp_ns.tp, version, res);
+    }
+    return res;
+}
+
 static metadata_response::topic make_topic_response(
   request_context& ctx,
   metadata_request& rq,
   const cluster::topic_metadata& md,
   const is_node_isolated_or_decommissioned is_node_isolated) {
+    if (!rq.data.include_topic_authorized_operations && !is_node_isolated) {
+        return get_topic_response(ctx, md);
+    }
+
     int32_t auth_operations = 0;
     /**
      * if requested include topic authorized operations
@@ -251,6 +251,7 @@ static partition_produce_stages produce_topic_partition(
           .partition_index = ntp.tp.partition,
           .error_code = error_code::not_leader_for_partition});
     }
+    octx.rctx.connection()->shard_affinity().record(*shard);
 
     // steal the batch from the adapter
     auto batch = std::move(part.records->adapter.batch.value());
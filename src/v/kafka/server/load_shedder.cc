@@ -0,0 +1,187 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/server/load_shedder.h"
+
+#include "config/configuration.h"
+#include "kafka/protocol/schemata/describe_acls_request.h"
+#include "kafka/protocol/schemata/describe_configs_request.h"
+#include "kafka/protocol/schemata/describe_groups_request.h"
+#include "kafka/protocol/schemata/describe_log_dirs_request.h"
+#include "kafka/protocol/schemata/list_groups_request.h"
+#include "kafka/protocol/schemata/list_offset_request.h"
+#include "kafka/protocol/schemata/metadata_request.h"
+#include "kafka/server/logger.h"
+#include "prometheus/prometheus_sanitize.h"
+#include "vlog.h"
+
+#include <seastar/core/metrics.hh>
+#include <seastar/core/reactor.hh>
+
+#include <algorithm>
+#include <ostream>
+
+namespace kafka {
+
+load_shedder::load_shedder()
+  : _enabled(config::shard_local_cfg().kafka_load_shedding_enable.bind())
+  , _utilization_threshold(
+      config::shard_local_cfg().kafka_load_shedding_utilization_threshold.bind())
+  , _max_task_latency(
+      config::shard_local_cfg().kafka_load_shedding_max_task_latency_ms.bind())
+  , _throttle(config::shard_local_cfg().kafka_load_shedding_throttle_ms.bind())
+  , _sample_timer([this] { sample(); })
+  , _last_sample(timer_clock::now())
+  , _last_busy_time(ss::engine().total_busy_time()) {
+    _sample_deadline = _last_sample + sample_interval;
+    _sample_timer.arm(_sample_deadline);
+}
+
+void load_shedder::setup_metrics() {
+    namespace sm = ss::metrics;
+
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("kafka:load_shedding"),
+      {
+        sm::make_gauge(
+          "state",
+          [this] { return static_cast<uint8_t>(_state); },
+          sm::description(
+            "Load shedding state: 0 normal, 1 throttling, 2 shedding")),
+        sm::make_gauge(
+          "reactor_utilization",
+          [this] { return _utilization; },
+          sm::description("Smoothed fraction of time the reactor is busy")),
+        sm::make_gauge(
+          "task_latency_ms",
+          [this] { return _task_latency_ms; },
+          sm::description("Smoothed task queue latency in milliseconds")),
+        sm::make_counter(
+          "throttled_requests",
+          [this] { return _throttled_requests; },
+          sm::description(
+            "Low priority requests asked to throttle due to reactor load")),
+        sm::make_counter(
+          "deferred_requests",
+          [this] { return _deferred_requests; },
+          sm::description(
+            "Low priority requests held by the broker due to reactor load")),
+      });
+}
+
+bool load_shedder::is_low_priority(api_key key) {
+    switch (key) {
+    case metadata_api::key:
+    case list_offsets_api::key:
+    case describe_configs_api::key:
+    case describe_groups_api::key:
+    case list_groups_api::key:
+    case describe_acls_api::key:
+    case describe_log_dirs_api::key:
+        return true;
+    default:
+        return false;
+    }
+}
+
+load_shedder::delays_t load_shedder::delays_for(
+  state s, api_key key, clock::duration throttle) {
+    if (s == state::normal || !is_low_priority(key)) {
+        return {};
+    }
+    if (s == state::throttling) {
+        return {.request = throttle};
+    }
+    return {.enforce = throttle, .request = throttle};
+}
+
+load_shedder::delays_t load_shedder::get_delays(api_key key) {
+    if (_state != state::normal && is_low_priority(key)) {
+        ++_throttled_requests;
+        if (_state == state::shedding) {
+            ++_deferred_requests;
+        }
+    }
+    return delays_for(_state, key, _throttle());
+}
+
+load_shedder::state load_shedder::evaluate(
+  bool enabled,
+  double utilization,
+  double utilization_threshold,
+  double task_latency_ms,
+  std::chrono::milliseconds max_task_latency) {
+    if (!enabled || utilization < utilization_threshold) {
+        return state::normal;
+    }
+    return task_latency_ms >= static_cast<double>(max_task_latency.count())
+             ? state::shedding
+             : state::throttling;
+}
+
+void load_shedder::sample() {
+    const auto now = timer_clock::now();
+    const auto busy_time = ss::engine().total_busy_time();
+
+    // a timer fires late by about as long as runnable tasks had to wait
+    const auto lateness = std::chrono::duration<double, std::milli>(
+      std::max(now - _sample_deadline, timer_clock::duration::zero()));
+    const auto elapsed = std::chrono::duration<double>(now - _last_sample);
+    auto utilization = _utilization;
+    if (elapsed.count() > 0) {
+        const auto busy = std::chrono::duration<double>(
+          busy_time - _last_busy_time);
+        utilization = std::clamp(busy / elapsed, 0.0, 1.0);
+    }
+
+    _utilization = (1 - sample_weight) * _utilization
+                   + sample_weight * utilization;
+    _task_latency_ms = (1 - sample_weight) * _task_latency_ms
+                       + sample_weight * lateness.count();
+    _last_sample = now;
+    _last_busy_time = busy_time;
+
+    const auto next = evaluate(
+      _enabled(),
+      _utilization,
+      _utilization_threshold(),
+      _task_latency_ms,
+      _max_task_latency());
+    if (next != _state) {
+        vlog(
+          klog.info,
+          "Load shedding state {} -> {} (reactor utilization: {:.2f}, task "
+          "latency: {:.1f}ms)",
+          _state,
+          next,
+          _utilization,
+          _task_latency_ms);
+        _state = next;
+    }
+
+    _sample_deadline = now + sample_interval;
+    _sample_timer.arm(_sample_deadline);
+}
+
+std::ostream& operator<<(std::ostream& o, load_shedder::state s) {
+    switch (s) {
+    case load_shedder::state::normal:
+        return o << "normal";
+    case load_shedder::state::throttling:
+        return o << "throttling";
+    case load_shedder::state::shedding:
+        return o << "shedding";
+    }
+    return o << "unknown";
+}
+
+} // namespace kafka
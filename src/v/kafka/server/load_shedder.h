@@ -0,0 +1,114 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "config/property.h"
+#include "kafka/types.h"
+#include "seastarx.h"
+
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/metrics_registration.hh>
+#include <seastar/core/timer.hh>
+
+#include <chrono>
+#include <iosfwd>
+
+namespace kafka {
+
+/**
+ * Shard local admission control driven by reactor saturation.
+ *
+ * The reactor utilization (fraction of wall time spent running tasks) and
+ * the task queue latency (how late a timer fires) are sampled periodically
+ * and smoothed. Once utilization crosses the configured threshold, low
+ * priority requests (metadata, list offsets and describe requests) are asked
+ * to back off through throttle_time_ms. If in addition tasks wait longer than
+ * the configured latency, the shard is shedding load: low priority requests
+ * are also held by the broker before being processed, which mutes their
+ * connection, so that produce and fetch keep the reactor.
+ */
+class load_shedder {
+public:
+    using clock = ss::lowres_clock;
+
+    enum class state : uint8_t {
+        normal = 0,
+        throttling,
+        shedding,
+    };
+
+    /// @p enforce delay to enforce before processing the request
+    /// @p request delay to request from the client via throttle_ms
+    struct delays_t {
+        clock::duration enforce{0};
+        clock::duration request{0};
+    };
+
+    load_shedder();
+    load_shedder(const load_shedder&) = delete;
+    load_shedder& operator=(const load_shedder&) = delete;
+    load_shedder(load_shedder&&) = delete;
+    load_shedder& operator=(load_shedder&&) = delete;
+    ~load_shedder() noexcept = default;
+
+    void setup_metrics();
+
+    /// Delays to apply to a request of the given api in the current state
+    delays_t get_delays(api_key);
+
+    state current_state() const { return _state; }
+
+    /// True for the requests throttled first when the shard is overloaded
+    static bool is_low_priority(api_key);
+
+    /// State of a shard with the given smoothed utilization and task latency
+    static state evaluate(
+      bool enabled,
+      double utilization,
+      double utilization_threshold,
+      double task_latency_ms,
+      std::chrono::milliseconds max_task_latency);
+
+    /// Delays for a request of the given api in the given state
+    static delays_t delays_for(state, api_key, clock::duration throttle);
+
+private:
+    using timer_clock = ss::steady_clock_type;
+
+    static constexpr auto sample_interval = std::chrono::milliseconds(100);
+    // weight of the most recent sample in the smoothed values
+    static constexpr double sample_weight = 0.2;
+
+    void sample();
+
+    config::binding<bool> _enabled;
+    config::binding<double> _utilization_threshold;
+    config::binding<std::chrono::milliseconds> _max_task_latency;
+    config::binding<std::chrono::milliseconds> _throttle;
+
+    ss::timer<timer_clock> _sample_timer;
+    timer_clock::time_point _sample_deadline;
+    timer_clock::time_point _last_sample;
+    timer_clock::duration _last_busy_time{0};
+
+    double _utilization{0};
+    double _task_latency_ms{0};
+    state _state{state::normal};
+    uint64_t _throttled_requests{0};
+    uint64_t _deferred_requests{0};
+
+    ss::metrics::metric_groups _metrics;
+};
+
+std::ostream& operator<<(std::ostream&, load_shedder::state);
+
+} // namespace kafka
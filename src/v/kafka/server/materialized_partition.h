@@ -48,6 +48,12 @@ public:
 
     bool is_leader() const final { return _partition->is_leader(); }
 
+    bool may_serve_follower_reads(std::chrono::milliseconds) const final {
+        return false;
+    }
+
+    std::vector<model::node_id> in_sync_followers() const final { return {}; }
+
     kafka::leader_epoch leader_epoch() const final {
         return leader_epoch_from_term(_partition->term());
     }
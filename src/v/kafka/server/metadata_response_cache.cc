@@ -0,0 +1,126 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/server/metadata_response_cache.h"
+
+#include "cluster/metadata_cache.h"
+#include "config/configuration.h"
+#include "kafka/protocol/response_writer.h"
+#include "model/namespace.h"
+#include "prometheus/prometheus_sanitize.h"
+
+#include <seastar/core/metrics.hh>
+
+namespace kafka {
+
+metadata_response_cache::metadata_response_cache(
+  cluster::metadata_cache& md_cache)
+  : _md_cache(md_cache) {
+    _topic_notification = _md_cache.register_topic_delta_notification(
+      [this](std::span<const cluster::topic_table_delta> deltas) {
+          on_topic_deltas(deltas);
+      });
+    _leadership_notification
+      = _md_cache.register_leadership_change_notification(
+        [this](model::ntp ntp, model::term_id, std::optional<model::node_id>) {
+            invalidate(ntp);
+        });
+}
+
+metadata_response_cache::~metadata_response_cache() noexcept {
+    _md_cache.unregister_topic_delta_notification(_topic_notification);
+    _md_cache.unregister_leadership_change_notification(
+      _leadership_notification);
+}
+
+void metadata_response_cache::setup_metrics() {
+    namespace sm = ss::metrics;
+
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("kafka:metadata_response_cache"),
+      {
+        sm::make_gauge(
+          "topics",
+          [this] { return _topics.size(); },
+          sm::description("Number of topics with cached metadata responses")),
+        sm::make_gauge(
+          "bytes",
+          [this] { return _size_bytes; },
+          sm::description("Size of the cached encoded topic metadata")),
+        sm::make_counter(
+          "hits",
+          [this] { return _hits; },
+          sm::description("Topic metadata responses served from the cache")),
+        sm::make_counter(
+          "misses",
+          [this] { return _misses; },
+          sm::description("Topic metadata responses built from the topic and "
+                          "leaders tables")),
+        sm::make_counter(
+          "invalidations",
+          [this] { return _invalidations; },
+          sm::description("Cached topic metadata responses dropped because "
+                          "the topic or its leadership changed")),
+      });
+}
+
+std::optional<encoded_fragment>
+metadata_response_cache::get(const model::topic& topic, api_version version) {
+    auto it = _topics.find(topic);
+    if (it != _topics.end()) {
+        for (const auto& fragment : it->second) {
+            if (fragment.has_version(version)) {
+                ++_hits;
+                return fragment;
+            }
+        }
+    }
+    ++_misses;
+    return std::nullopt;
+}
+
+encoded_fragment metadata_response_cache::put(
+  model::topic topic,
+  api_version version,
+  metadata_response::topic& response) {
+    iobuf buf;
+    response_writer writer(buf);
+    response.encode(writer, version);
+    encoded_fragment fragment(version, std::move(buf));
+    _size_bytes += fragment.size_bytes();
+    _topics[std::move(topic)].push_back(fragment);
+    return fragment;
+}
+
+void metadata_response_cache::on_topic_deltas(
+  std::span<const cluster::topic_table_delta> deltas) {
+    for (const auto& d : deltas) {
+        invalidate(d.ntp);
+    }
+}
+
+void metadata_response_cache::invalidate(const model::ntp& ntp) {
+    if (ntp.ns != model::kafka_namespace) {
+        return;
+    }
+    auto it = _topics.find(ntp.tp.topic);
+    if (it == _topics.end()) {
+        return;
+    }
+    for (const auto& fragment : it->second) {
+        _size_bytes -= fragment.size_bytes();
+    }
+    _topics.erase(it);
+    ++_invalidations;
+}
+
+} // namespace kafka
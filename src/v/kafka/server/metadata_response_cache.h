@@ -0,0 +1,82 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "cluster/fwd.h"
+#include "cluster/types.h"
+#include "kafka/protocol/encoded_fragment.h"
+#include "kafka/protocol/metadata.h"
+#include "model/fundamental.h"
+#include "seastarx.h"
+
+#include <seastar/core/metrics_registration.hh>
+
+#include <absl/container/node_hash_map.h>
+
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace kafka {
+
+/**
+ * Shard local cache of the encoded topic part of metadata responses.
+ *
+ * Building a topic response looks up the leader of every partition and
+ * encoding it writes every replica of every partition, which dominates the
+ * cost of metadata requests listing thousands of topics. The cache keeps the
+ * topic responses built for non isolated nodes, encoded once per api version,
+ * and responses append zero copy references to them. A topic is dropped as
+ * soon as the topic table reports a delta for it or the leadership of one of
+ * its partitions changes. Responses including the authorized operations of
+ * a topic are not cached.
+ */
+class metadata_response_cache {
+public:
+    explicit metadata_response_cache(cluster::metadata_cache&);
+    metadata_response_cache(const metadata_response_cache&) = delete;
+    metadata_response_cache& operator=(const metadata_response_cache&)
+      = delete;
+    metadata_response_cache(metadata_response_cache&&) = delete;
+    metadata_response_cache& operator=(metadata_response_cache&&) = delete;
+    ~metadata_response_cache() noexcept;
+
+    void setup_metrics();
+
+    /// Encoded response of a topic in the kafka namespace, if present
+    std::optional<encoded_fragment> get(const model::topic&, api_version);
+
+    /// Encodes the topic response for the api version and caches it
+    encoded_fragment
+    put(model::topic, api_version, metadata_response::topic& response);
+
+    /// Number of cached topics
+    size_t size() const { return _topics.size(); }
+
+private:
+    void on_topic_deltas(std::span<const cluster::topic_table_delta>);
+    void invalidate(const model::ntp&);
+
+    cluster::metadata_cache& _md_cache;
+    cluster::notification_id_type _topic_notification;
+    cluster::notification_id_type _leadership_notification;
+    /// Encodings of a topic response, one per api version
+    absl::node_hash_map<model::topic, std::vector<encoded_fragment>> _topics;
+    size_t _size_bytes{0};
+
+    uint64_t _hits{0};
+    uint64_t _misses{0};
+    uint64_t _invalidations{0};
+    ss::metrics::metric_groups _metrics;
+};
+
+} // namespace kafka
@@ -19,8 +19,10 @@
 #include "storage/translating_reader.h"
 #include "storage/types.h"
 
+#include <chrono>
 #include <optional>
 #include <system_error>
+#include <vector>
 
 namespace kafka {
 
@@ -58,6 +60,9 @@ public:
           validate_fetch_offset(model::offset, model::timeout_clock::time_point)
           = 0;
         virtual cluster::partition_probe& probe() = 0;
+        virtual bool
+          may_serve_follower_reads(std::chrono::milliseconds) const = 0;
+        virtual std::vector<model::node_id> in_sync_followers() const = 0;
         virtual ~impl() noexcept = default;
     };
 
@@ -102,6 +107,19 @@ public:
 
     cluster::partition_probe& probe() { return _impl->probe(); }
 
+    /// True if this replica is a follower which recently heard from the
+    /// leader and may serve consumer fetches up to its high watermark
+    bool
+    may_serve_follower_reads(std::chrono::milliseconds max_staleness) const {
+        return _impl->may_serve_follower_reads(max_staleness);
+    }
+
+    /// Followers which are live and caught up with the leader, only
+    /// available on the leader
+    std::vector<model::node_id> in_sync_followers() const {
+        return _impl->in_sync_followers();
+    }
+
     kafka::leader_epoch leader_epoch() const { return _impl->leader_epoch(); }
 
     std::optional<model::offset>
@@ -29,4 +29,8 @@ ss::future<std::optional<request_header>> parse_header(ss::input_stream<char>&);
 
 ss::scattered_message<char> response_as_scattered(response_ptr response);
 
+/// Appends the framed response to \p msg so that several responses can be
+/// sent with a single write. Returns the number of fragments appended.
+size_t append_response(ss::scattered_message<char>& msg, response_ptr response);
+
 } // namespace kafka
@@ -305,6 +305,32 @@ std::optional<model::offset> replicated_partition::get_leader_epoch_last_offset(
     return _translator->from_log_offset(first_local_offset);
 }
 
+bool replicated_partition::may_serve_follower_reads(
+  std::chrono::milliseconds max_staleness) const {
+    if (
+      _partition->is_leader() || _partition->is_read_replica_mode_enabled()
+      || !_partition->get_leader_id()) {
+        return false;
+    }
+    /**
+     * Follower high watermark is only updated with requests coming from the
+     * leader, bound the staleness of data served by follower by the time
+     * elapsed since the last leader request.
+     */
+    return raft::clock_type::now() - _partition->raft()->last_heartbeat()
+           <= max_staleness;
+}
+
+std::vector<model::node_id> replicated_partition::in_sync_followers() const {
+    std::vector<model::node_id> ret;
+    for (const auto& f : _partition->raft()->get_follower_metrics()) {
+        if (f.is_live && !f.under_replicated && !f.is_learner) {
+            ret.push_back(f.id);
+        }
+    }
+    return ret;
+}
+
 ss::future<error_code> replicated_partition::validate_fetch_offset(
   model::offset fetch_offset, model::timeout_clock::time_point deadline) {
     /**
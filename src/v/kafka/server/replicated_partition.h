@@ -88,6 +88,10 @@ public:
 
     bool is_leader() const final { return _partition->is_leader(); }
 
+    bool may_serve_follower_reads(std::chrono::milliseconds) const final;
+
+    std::vector<model::node_id> in_sync_followers() const final;
+
     ss::future<std::error_code> linearizable_barrier() final {
         auto r = co_await _partition->linearizable_barrier();
         if (r) {
@@ -152,6 +152,10 @@ public:
         return _conn->server().get_fetch_metadata_cache();
     }
 
+    kafka::metadata_response_cache& metadata_response_cache() {
+        return _conn->server().metadata_response_cache();
+    }
+
     template<typename ResponseType>
     requires requires(
       ResponseType r, response_writer& writer, api_version version) {
@@ -240,4 +244,8 @@ process_result_stages process_request(
 
 bool track_latency(api_key);
 
+// Requests without side effects that later requests of the same connection
+// could observe, which may therefore be processed concurrently with them.
+bool is_pipelinable(api_key);
+
 } // namespace kafka
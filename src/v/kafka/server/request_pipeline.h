@@ -0,0 +1,77 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "seastarx.h"
+#include "ssx/semaphore.h"
+
+#include <seastar/core/coroutine.hh>
+
+#include <cstdint>
+
+namespace kafka {
+
+/*
+ * Bounds and orders the requests of a single connection which are processed
+ * concurrently with the requests that follow them (see is_pipelinable()).
+ *
+ * A pipelined request holds a slot until its response is written. A request
+ * with side effects drains the pipeline before it is processed, so the
+ * requests received before it can't observe its effects. Responses are
+ * sequenced separately by the connection.
+ */
+class request_pipeline {
+public:
+    struct units {
+        ssx::semaphore_units slot;
+        ssx::semaphore_units order;
+    };
+
+    explicit request_pipeline(uint32_t max_pipelined)
+      : _max_pipelined(max_pipelined)
+      , _slots(max_pipelined, "k/pipeline")
+      , _order(1, "k/pipeline-order") {}
+
+    bool enabled() const { return _max_pipelined > 0; }
+
+    /// Reserve a slot for a pipelined request. Requests which share state
+    /// (the fetches of a connection share a fetch session) are 'serialized'
+    /// among themselves.
+    ss::future<units> reserve(bool serialized) {
+        units u;
+        if (serialized) {
+            u.order = co_await ss::get_units(_order, 1);
+        }
+        u.slot = co_await ss::get_units(_slots, 1);
+        co_return u;
+    }
+
+    /// Wait until all pipelined requests received so far are complete
+    ss::future<> drain() {
+        if (in_flight() == 0) {
+            co_return;
+        }
+        co_await ss::get_units(_slots, _max_pipelined);
+    }
+
+    /// Number of pipelined requests which are not complete yet
+    size_t in_flight() const {
+        return _max_pipelined - static_cast<size_t>(_slots.available_units());
+    }
+
+private:
+    const uint32_t _max_pipelined;
+    ssx::semaphore _slots;
+    ssx::semaphore _order;
+};
+
+} // namespace kafka
@@ -8,7 +8,14 @@
 // by the Apache License, Version 2.0
 
 #include "kafka/protocol/schemata/api_versions_request.h"
+#include "kafka/protocol/schemata/describe_acls_request.h"
+#include "kafka/protocol/schemata/describe_configs_request.h"
+#include "kafka/protocol/schemata/describe_groups_request.h"
+#include "kafka/protocol/schemata/describe_log_dirs_request.h"
 #include "kafka/protocol/schemata/fetch_request.h"
+#include "kafka/protocol/schemata/list_groups_request.h"
+#include "kafka/protocol/schemata/list_offset_request.h"
+#include "kafka/protocol/schemata/metadata_request.h"
 #include "kafka/protocol/schemata/produce_request.h"
 #include "kafka/server/connection_context.h"
 #include "kafka/server/handlers/api_versions.h"
@@ -245,6 +252,22 @@ bool track_latency(api_key key) {
     }
 }
 
+bool is_pipelinable(api_key key) {
+    switch (key) {
+    // metadata isn't here because it may auto create topics
+    case fetch_api::key:
+    case list_offsets_api::key:
+    case describe_configs_api::key:
+    case describe_groups_api::key:
+    case list_groups_api::key:
+    case describe_acls_api::key:
+    case describe_log_dirs_api::key:
+        return true;
+    default:
+        return false;
+    }
+}
+
 process_result_stages process_request(
   request_context&& ctx,
   ss::smp_service_group g,
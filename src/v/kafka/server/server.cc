@@ -121,12 +121,18 @@ server::server(
   , _gssapi_principal_mapper(
       config::shard_local_cfg().sasl_kerberos_principal_mapping.bind())
   , _krb_configurator(config::shard_local_cfg().sasl_kerberos_config.bind())
+  , _shard_affinity_probe(
+      config::shard_local_cfg().kafka_shard_affinity_tracking_enable())
+  , _metadata_response_cache(meta.local())
   , _thread_worker(tw) {
     if (qdc_config) {
         _qdc_mon.emplace(*qdc_config);
     }
     _probe.setup_metrics();
     _probe.setup_public_metrics();
+    _shard_affinity_probe.setup_metrics();
+    _load_shedder.setup_metrics();
+    _metadata_response_cache.setup_metrics();
 }
 
 coordinator_ntp_mapper& server::coordinator_mapper() {
@@ -18,7 +18,10 @@
 #include "kafka/latency_probe.h"
 #include "kafka/server/fetch_metadata_cache.hh"
 #include "kafka/server/fwd.h"
+#include "kafka/server/load_shedder.h"
+#include "kafka/server/metadata_response_cache.h"
 #include "kafka/server/queue_depth_monitor.h"
+#include "kafka/server/shard_affinity.h"
 #include "net/server.h"
 #include "security/fwd.h"
 #include "security/gssapi_principal_mapper.h"
@@ -142,6 +145,16 @@ public:
 
     latency_probe& latency_probe() { return _probe; }
 
+    shard_affinity_probe& shard_affinity_probe() {
+        return _shard_affinity_probe;
+    }
+
+    load_shedder& load_shedder() { return _load_shedder; }
+
+    metadata_response_cache& metadata_response_cache() {
+        return _metadata_response_cache;
+    }
+
     ssx::thread_worker& thread_worker() { return _thread_worker; }
 
 private:
@@ -172,6 +185,9 @@ private:
     security::krb5::configurator _krb_configurator;
 
     class latency_probe _probe;
+    class shard_affinity_probe _shard_affinity_probe;
+    class load_shedder _load_shedder;
+    class metadata_response_cache _metadata_response_cache;
     ssx::thread_worker& _thread_worker;
 };
 
@@ -0,0 +1,99 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/server/shard_affinity.h"
+
+#include "config/configuration.h"
+#include "kafka/server/logger.h"
+#include "prometheus/prometheus_sanitize.h"
+#include "vlog.h"
+
+#include <seastar/core/metrics.hh>
+
+#include <algorithm>
+
+namespace kafka {
+
+void shard_affinity_probe::setup_metrics() {
+    namespace sm = ss::metrics;
+
+    if (!_enabled || config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("kafka:shard_affinity"),
+      {
+        sm::make_counter(
+          "partition_accesses",
+          [this] { return _partition_accesses; },
+          sm::description(
+            "Measured partition accesses of produce and fetch requests")),
+        sm::make_counter(
+          "cross_shard_accesses",
+          [this] { return _cross_shard_accesses; },
+          sm::description("Measured partition accesses to a partition owned "
+                          "by a shard other than the connection shard")),
+        sm::make_counter(
+          "settled_partition_accesses",
+          [this] { return _settled_partition_accesses; },
+          sm::description("Measured partition accesses of connections with a "
+                          "learned preferred shard")),
+        sm::make_counter(
+          "settled_cross_shard_accesses",
+          [this] { return _settled_cross_shard_accesses; },
+          sm::description("Measured partition accesses of connections with a "
+                          "learned preferred shard to a partition owned by "
+                          "another shard than the preferred one")),
+        sm::make_counter(
+          "settled_connections",
+          [this] { return _settled_connections; },
+          sm::description("Connections that learned their preferred shard")),
+        sm::make_counter(
+          "remote_preferred_connections",
+          [this] { return _remote_preferred_connections; },
+          sm::description("Connections whose measured preferred shard is not "
+                          "the shard handling them")),
+      });
+}
+
+void shard_affinity_tracker::do_record(ss::shard_id owner) {
+    _probe.partition_access(owner != ss::this_shard_id());
+    if (_preferred) {
+        _probe.settled_partition_access(owner != *_preferred);
+        return;
+    }
+    if (_accesses.empty()) {
+        _accesses.resize(_shard_count, 0);
+    }
+    ++_accesses[owner];
+    if (++_sampled >= sample_size) {
+        settle();
+    }
+}
+
+void shard_affinity_tracker::settle() {
+    auto it = std::max_element(_accesses.begin(), _accesses.end());
+    _preferred = static_cast<ss::shard_id>(
+      std::distance(_accesses.begin(), it));
+    const auto prefers_remote_shard = *_preferred != ss::this_shard_id();
+    _probe.connection_settled(prefers_remote_shard);
+    if (prefers_remote_shard) {
+        vlog(
+          klog.debug,
+          "connection prefers shard {}: {} of {} sampled partition accesses "
+          "(local: {})",
+          *_preferred,
+          *it,
+          _sampled,
+          _accesses[ss::this_shard_id()]);
+    }
+    _accesses = {};
+}
+
+} // namespace kafka
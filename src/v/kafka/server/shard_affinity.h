@@ -0,0 +1,115 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "seastarx.h"
+
+#include <seastar/core/metrics_registration.hh>
+#include <seastar/core/smp.hh>
+
+#include <optional>
+#include <vector>
+
+namespace kafka {
+
+/**
+ * Per shard counters of partition accesses made by produce and fetch
+ * requests, collected only when kafka_shard_affinity_tracking_enable is set.
+ * An access is cross shard when the partition is owned by a shard other than
+ * the one handling the connection. Once a connection has learned its
+ * preferred shard, its accesses are also classified against that shard. The
+ * counters only measure the cross core traffic, nothing acts on them.
+ */
+class shard_affinity_probe {
+public:
+    explicit shard_affinity_probe(bool enabled)
+      : _enabled(enabled) {}
+
+    bool enabled() const { return _enabled; }
+
+    void partition_access(bool cross_shard) {
+        ++_partition_accesses;
+        if (cross_shard) {
+            ++_cross_shard_accesses;
+        }
+    }
+
+    void settled_partition_access(bool cross_shard_from_preferred) {
+        ++_settled_partition_accesses;
+        if (cross_shard_from_preferred) {
+            ++_settled_cross_shard_accesses;
+        }
+    }
+
+    void connection_settled(bool prefers_remote_shard) {
+        ++_settled_connections;
+        if (prefers_remote_shard) {
+            ++_remote_preferred_connections;
+        }
+    }
+
+    void setup_metrics();
+
+private:
+    bool _enabled;
+    uint64_t _partition_accesses{0};
+    uint64_t _cross_shard_accesses{0};
+    uint64_t _settled_partition_accesses{0};
+    uint64_t _settled_cross_shard_accesses{0};
+    uint64_t _settled_connections{0};
+    uint64_t _remote_preferred_connections{0};
+    ss::metrics::metric_groups _metrics;
+};
+
+/**
+ * Learns which shard owns most of the partitions a connection touches. The
+ * first sample_size partition accesses of the connection are counted per
+ * owning shard, after which the connection settles on the shard with the
+ * most accesses.
+ *
+ * The tracker only measures: connections are not moved to their preferred
+ * shard, a seastar socket is bound to the reactor which accepted it.
+ */
+class shard_affinity_tracker {
+public:
+    static constexpr uint32_t sample_size = 256;
+
+    explicit shard_affinity_tracker(
+      shard_affinity_probe& probe, size_t shard_count = ss::smp::count)
+      : _probe(probe)
+      , _shard_count(shard_count) {}
+
+    /// records an access to a partition owned by the given shard, does
+    /// nothing unless the probe is enabled
+    void record(ss::shard_id owner) {
+        if (_probe.enabled()) {
+            do_record(owner);
+        }
+    }
+
+    /// the shard owning most of the sampled partitions, once settled
+    std::optional<ss::shard_id> preferred_shard() const {
+        return _preferred;
+    }
+
+private:
+    void do_record(ss::shard_id owner);
+    void settle();
+
+    shard_affinity_probe& _probe;
+    size_t _shard_count;
+    std::vector<uint32_t> _accesses;
+    uint32_t _sampled{0};
+    std::optional<ss::shard_id> _preferred;
+};
+
+} // namespace kafka
@@ -206,6 +206,57 @@ FIXTURE_TEST(read_from_ntp_max_bytes, redpanda_thread_fixture) {
     BOOST_TEST(one <= maxlimit); // read more
 }
 
+FIXTURE_TEST(read_from_ntp_at_high_watermark, redpanda_thread_fixture) {
+    auto do_read = [this](model::ntp ntp, model::offset start_offset) {
+        kafka::fetch_config config{
+          .start_offset = start_offset,
+          .max_offset = model::model_limits<model::offset>::max(),
+          .isolation_level = model::isolation_level::read_uncommitted,
+          .max_bytes = std::numeric_limits<size_t>::max(),
+          .timeout = model::no_timeout,
+        };
+        auto rctx = make_request_context();
+        auto octx = kafka::op_context(
+          std::move(rctx), ss::default_smp_service_group());
+        auto shard = octx.rctx.shards().shard_for(ntp).value();
+        return octx.rctx.partition_manager()
+          .invoke_on(
+            shard,
+            [&octx, ntp, config](cluster::partition_manager& pm) {
+                return kafka::read_from_ntp(
+                  pm,
+                  octx.rctx.coproc_partition_manager().local(),
+                  ntp,
+                  config,
+                  true,
+                  model::no_timeout);
+            })
+          .get0();
+    };
+    wait_for_controller_leadership().get0();
+    auto ntp = make_data(get_next_partition_revision_id().get());
+
+    auto shard = app.shard_table.local().shard_for(ntp);
+    tests::cooperative_spin_wait_with_timeout(10s, [this, shard, ntp = ntp] {
+        return app.partition_manager.invoke_on(
+          *shard, [ntp](cluster::partition_manager& mgr) {
+              auto partition = mgr.get(ntp);
+              return partition
+                     && partition->last_stable_offset() >= model::offset(1);
+          });
+    }).get();
+
+    auto all = do_read(ntp, model::offset(0));
+    BOOST_REQUIRE_EQUAL(all.error, kafka::error_code::none);
+    BOOST_REQUIRE(all.has_data());
+
+    // caught up consumer, nothing to read at the high watermark
+    auto caught_up = do_read(ntp, all.high_watermark);
+    BOOST_REQUIRE_EQUAL(caught_up.error, kafka::error_code::none);
+    BOOST_REQUIRE(!caught_up.has_data());
+    BOOST_REQUIRE_EQUAL(caught_up.high_watermark, all.high_watermark);
+}
+
 FIXTURE_TEST(fetch_one, redpanda_thread_fixture) {
     wait_for_controller_leadership().get0();
 
@@ -0,0 +1,75 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/protocol/fetch.h"
+#include "kafka/protocol/metadata.h"
+#include "kafka/protocol/produce.h"
+#include "kafka/server/load_shedder.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+#include <chrono>
+
+using namespace std::chrono_literals;
+using shedder = kafka::load_shedder;
+using state = shedder::state;
+
+static constexpr auto zero = shedder::clock::duration::zero();
+
+SEASTAR_THREAD_TEST_CASE(test_load_shedder_evaluate) {
+    // disabled shedder never leaves the normal state
+    BOOST_REQUIRE_EQUAL(
+      shedder::evaluate(false, 1.0, 0.9, 1000, 50ms), state::normal);
+
+    // below the utilization threshold the latency doesn't matter
+    BOOST_REQUIRE_EQUAL(
+      shedder::evaluate(true, 0.89, 0.9, 1000, 50ms), state::normal);
+
+    // saturated, tasks still run on time
+    BOOST_REQUIRE_EQUAL(
+      shedder::evaluate(true, 0.9, 0.9, 10, 50ms), state::throttling);
+
+    // saturated and tasks are late
+    BOOST_REQUIRE_EQUAL(
+      shedder::evaluate(true, 0.95, 0.9, 50, 50ms), state::shedding);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_load_shedder_delays) {
+    const auto throttle
+      = std::chrono::duration_cast<shedder::clock::duration>(100ms);
+    auto delays = [throttle](state s, kafka::api_key key) {
+        return shedder::delays_for(s, key, throttle);
+    };
+
+    BOOST_REQUIRE(shedder::is_low_priority(kafka::metadata_api::key));
+    BOOST_REQUIRE(!shedder::is_low_priority(kafka::produce_api::key));
+    BOOST_REQUIRE(!shedder::is_low_priority(kafka::fetch_api::key));
+
+    // nothing is delayed in the normal state
+    auto d = delays(state::normal, kafka::metadata_api::key);
+    BOOST_REQUIRE(d.request == zero);
+    BOOST_REQUIRE(d.enforce == zero);
+
+    // throttling only asks the client to back off
+    d = delays(state::throttling, kafka::metadata_api::key);
+    BOOST_REQUIRE(d.request == throttle);
+    BOOST_REQUIRE(d.enforce == zero);
+
+    // shedding also holds the request in the broker
+    d = delays(state::shedding, kafka::metadata_api::key);
+    BOOST_REQUIRE(d.request == throttle);
+    BOOST_REQUIRE(d.enforce == throttle);
+
+    // produce and fetch are never delayed
+    for (auto key : {kafka::produce_api::key, kafka::fetch_api::key}) {
+        d = delays(state::shedding, key);
+        BOOST_REQUIRE(d.request == zero);
+        BOOST_REQUIRE(d.enforce == zero);
+    }
+}
@@ -7,8 +7,11 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "kafka/protocol/encoded_fragment.h"
+#include "kafka/protocol/metadata.h"
 #include "kafka/protocol/request_reader.h"
 #include "kafka/protocol/response_writer.h"
+#include "kafka/server/handlers/metadata.h"
 #include "random/generators.h"
 #include "utils/to_string.h"
 
@@ -50,3 +53,73 @@ SEASTAR_THREAD_TEST_CASE(write_and_read_value_test) {
     roundtrip_test(
       model::topic{"test_topic"}, ss::sstring, &request_reader::read_string);
 }
+
+static metadata_response::topic make_metadata_topic(int id) {
+    metadata_response::topic t{
+      .name = model::topic(fmt::format("topic-{}", id)),
+      .topic_authorized_operations = 0};
+    for (int p = 0; p < 3; ++p) {
+        t.partitions.push_back(metadata_response::partition{
+          .partition_index = model::partition_id(p),
+          .leader_id = model::node_id(p),
+          .leader_epoch = kafka::leader_epoch(id),
+          .replica_nodes = {model::node_id(0), model::node_id(1)},
+          .isr_nodes = {model::node_id(0), model::node_id(1)}});
+    }
+    return t;
+}
+
+static iobuf encode_metadata_response(
+  std::vector<metadata_response::topic> topics, api_version version) {
+    metadata_response r;
+    r.data.brokers.push_back(metadata_response::broker{
+      .node_id = model::node_id(0), .host = "localhost", .port = 9092});
+    r.data.cluster_id = "redpanda.test";
+    r.data.controller_id = model::node_id(0);
+    r.data.topics = std::move(topics);
+    iobuf out;
+    response_writer w(out);
+    r.encode(w, version);
+    return out;
+}
+
+SEASTAR_THREAD_TEST_CASE(preencoded_metadata_topic_test) {
+    for (int16_t v = 0; v <= metadata_handler::max_supported(); ++v) {
+        const api_version version(v);
+        BOOST_TEST_CHECKPOINT("metadata response version " << v);
+        auto expected = encode_metadata_response(
+          {make_metadata_topic(0), make_metadata_topic(1)}, version);
+
+        iobuf buf;
+        response_writer w(buf);
+        make_metadata_topic(0).encode(w, version);
+        encoded_fragment fragment(version, std::move(buf));
+        BOOST_REQUIRE(fragment.has_version(version));
+        BOOST_REQUIRE(!fragment.has_version(api_version(v + 1)));
+
+        // the fragment is written in place of the fields and can be shared
+        // by many responses
+        for (int i = 0; i < 2; ++i) {
+            auto encoded = encode_metadata_response(
+              {metadata_response::topic{
+                 .name = model::topic("topic-0"), .encoded = fragment},
+               make_metadata_topic(1)},
+              version);
+            BOOST_REQUIRE_EQUAL(encoded, expected);
+        }
+
+        // a fragment of another version is ignored
+        auto t = make_metadata_topic(0);
+        t.encoded = encoded_fragment(api_version(v + 1), iobuf{});
+        auto encoded = encode_metadata_response(
+          {std::move(t), make_metadata_topic(1)}, version);
+        BOOST_REQUIRE_EQUAL(encoded, expected);
+
+        metadata_response decoded;
+        decoded.decode(std::move(encoded), version);
+        BOOST_REQUIRE_EQUAL(decoded.data.topics.size(), 2);
+        BOOST_REQUIRE_EQUAL(
+          decoded.data.topics[0].name, model::topic("topic-0"));
+        BOOST_REQUIRE_EQUAL(decoded.data.topics[0].partitions.size(), 3);
+    }
+}
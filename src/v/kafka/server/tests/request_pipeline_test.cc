@@ -0,0 +1,101 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/protocol/fetch.h"
+#include "kafka/protocol/list_offsets.h"
+#include "kafka/protocol/metadata.h"
+#include "kafka/protocol/produce.h"
+#include "kafka/server/request_context.h"
+#include "kafka/server/request_pipeline.h"
+
+#include <seastar/core/sleep.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+SEASTAR_THREAD_TEST_CASE(test_pipelinable_requests) {
+    BOOST_REQUIRE(kafka::is_pipelinable(kafka::fetch_api::key));
+    BOOST_REQUIRE(kafka::is_pipelinable(kafka::list_offsets_api::key));
+    // metadata requests may create topics
+    BOOST_REQUIRE(!kafka::is_pipelinable(kafka::metadata_api::key));
+    BOOST_REQUIRE(!kafka::is_pipelinable(kafka::produce_api::key));
+}
+
+SEASTAR_THREAD_TEST_CASE(test_request_pipeline_drain_waits_for_earlier) {
+    kafka::request_pipeline pipeline(4);
+    BOOST_REQUIRE(pipeline.enabled());
+    // Nothing in flight, a request with side effects proceeds immediately
+    BOOST_REQUIRE(pipeline.drain().available());
+
+    auto first = pipeline.reserve(false).get();
+    auto second = pipeline.reserve(false).get();
+    BOOST_REQUIRE_EQUAL(pipeline.in_flight(), 2);
+
+    auto drained = pipeline.drain();
+    ss::sleep(10ms).get();
+    BOOST_REQUIRE(!drained.available());
+
+    first = {};
+    ss::sleep(10ms).get();
+    BOOST_REQUIRE(!drained.available());
+
+    second = {};
+    drained.get();
+    BOOST_REQUIRE_EQUAL(pipeline.in_flight(), 0);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_request_pipeline_later_requests_wait_for_drain) {
+    kafka::request_pipeline pipeline(2);
+    auto in_flight = pipeline.reserve(false).get();
+
+    // A request received after the request with side effects is only
+    // admitted once the earlier requests are complete.
+    auto drained = pipeline.drain();
+    auto next = pipeline.reserve(false);
+    ss::sleep(10ms).get();
+    BOOST_REQUIRE(!drained.available());
+    BOOST_REQUIRE(!next.available());
+
+    in_flight = {};
+    drained.get();
+    next.get();
+}
+
+SEASTAR_THREAD_TEST_CASE(test_request_pipeline_serialized_and_bounded) {
+    kafka::request_pipeline pipeline(2);
+
+    // Serialized requests don't overlap
+    auto fetch = pipeline.reserve(true).get();
+    auto next_fetch = pipeline.reserve(true);
+    ss::sleep(10ms).get();
+    BOOST_REQUIRE(!next_fetch.available());
+
+    // Other requests are not blocked by the serialized ones
+    auto other = pipeline.reserve(false).get();
+
+    // The number of requests in flight is bounded
+    auto over_limit = pipeline.reserve(false);
+    ss::sleep(10ms).get();
+    BOOST_REQUIRE(!over_limit.available());
+
+    fetch = {};
+    auto second_fetch = next_fetch.get();
+    BOOST_REQUIRE(!over_limit.available());
+
+    other = {};
+    over_limit.get();
+}
+
+SEASTAR_THREAD_TEST_CASE(test_request_pipeline_disabled) {
+    kafka::request_pipeline pipeline(0);
+    BOOST_REQUIRE(!pipeline.enabled());
+    BOOST_REQUIRE(pipeline.drain().available());
+}
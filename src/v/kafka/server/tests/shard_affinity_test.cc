@@ -0,0 +1,64 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/server/shard_affinity.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+SEASTAR_THREAD_TEST_CASE(test_shard_affinity_not_settled_before_sample) {
+    kafka::shard_affinity_probe probe(true);
+    kafka::shard_affinity_tracker tracker(probe, 4);
+
+    for (uint32_t i = 0; i < kafka::shard_affinity_tracker::sample_size - 1;
+         ++i) {
+        tracker.record(2);
+    }
+    BOOST_REQUIRE(!tracker.preferred_shard().has_value());
+
+    tracker.record(2);
+    BOOST_REQUIRE_EQUAL(tracker.preferred_shard().value(), 2);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_shard_affinity_settles_on_most_accessed) {
+    kafka::shard_affinity_probe probe(true);
+    kafka::shard_affinity_tracker tracker(probe, 4);
+
+    const auto sample = kafka::shard_affinity_tracker::sample_size;
+    for (uint32_t i = 0; i < sample; ++i) {
+        // shard 3 owns half of the partitions, the rest is spread
+        tracker.record(i % 2 == 0 ? 3 : i % 3);
+    }
+    BOOST_REQUIRE_EQUAL(tracker.preferred_shard().value(), 3);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_shard_affinity_sticky_once_settled) {
+    kafka::shard_affinity_probe probe(true);
+    kafka::shard_affinity_tracker tracker(probe, 4);
+
+    const auto sample = kafka::shard_affinity_tracker::sample_size;
+    for (uint32_t i = 0; i < sample; ++i) {
+        tracker.record(1);
+    }
+    // later accesses are only classified, they don't move the preference
+    for (uint32_t i = 0; i < 2 * sample; ++i) {
+        tracker.record(0);
+    }
+    BOOST_REQUIRE_EQUAL(tracker.preferred_shard().value(), 1);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_shard_affinity_disabled) {
+    kafka::shard_affinity_probe probe(false);
+    kafka::shard_affinity_tracker tracker(probe, 4);
+
+    for (uint32_t i = 0; i < kafka::shard_affinity_tracker::sample_size;
+         ++i) {
+        tracker.record(2);
+    }
+    BOOST_REQUIRE(!tracker.preferred_shard().has_value());
+}
@@ -169,6 +169,43 @@ FIXTURE_TEST(test_topic_recreation, recreate_test_fixture) {
     }).get0();
 }
 
+FIXTURE_TEST(test_recreated_topic_metadata_is_not_stale, recreate_test_fixture) {
+    wait_for_controller_leadership().get();
+    model::topic test_tp{"topic-1"};
+
+    auto wait_for_partitions_with_leader = [this, test_tp](size_t expected) {
+        tests::cooperative_spin_wait_with_timeout(
+          3s,
+          [this, test_tp, expected] {
+              return get_topic_metadata(test_tp).then(
+                [expected](kafka::metadata_response md) {
+                    if (md.data.topics.size() != 1) {
+                        return false;
+                    }
+                    auto& partitions = md.data.topics.begin()->partitions;
+                    return partitions.size() == expected
+                           && std::all_of(
+                             partitions.begin(),
+                             partitions.end(),
+                             [](kafka::metadata_response::partition& p) {
+                                 return p.leader_id == model::node_id{1};
+                             });
+                });
+          })
+          .get0();
+    };
+
+    create_topic(test_tp(), 6, 1);
+    wait_for_partitions_with_leader(6);
+
+    delete_topics({test_tp});
+    wait_until_topic_status(
+      test_tp, kafka::error_code::unknown_topic_or_partition)
+      .get0();
+    create_topic(test_tp(), 3, 1);
+    wait_for_partitions_with_leader(3);
+}
+
 FIXTURE_TEST(test_topic_recreation_recovery, recreate_test_fixture) {
     wait_for_controller_leadership().get();
     model::topic test_tp{"topic-1"};
@@ -14,6 +14,7 @@
 #include "vassert.h"
 
 #include <seastar/core/future.hh>
+#include <seastar/core/later.hh>
 #include <seastar/core/scattered_message.hh>
 
 #include <fmt/format.h>
@@ -21,10 +22,11 @@
 namespace net {
 
 batched_output_stream::batched_output_stream(
-  ss::output_stream<char> o, size_t cache)
+  ss::output_stream<char> o, size_t cache, cork_flush cork)
   : _out(std::move(o))
   , _cache_size(cache)
-  , _write_sem(std::make_unique<ssx::semaphore>(1, "net/batch-ostream")) {
+  , _write_sem(std::make_unique<ssx::semaphore>(1, "net/batch-ostream"))
+  , _cork(cork) {
     // Size zero reserved for identifying default-initialized
     // instances in stop()
     vassert(_cache_size > 0, "Size must be > 0");
@@ -41,21 +43,49 @@ ss::future<bool> batched_output_stream::write(ss::scattered_message<char> msg) {
         return already_closed_error(msg);
     }
     return ss::with_semaphore(
-      *_write_sem, 1, [this, v = std::move(msg)]() mutable {
-          if (unlikely(_closed)) {
-              return already_closed_error(v);
+             *_write_sem,
+             1,
+             [this, v = std::move(msg)]() mutable {
+                 if (unlikely(_closed)) {
+                     return already_closed_error(v).then(to_outcome);
+                 }
+                 const size_t vbytes = v.size();
+                 return _out.write(std::move(v)).then([this, vbytes] {
+                     _unflushed_bytes += vbytes;
+                     if (
+                       _cork && _write_sem->waiters() == 0
+                       && _unflushed_bytes < _cache_size) {
+                         return ss::make_ready_future<flush_outcome>(
+                           flush_outcome::deferred);
+                     }
+                     return maybe_flush().then(to_outcome);
+                 });
+             })
+      .then([this](flush_outcome outcome) {
+          if (outcome != flush_outcome::deferred) {
+              return ss::make_ready_future<bool>(
+                outcome == flush_outcome::flushed);
           }
-          const size_t vbytes = v.size();
-          return _out.write(std::move(v)).then([this, vbytes] {
-              _unflushed_bytes += vbytes;
-              if (
-                _write_sem->waiters() == 0 || _unflushed_bytes >= _cache_size) {
-                  return do_flush().then([] { return true; });
-              }
-              return ss::make_ready_future<bool>(false);
-          });
+          // Let the writers that become ready in this poll cycle queue up
+          // behind us before flushing. The lock is not held while yielding,
+          // a writer which gets it in the meantime takes over the flush.
+          return ss::yield().then([this] { return deferred_flush(); });
       });
 }
+ss::future<bool> batched_output_stream::deferred_flush() {
+    return ss::with_semaphore(*_write_sem, 1, [this] {
+        if (_closed || _unflushed_bytes == 0) {
+            return ss::make_ready_future<bool>(false);
+        }
+        return maybe_flush();
+    });
+}
+ss::future<bool> batched_output_stream::maybe_flush() {
+    if (_write_sem->waiters() == 0 || _unflushed_bytes >= _cache_size) {
+        return do_flush().then([] { return true; });
+    }
+    return ss::make_ready_future<bool>(false);
+}
 ss::future<> batched_output_stream::do_flush() {
     if (_unflushed_bytes == 0) {
         return ss::make_ready_future<>();
@@ -15,6 +15,7 @@
 #include "ssx/semaphore.h"
 
 #include <seastar/core/iostream.hh>
+#include <seastar/util/bool_class.hh>
 
 #include <cstddef>
 #include <memory>
@@ -43,14 +44,24 @@ private:
  * flushes when multiple writes are in progress on the stream: a flush occurs
  * only when the last pending writer completes or when a configured amount of
  * unflushed bytes have accumulated.
+ *
+ * A corked stream additionally defers the flush of the last pending writer
+ * until the tasks that are already runnable on the reactor have run, so that
+ * replies completing in the same poll cycle are coalesced into a single
+ * writev instead of one syscall each. The write lock is released before
+ * deferring, the flush is done by whichever writer holds it last.
  */
 class batched_output_stream {
 public:
+    using cork_flush = ss::bool_class<struct cork_flush_tag>;
+
     static constexpr size_t default_max_unflushed_bytes = 1024 * 1024;
 
     batched_output_stream() = default;
     explicit batched_output_stream(
-      ss::output_stream<char>, size_t cache = default_max_unflushed_bytes);
+      ss::output_stream<char>,
+      size_t cache = default_max_unflushed_bytes,
+      cork_flush cork = cork_flush::no);
     ~batched_output_stream() noexcept = default;
     // NOTE: explicitly defined for a gcc
     batched_output_stream(batched_output_stream&& o) noexcept
@@ -58,7 +69,8 @@ public:
       , _cache_size(o._cache_size)
       , _write_sem(std::move(o._write_sem))
       , _unflushed_bytes(o._unflushed_bytes)
-      , _closed(o._closed) {}
+      , _closed(o._closed)
+      , _cork(o._cork) {}
     batched_output_stream& operator=(batched_output_stream&& o) noexcept {
         if (this != &o) {
             this->~batched_output_stream();
@@ -91,12 +103,21 @@ public:
     bool is_valid() const noexcept { return _cache_size != 0; }
 
 private:
+    enum class flush_outcome { not_flushed, flushed, deferred };
+    static flush_outcome to_outcome(bool flushed) {
+        return flushed ? flush_outcome::flushed : flush_outcome::not_flushed;
+    }
+
     ss::future<> do_flush();
+    ss::future<bool> maybe_flush();
+    /// flush of a corked write, taken after the writer released the lock
+    ss::future<bool> deferred_flush();
 
     ss::output_stream<char> _out;
     size_t _cache_size{0};
     std::unique_ptr<ssx::semaphore> _write_sem;
     size_t _unflushed_bytes{0};
     bool _closed = false;
+    cork_flush _cork{cork_flush::no};
 };
 } // namespace net
@@ -53,6 +53,8 @@ public:
 
     void connection_closed() { --_connections; }
 
+    void tls_session_resumed() { ++_tls_sessions_resumed; }
+
     void connection_error(const std::exception_ptr& e) {
         rpc::rpclog.trace("Connection error: {}", e);
         ++_connection_errors;
@@ -90,6 +92,7 @@ private:
     uint32_t _server_correlation_errors = 0;
     uint32_t _client_correlation_errors = 0;
     uint32_t _requests_blocked_memory = 0;
+    uint64_t _tls_sessions_resumed = 0;
     ss::metrics::metric_groups _metrics;
 
     friend std::ostream& operator<<(std::ostream& o, const client_probe& p);
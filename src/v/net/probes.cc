@@ -263,6 +263,13 @@ void client_probe::setup_metrics(
                           " of insufficient memory"),
           labels)
           .aggregate(aggregate_labels),
+        sm::make_counter(
+          "tls_sessions_resumed",
+          [this] { return _tls_sessions_resumed; },
+          sm::description("Number of TLS connections that resumed a previous "
+                          "session instead of a full handshake"),
+          labels)
+          .aggregate(aggregate_labels),
       });
 }
 
@@ -280,7 +287,8 @@ std::ostream& operator<<(std::ostream& o, const client_probe& p) {
       << ", corrupted_headers: " << p._corrupted_headers
       << ", server_correlation_errors: " << p._server_correlation_errors
       << ", client_correlation_errors: " << p._client_correlation_errors
-      << ", requests_blocked_memory: " << p._requests_blocked_memory << " }";
+      << ", requests_blocked_memory: " << p._requests_blocked_memory
+      << ", tls_sessions_resumed: " << p._tls_sessions_resumed << " }";
     return o;
 }
 } // namespace net
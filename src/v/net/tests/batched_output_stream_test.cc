@@ -0,0 +1,148 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "net/batched_output_stream.h"
+#include "seastarx.h"
+
+#include <seastar/core/iostream.hh>
+#include <seastar/core/when_all.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+struct sink_stats {
+    size_t bytes{0};
+    size_t flushes{0};
+    bool closed{false};
+};
+
+// Counts the bytes and the flushes which reach the end of the stream
+struct counting_data_sink final : ss::data_sink_impl {
+    explicit counting_data_sink(sink_stats& s)
+      : stats(s) {}
+
+    ss::future<> put(ss::net::packet data) final { return put(data.release()); }
+    ss::future<> put(std::vector<ss::temporary_buffer<char>> all) final {
+        for (auto& buf : all) {
+            stats.bytes += buf.size();
+        }
+        return ss::now();
+    }
+    ss::future<> put(ss::temporary_buffer<char> buf) final {
+        stats.bytes += buf.size();
+        return ss::now();
+    }
+    ss::future<> flush() final {
+        ++stats.flushes;
+        return ss::now();
+    }
+    ss::future<> close() final {
+        stats.closed = true;
+        return ss::now();
+    }
+
+    sink_stats& stats;
+};
+
+net::batched_output_stream make_stream(
+  sink_stats& stats,
+  net::batched_output_stream::cork_flush cork,
+  size_t cache = net::batched_output_stream::default_max_unflushed_bytes) {
+    // buffer large enough for the writes to reach the sink on flush only
+    ss::output_stream<char> out(
+      ss::data_sink(std::make_unique<counting_data_sink>(stats)),
+      net::batched_output_stream::default_max_unflushed_bytes);
+    return net::batched_output_stream(std::move(out), cache, cork);
+}
+
+ss::scattered_message<char> make_message(size_t size) {
+    ss::scattered_message<char> msg;
+    msg.append(ss::sstring(size, 'x'));
+    return msg;
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_corked_writes_share_a_flush) {
+    sink_stats stats;
+    auto out = make_stream(stats, net::batched_output_stream::cork_flush::yes);
+
+    std::vector<ss::future<bool>> writes;
+    for (int i = 0; i < 4; ++i) {
+        writes.push_back(out.write(make_message(100)));
+    }
+    auto flushed = ss::when_all_succeed(writes.begin(), writes.end()).get();
+
+    BOOST_REQUIRE_EQUAL(stats.bytes, 400);
+    BOOST_REQUIRE_EQUAL(stats.flushes, 1);
+    BOOST_REQUIRE_EQUAL(std::count(flushed.begin(), flushed.end(), true), 1);
+    out.stop().get();
+}
+
+SEASTAR_THREAD_TEST_CASE(test_corked_write_single) {
+    sink_stats stats;
+    auto out = make_stream(stats, net::batched_output_stream::cork_flush::yes);
+
+    BOOST_REQUIRE(out.write(make_message(100)).get());
+    BOOST_REQUIRE_EQUAL(stats.bytes, 100);
+    BOOST_REQUIRE_EQUAL(stats.flushes, 1);
+
+    // an explicit flush has nothing left to send
+    out.flush().get();
+    BOOST_REQUIRE_EQUAL(stats.flushes, 1);
+    out.stop().get();
+}
+
+SEASTAR_THREAD_TEST_CASE(test_corked_write_over_cache_size_not_deferred) {
+    sink_stats stats;
+    auto out = make_stream(
+      stats, net::batched_output_stream::cork_flush::yes, 128);
+
+    auto write = out.write(make_message(200));
+    // the stream is stopped before the write could yield, the data is sent
+    // because the write flushed while holding the lock
+    out.stop().get();
+    BOOST_REQUIRE(write.get());
+    BOOST_REQUIRE_EQUAL(stats.bytes, 200);
+    BOOST_REQUIRE(stats.closed);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_stop_while_corked_write_deferred) {
+    sink_stats stats;
+    auto out = make_stream(stats, net::batched_output_stream::cork_flush::yes);
+
+    // The deferred flush doesn't hold the write lock, stop() can proceed
+    // and the write must not touch the closed stream afterwards.
+    auto write = out.write(make_message(100));
+    out.stop().get();
+    write.get();
+    BOOST_REQUIRE_EQUAL(stats.bytes, 100);
+    BOOST_REQUIRE_EQUAL(stats.flushes, 1);
+    BOOST_REQUIRE(stats.closed);
+
+    BOOST_REQUIRE_THROW(
+      out.write(make_message(10)).get(), net::batched_output_stream_closed);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_uncorked_write_flushes) {
+    sink_stats stats;
+    auto out = make_stream(stats, net::batched_output_stream::cork_flush::no);
+
+    for (int i = 0; i < 3; ++i) {
+        BOOST_REQUIRE(out.write(make_message(100)).get());
+    }
+    BOOST_REQUIRE_EQUAL(stats.bytes, 300);
+    BOOST_REQUIRE_EQUAL(stats.flushes, 3);
+    out.stop().get();
+}
@@ -50,7 +50,17 @@ ss::future<> base_transport::do_connect(clock_type::time_point timeout) {
             fd = co_await ss::tls::wrap_client(
               _creds,
               std::move(fd),
-              _tls_sni_hostname ? *_tls_sni_hostname : ss::sstring{});
+              ss::tls::tls_options{
+                .server_name = _tls_sni_hostname ? *_tls_sni_hostname
+                                                 : ss::sstring{},
+                .session_resume_data = _tls_session});
+            _tls_session_saved = false;
+            _tls_session_resumed
+              = !_tls_session.empty()
+                && co_await ss::tls::check_session_is_resumed(fd);
+            if (_tls_session_resumed) {
+                _probe.tls_session_resumed();
+            }
         }
         _fd = std::make_unique<ss::connected_socket>(std::move(fd));
         _probe.connection_established();
@@ -69,6 +79,25 @@ ss::future<> base_transport::do_connect(clock_type::time_point timeout) {
     co_return;
 }
 
+ss::future<> base_transport::maybe_save_tls_session() {
+    if (!_creds || !_fd || _tls_session_saved) {
+        co_return;
+    }
+    _tls_session_saved = true;
+    try {
+        _tls_session = co_await ss::tls::get_session_resume_data(*_fd);
+    } catch (...) {
+        // resumption is an optimization, the next connect falls back to a
+        // full handshake
+        vlog(
+          rpc::rpclog.debug,
+          "Unable to save TLS session of {}: {}",
+          server_address(),
+          std::current_exception());
+        _tls_session.clear();
+    }
+}
+
 ss::future<>
 base_transport::connect(clock_type::time_point connection_timeout) {
     // in order to hold concurrency correctness invariants we must guarantee 3
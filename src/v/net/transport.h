@@ -72,9 +72,21 @@ public:
 
     const unresolved_address& server_address() const { return _server_addr; }
 
+    /// True once a TLS session was saved for resumption on the next connect
+    bool has_tls_session() const { return !_tls_session.empty(); }
+
+    /// True if the current connection resumed the saved TLS session
+    bool is_tls_session_resumed() const { return _tls_session_resumed; }
+
 protected:
     virtual void fail_outstanding_futures() {}
 
+    /// Remembers the TLS session of the current connection so that the next
+    /// connect resumes it instead of performing a full handshake. TLS 1.3
+    /// servers send session tickets after the handshake, so subclasses call
+    /// this once the first response has been read.
+    ss::future<> maybe_save_tls_session();
+
     ss::input_stream<char> _in;
     net::batched_output_stream _out;
     ss::gate _dispatch_gate;
@@ -87,6 +99,9 @@ private:
     unresolved_address _server_addr;
     ss::shared_ptr<ss::tls::certificate_credentials> _creds;
     std::optional<ss::sstring> _tls_sni_hostname;
+    ss::tls::session_data _tls_session;
+    bool _tls_session_saved{false};
+    bool _tls_session_resumed{false};
 };
 
 } // namespace net
@@ -2041,8 +2041,11 @@ ss::future<install_snapshot_reply>
 consensus::do_install_snapshot(install_snapshot_request&& r) {
     vlog(_ctxlog.trace, "Install snapshot request: {}", r);
 
+    // bytes stored are only reported once the request was validated against
+    // the partially received snapshot, otherwise the leader would resume the
+    // delivery from an arbitrary offset
     install_snapshot_reply reply{
-      .term = _term, .bytes_stored = r.chunk.size_bytes(), .success = false};
+      .term = _term, .bytes_stored = 0, .success = false};
     reply.target_node_id = r.node_id;
     reply.node_id = _self;
 
@@ -2067,6 +2070,24 @@ consensus::do_install_snapshot(install_snapshot_request&& r) {
         return do_install_snapshot(std::move(r));
     }
 
+    // Verify chunk integrity, corrupted chunk is not stored, the leader will
+    // resend it starting from the last stored byte
+    if (r.chunk_crc) {
+        crc::crc32c crc;
+        crc_extend_iobuf(crc, r.chunk);
+        if (crc.value() != *r.chunk_crc) {
+            vlog(
+              _ctxlog.warn,
+              "Snapshot chunk at offset {} has invalid checksum, expected: {}, "
+              "actual: {}",
+              r.file_offset,
+              *r.chunk_crc,
+              crc.value());
+            reply.bytes_stored = _received_snapshot_bytes;
+            return ss::make_ready_future<install_snapshot_reply>(reply);
+        }
+    }
+
     auto f = ss::now();
     // Create new snapshot file if first chunk (offset is 0) (§7.2)
     if (r.file_offset == 0) {
@@ -2075,29 +2096,58 @@ consensus::do_install_snapshot(install_snapshot_request&& r) {
             f = _snapshot_writer->close().then(
               [this] { return _snapshot_mgr.remove_partial_snapshots(); });
         }
-        f = f.then([this] {
+        f = f.then([this, idx = r.last_included_index] {
             return _snapshot_mgr.start_snapshot().then(
-              [this](storage::snapshot_writer w) {
+              [this, idx](storage::snapshot_writer w) {
                   _snapshot_writer.emplace(std::move(w));
+                  _received_snapshot_index = idx;
+                  _received_snapshot_bytes = 0;
               });
         });
+    } else if (
+      !_snapshot_writer || r.last_included_index != _received_snapshot_index
+      || r.file_offset != _received_snapshot_bytes) {
+        /**
+         * Chunk does not continue the partially received snapshot. This
+         * happens when the leader resumes an interrupted transfer or when one
+         * of the pipelined chunks was lost. Reply with the number of bytes
+         * stored so that the leader can resume from there.
+         */
+        vlog(
+          _ctxlog.debug,
+          "Snapshot chunk with offset {} and last included index {} does not "
+          "match received snapshot state, bytes stored: {}, last included "
+          "index: {}",
+          r.file_offset,
+          r.last_included_index,
+          _received_snapshot_bytes,
+          _received_snapshot_index);
+        reply.bytes_stored = _snapshot_writer && r.last_included_index
+                                                    == _received_snapshot_index
+                               ? _received_snapshot_bytes
+                               : 0;
+        return ss::make_ready_future<install_snapshot_reply>(reply);
     }
 
     // Write data into snapshot file at given offset (§7.3)
     f = f.then([this, chunk = std::move(r.chunk)]() mutable {
+        const auto chunk_size = chunk.size_bytes();
         return write_iobuf_to_output_stream(
-          std::move(chunk), _snapshot_writer->output());
+                 std::move(chunk), _snapshot_writer->output())
+          .then([this, chunk_size] { _received_snapshot_bytes += chunk_size; });
     });
 
     // Reply and wait for more data chunks if done is false (§7.4)
     if (!is_done) {
-        return f.then([reply]() mutable {
+        return f.then([this, reply]() mutable {
             reply.success = true;
+            reply.bytes_stored = _received_snapshot_bytes;
             return reply;
         });
     }
     // Last chunk, finish storing snapshot
     return f.then([this, r = std::move(r), reply]() mutable {
+        reply.bytes_stored = _received_snapshot_bytes;
         return finish_snapshot(std::move(r), reply);
     });
 }
@@ -2123,6 +2173,7 @@ ss::future<install_snapshot_reply> consensus::finish_snapshot(
           .then([this] { return _snapshot_mgr.remove_partial_snapshots(); })
           .then([this, reply]() mutable {
               _snapshot_writer.reset();
+              _received_snapshot_bytes = 0;
               reply.bytes_stored = 0;
               reply.success = false;
               return reply;
@@ -2135,6 +2186,7 @@ ss::future<install_snapshot_reply> consensus::finish_snapshot(
       })
       .then([this, reply]() mutable {
           _snapshot_writer.reset();
+          _received_snapshot_bytes = 0;
           return hydrate_snapshot().then([reply]() mutable {
               reply.success = true;
               return reply;
@@ -207,6 +207,10 @@ public:
     replicate_stages
     replicate_in_stages(model::record_batch_reader&&, replicate_options);
     uint64_t get_snapshot_size() const { return _snapshot_size; }
+    /// bytes of the snapshot being received from the leader stored so far
+    uint64_t received_snapshot_bytes() const {
+        return _received_snapshot_bytes;
+    }
 
     /**
      * Replication happens only when expected_term matches the current _term
@@ -413,6 +417,20 @@ private:
     do_install_snapshot(install_snapshot_request&& r);
     ss::future<> do_start();
 
+    // followers decode packed batches without materializing records
+    bool use_packed_append_entries() const {
+        return _features.is_active(
+          features::feature::raft_packed_append_entries);
+    }
+
+    // followers store snapshot chunks only if they continue the partially
+    // received snapshot and report the total number of bytes stored, older
+    // followers expect chunks to be delivered one at a time from the start
+    bool use_pipelined_snapshot_delivery() const {
+        return _features.is_active(
+          features::feature::raft_snapshot_pipelining);
+    }
+
     ss::future<result<replicate_result>> dispatch_replicate(
       append_entries_request,
       std::vector<ssx::semaphore_units>,
@@ -692,6 +710,10 @@ private:
     storage::simple_snapshot_manager _snapshot_mgr;
     uint64_t _snapshot_size{0};
     std::optional<storage::snapshot_writer> _snapshot_writer;
+    // state of partially received snapshot, used to resume interrupted
+    // snapshot delivery
+    uint64_t _received_snapshot_bytes{0};
+    model::offset _received_snapshot_index;
     model::offset _last_snapshot_index;
     model::term_id _last_snapshot_term;
     configuration_manager _configuration_manager;
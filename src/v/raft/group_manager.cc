@@ -61,11 +61,13 @@ ss::future<> group_manager::stop() {
         f = f.then([this] { return _heartbeats.stop(); });
     }
 
-    return f.then([this] {
-        return ss::parallel_for_each(
-          _groups,
-          [](ss::lw_shared_ptr<consensus> raft) { return raft->stop(); });
-    });
+    return f
+      .then([this] {
+          return ss::parallel_for_each(
+            _groups,
+            [](ss::lw_shared_ptr<consensus> raft) { return raft->stop(); });
+      })
+      .then([this] { return _recovery_mem_quota.stop(); });
 }
 void group_manager::set_ready() {
     _is_ready = true;
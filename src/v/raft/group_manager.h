@@ -82,6 +82,15 @@ public:
         _notifications.unregister_cb(id);
     }
 
+    /// Recoveries waiting for the recovery memory quota, highest priority
+    /// first
+    std::vector<recovery_waiter_info> recovery_waiters() const {
+        return _recovery_mem_quota.waiters();
+    }
+    size_t available_recovery_memory() const {
+        return _recovery_mem_quota.available_memory();
+    }
+
 private:
     void trigger_leadership_notification(raft::leadership_status);
     void setup_metrics();
@@ -12,13 +12,21 @@
 
 #include "raft/logger.h"
 #include "resource_mgmt/memory_groups.h"
+#include "ssx/future-util.h"
 #include "ssx/semaphore.h"
 #include "vlog.h"
 
+#include <seastar/core/coroutine.hh>
 #include <seastar/core/memory.hh>
 
 namespace raft {
 
+std::ostream& operator<<(std::ostream& o, const recovery_priority& p) {
+    fmt::print(
+      o, "{{in_sync_replicas: {}, lag: {}}}", p.in_sync_replicas, p.lag);
+    return o;
+}
+
 recovery_memory_quota::recovery_memory_quota(
   recovery_memory_quota::config_provider_fn config_provider)
   : _cfg(config_provider())
@@ -28,10 +36,87 @@ recovery_memory_quota::recovery_memory_quota(
     _cfg.max_recovery_memory.watch([this] { on_max_memory_changed(); });
 }
 
-ss::future<ssx::semaphore_units> recovery_memory_quota::acquire_read_memory() {
-    return ss::get_units(
-      _memory,
-      std::min(_current_max_recovery_mem, _cfg.default_read_buffer_size()));
+size_t recovery_memory_quota::read_size() const {
+    return std::min(_current_max_recovery_mem, _cfg.default_read_buffer_size());
+}
+
+ss::future<ssx::semaphore_units> recovery_memory_quota::acquire_read_memory(
+  model::ntp ntp, vnode follower, recovery_priority priority) {
+    // fast path, nobody is waiting and there is enough memory available
+    const auto units = read_size();
+    if (
+      _waiters.empty() && _memory.waiters() == 0
+      && _memory.available_units() >= static_cast<ssize_t>(units)) {
+        return ss::make_ready_future<ssx::semaphore_units>(
+          ss::consume_units(_memory, units));
+    }
+
+    waiter_key key{
+      priority.in_sync_replicas, -priority.lag, _next_waiter_seq++};
+    auto [it, _] = _waiters.emplace(
+      key,
+      waiter{
+        .info = recovery_waiter_info{
+          .ntp = std::move(ntp),
+          .follower = follower,
+          .priority = priority,
+          .enqueued_at = clock_type::now()}});
+    auto f = it->second.promise.get_future();
+    maybe_dispatch();
+    return f;
+}
+
+void recovery_memory_quota::maybe_dispatch() {
+    if (_dispatching || _waiters.empty() || _gate.is_closed()) {
+        return;
+    }
+    _dispatching = true;
+    ssx::spawn_with_gate(_gate, [this] { return dispatch(); });
+}
+
+ss::future<> recovery_memory_quota::dispatch() {
+    while (!_waiters.empty()) {
+        ssx::semaphore_units units;
+        try {
+            units = co_await ss::get_units(_memory, read_size());
+        } catch (...) {
+            auto e = std::current_exception();
+            for (auto& [_, w] : _waiters) {
+                w.promise.set_exception(e);
+            }
+            _waiters.clear();
+            break;
+        }
+        /**
+         * Waiters may have been added while waiting for memory, the units are
+         * granted to the waiter with the highest priority at the time when
+         * memory became available.
+         */
+        auto it = _waiters.begin();
+        vlog(
+          raftlog.trace,
+          "[{}] granting recovery memory to follower {} with priority {}",
+          it->second.info.ntp,
+          it->second.info.follower,
+          it->second.info.priority);
+        it->second.promise.set_value(std::move(units));
+        _waiters.erase(it);
+    }
+    _dispatching = false;
+}
+
+std::vector<recovery_waiter_info> recovery_memory_quota::waiters() const {
+    std::vector<recovery_waiter_info> ret;
+    ret.reserve(_waiters.size());
+    for (const auto& [_, w] : _waiters) {
+        ret.push_back(w.info);
+    }
+    return ret;
+}
+
+ss::future<> recovery_memory_quota::stop() {
+    _memory.broken();
+    co_await _gate.close();
 }
 
 void recovery_memory_quota::on_max_memory_changed() {
@@ -10,14 +10,57 @@
  */
 #pragma once
 #include "config/property.h"
+#include "model/fundamental.h"
+#include "model/metadata.h"
+#include "raft/types.h"
 #include "seastarx.h"
 #include "ssx/semaphore.h"
 
+#include <seastar/core/gate.hh>
 #include <seastar/util/noncopyable_function.hh>
 
+#include <absl/container/btree_map.h>
+
 namespace raft {
+
 /**
- * Thread local memory quota for raft recovery
+ * Priority of follower recovery. Recoveries of partitions with the fewest in
+ * sync replicas, i.e. the ones closest to losing quorum, are served first.
+ * Among partitions with the same number of in sync replicas the follower
+ * that is the most behind the leader goes first.
+ */
+struct recovery_priority {
+    // number of replicas, including leader, that are not recovering
+    size_t in_sync_replicas{0};
+    // difference between leader dirty offset and follower match index
+    int64_t lag{0};
+
+    friend std::ostream& operator<<(std::ostream&, const recovery_priority&);
+};
+
+/**
+ * Recovery waiting for the memory quota, exposed for diagnostics
+ */
+struct recovery_waiter_info {
+    model::ntp ntp;
+    vnode follower;
+    recovery_priority priority;
+    clock_type::time_point enqueued_at;
+};
+
+/**
+ * Thread local memory quota for raft recovery.
+ *
+ * The quota is granted to recoveries in order of their priority rather than in
+ * order of arrival. Recovery holds the memory units while it is being throttled
+ * by the recovery throttle, hence the throttle budget is also consumed by the
+ * recoveries with the highest priority first.
+ *
+ * Prioritization is per shard, not node wide. A recovery reads the log of a
+ * partition owned by its shard into the shard's own memory and is throttled by
+ * the shard's share of the recovery rate, so units freed on one shard can't be
+ * used by a recovery waiting on another. A low priority recovery may hence
+ * proceed on an idle shard while a higher priority one waits on a busy shard.
  */
 class recovery_memory_quota {
 public:
@@ -29,14 +72,34 @@ public:
 
     explicit recovery_memory_quota(config_provider_fn);
 
-    ss::future<ssx::semaphore_units> acquire_read_memory();
+    ss::future<ssx::semaphore_units>
+    acquire_read_memory(model::ntp, vnode, recovery_priority);
+
+    ss::future<> stop();
+
+    std::vector<recovery_waiter_info> waiters() const;
+    size_t available_memory() const { return _memory.available_units(); }
 
 private:
+    struct waiter {
+        recovery_waiter_info info;
+        ss::promise<ssx::semaphore_units> promise;
+    };
+    // (in sync replicas, negated lag, arrival sequence)
+    using waiter_key = std::tuple<size_t, int64_t, uint64_t>;
+
+    size_t read_size() const;
+    void maybe_dispatch();
+    ss::future<> dispatch();
     void on_max_memory_changed();
 
     configuration _cfg;
     size_t _current_max_recovery_mem;
     ssx::semaphore _memory;
+    absl::btree_map<waiter_key, waiter> _waiters;
+    uint64_t _next_waiter_seq{0};
+    bool _dispatching{false};
+    ss::gate _gate;
 };
 
 } // namespace raft
@@ -9,6 +9,7 @@
 
 #include "raft/recovery_stm.h"
 
+#include "config/configuration.h"
 #include "model/fundamental.h"
 #include "model/record_batch_reader.h"
 #include "outcome_future_utils.h"
@@ -17,11 +18,13 @@
 #include "raft/errc.h"
 #include "raft/logger.h"
 #include "raft/raftgen_service.h"
+#include "ssx/future-util.h"
 #include "ssx/sformat.h"
 
 #include <seastar/core/condition-variable.hh>
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/future-util.hh>
+#include <seastar/core/gate.hh>
 #include <seastar/core/io_priority_class.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/with_scheduling_group.hh>
@@ -140,8 +143,10 @@ ss::future<> recovery_stm::do_recover(ss::io_priority_class iopc) {
           });
         co_return;
     }
-    // acquire read memory:
-    auto read_memory_units = co_await _memory_quota.acquire_read_memory();
+    // acquire read memory, memory is granted to the recoveries of partitions
+    // that are at the highest risk of becoming unavailable first
+    auto read_memory_units = co_await _memory_quota.acquire_read_memory(
+      _ptr->ntp(), _node_id, get_recovery_priority());
     auto reader = co_await read_range_for_recovery(
       follower_next_offset, iopc, is_learner, read_memory_units.count());
     // no batches for recovery, do nothing
@@ -273,54 +278,176 @@ recovery_stm::read_range_for_recovery(
 }
 
 ss::future<> recovery_stm::open_snapshot_reader() {
-    return _ptr->_snapshot_mgr.open_snapshot().then(
-      [this](std::optional<storage::snapshot_reader> rdr) {
-          if (rdr) {
-              _snapshot_reader = std::make_unique<storage::snapshot_reader>(
-                std::move(*rdr));
-              return _snapshot_reader->get_snapshot_size().then(
-                [this](size_t sz) { _snapshot_size = sz; });
-          }
-          return ss::now();
+    auto rdr = co_await _ptr->_snapshot_mgr.open_snapshot();
+    if (!rdr) {
+        co_return;
+    }
+    _snapshot_reader = std::make_unique<storage::snapshot_reader>(
+      std::move(*rdr));
+    _snapshot_size = co_await _snapshot_reader->get_snapshot_size();
+
+    // resume interrupted delivery of the same snapshot, older followers can
+    // only receive the snapshot from the beginning
+    if (!_ptr->use_pipelined_snapshot_delivery()) {
+        co_return;
+    }
+    auto meta = get_follower_meta();
+    if (
+      meta
+      && meta.value()->snapshot_delivery_index == _ptr->_last_snapshot_index
+      && meta.value()->snapshot_bytes_stored < _snapshot_size) {
+        const auto resume_offset = meta.value()->snapshot_bytes_stored;
+        if (resume_offset > 0) {
+            vlog(
+              _ctxlog.debug,
+              "Resuming snapshot delivery from offset {}, snapshot size: {}",
+              resume_offset,
+              _snapshot_size);
+            co_await _snapshot_reader->input().skip(resume_offset);
+            _sent_snapshot_bytes = resume_offset;
+        }
+    }
+}
+
+ss::future<> recovery_stm::throttle_snapshot_chunk(size_t size) {
+    if (!_ptr->_recovery_throttle) {
+        return ss::now();
+    }
+    vlog(
+      _ctxlog.trace,
+      "Requesting throttle for {} snapshot bytes, available in throttle: {}",
+      size,
+      _ptr->_recovery_throttle->get().available());
+    return _ptr->_recovery_throttle->get()
+      .throttle(size, _ptr->_as)
+      .handle_exception_type([this](const ss::broken_semaphore&) {
+          vlog(_ctxlog.info, "Recovery throttling has stopped");
       });
 }
 
-ss::future<> recovery_stm::send_install_snapshot_request() {
-    // send 32KB at a time
-    return read_iobuf_exactly(_snapshot_reader->input(), 32_KiB)
-      .then([this](iobuf chunk) mutable {
-          auto chunk_size = chunk.size_bytes();
-          install_snapshot_request req{
-            .target_node_id = _node_id,
-            .term = _ptr->term(),
-            .group = _ptr->group(),
-            .node_id = _ptr->_self,
-            .last_included_index = _ptr->_last_snapshot_index,
-            .file_offset = _sent_snapshot_bytes,
-            .chunk = std::move(chunk),
-            .done = (_sent_snapshot_bytes + chunk_size) == _snapshot_size};
-
-          vlog(
-            _ctxlog.trace,
-            "Sending install snapshot request, last included index: {}",
-            req.last_included_index);
-          auto seq = _ptr->next_follower_sequence(_node_id);
+ss::future<> recovery_stm::send_install_snapshot_chunks() {
+    /**
+     * Snapshot chunks are pipelined, up to
+     * raft_install_snapshot_max_chunks_in_flight requests are dispatched to
+     * the follower without waiting for a reply. Follower only accepts a chunk
+     * that continues the snapshot it has already stored, if any of the chunks
+     * is rejected the delivery is stopped and resumed in the next recovery
+     * round from the offset reported by the follower.
+     *
+     * Until all nodes support it, chunks are sent one at a time without
+     * checksums as older followers neither validate the chunk offset nor
+     * report the total number of bytes stored.
+     */
+    const bool pipelined = _ptr->use_pipelined_snapshot_delivery();
+    const size_t chunk_size
+      = config::shard_local_cfg().raft_install_snapshot_chunk_size();
+    ssx::semaphore window(
+      pipelined
+        ? config::shard_local_cfg().raft_install_snapshot_max_chunks_in_flight()
+        : 1,
+      "raft/install-snapshot-window");
+    ss::gate inflight;
+
+    /**
+     * Dispatched requests hold units of the window and the inflight gate,
+     * both local to this coroutine, they must finish before it returns also
+     * when reading or throttling the next chunk failed.
+     */
+    std::exception_ptr ex;
+    try {
+        while (_sent_snapshot_bytes < _snapshot_size && !_stop_requested
+               && _term == _ptr->term()) {
+            auto units = co_await ss::get_units(window, 1);
+            if (_stop_requested) {
+                break;
+            }
+            auto chunk = co_await read_iobuf_exactly(
+              _snapshot_reader->input(), chunk_size);
+            if (chunk.empty()) {
+                vlog(
+                  _ctxlog.warn,
+                  "Unexpected end of snapshot at offset {}, snapshot size: {}",
+                  _sent_snapshot_bytes,
+                  _snapshot_size);
+                _stop_requested = true;
+                break;
+            }
+            co_await throttle_snapshot_chunk(chunk.size_bytes());
+
+            std::optional<uint32_t> chunk_crc;
+            if (pipelined) {
+                crc::crc32c crc;
+                crc_extend_iobuf(crc, chunk);
+                chunk_crc = crc.value();
+            }
+            const auto chunk_bytes = chunk.size_bytes();
+            install_snapshot_request req{
+              .target_node_id = _node_id,
+              .term = _ptr->term(),
+              .group = _ptr->group(),
+              .node_id = _ptr->_self,
+              .last_included_index = _ptr->_last_snapshot_index,
+              .file_offset = _sent_snapshot_bytes,
+              .chunk = std::move(chunk),
+              .done = (_sent_snapshot_bytes + chunk_bytes) == _snapshot_size,
+              .chunk_crc = chunk_crc};
+            _sent_snapshot_bytes += chunk_bytes;
+
+            ssx::spawn_with_gate(
+              inflight,
+              [this,
+               pipelined,
+               req = std::move(req),
+               units = std::move(units)]() mutable {
+                  return send_install_snapshot_request(
+                           std::move(req), pipelined)
+                    .handle_exception([this](const std::exception_ptr& e) {
+                        vlog(
+                          _ctxlog.warn,
+                          "Error sending install snapshot request: {}",
+                          e);
+                        _stop_requested = true;
+                    })
+                    .finally([units = std::move(units)] {});
+              });
+        }
+    } catch (...) {
+        ex = std::current_exception();
+        _stop_requested = true;
+    }
+
+    co_await inflight.close();
+    if (ex) {
+        std::rethrow_exception(ex);
+    }
+}
+
+ss::future<> recovery_stm::send_install_snapshot_request(
+  install_snapshot_request req, bool pipelined) {
+    vlog(
+      _ctxlog.trace,
+      "Sending install snapshot request, last included index: {}, file "
+      "offset: {}",
+      req.last_included_index,
+      req.file_offset);
+    auto seq = _ptr->next_follower_sequence(_node_id);
+    _ptr->update_suppress_heartbeats(_node_id, seq, heartbeats_suppressed::yes);
+    const bool done = req.done;
+    return _ptr->_client_protocol
+      .install_snapshot(
+        _node_id.id(),
+        std::move(req),
+        rpc::client_opts(append_entries_timeout()))
+      .then([this, done, pipelined](result<install_snapshot_reply> reply) {
+          return handle_install_snapshot_reply(
+            _ptr->validate_reply_target_node(
+              "install_snapshot", reply, _node_id.id()),
+            done,
+            pipelined);
+      })
+      .finally([this, seq] {
           _ptr->update_suppress_heartbeats(
-            _node_id, seq, heartbeats_suppressed::yes);
-          return _ptr->_client_protocol
-            .install_snapshot(
-              _node_id.id(),
-              std::move(req),
-              rpc::client_opts(append_entries_timeout()))
-            .then([this](result<install_snapshot_reply> reply) {
-                return handle_install_snapshot_reply(
-                  _ptr->validate_reply_target_node(
-                    "install_snapshot", reply, _node_id.id()));
-            })
-            .finally([this, seq] {
-                _ptr->update_suppress_heartbeats(
-                  _node_id, seq, heartbeats_suppressed::no);
-            });
+            _node_id, seq, heartbeats_suppressed::no);
       });
 }
 
@@ -333,54 +460,85 @@ ss::future<> recovery_stm::close_snapshot_reader() {
 }
 
 ss::future<> recovery_stm::handle_install_snapshot_reply(
-  result<install_snapshot_reply> reply) {
+  result<install_snapshot_reply> reply, bool done, bool pipelined) {
+    auto meta = get_follower_meta();
+    if (!meta) {
+        // stop recovery when node was removed
+        _stop_requested = true;
+        return ss::now();
+    }
     // snapshot delivery failed
-    if (reply.has_error() || !reply.value().success) {
+    if (reply.has_error()) {
         // if snapshot delivery failed, stop recovery to update follower state
         // and retry
         _stop_requested = true;
-        return close_snapshot_reader();
+        return ss::now();
     }
     if (reply.value().term > _ptr->_term) {
-        return close_snapshot_reader().then([this, term = reply.value().term] {
-            return _ptr->step_down(term, "snapshot response with greater term");
-        });
+        _stop_requested = true;
+        return _ptr->step_down(
+          reply.value().term, "snapshot response with greater term");
     }
-    _sent_snapshot_bytes = reply.value().bytes_stored;
-
-    // we will send next chunk as a part of recovery loop
-    if (_sent_snapshot_bytes != _snapshot_size) {
+    if (!reply.value().success) {
+        // follower rejected the chunk, resume from the last byte it stored in
+        // the next recovery round. Followers which rejected the request
+        // without looking at the snapshot state (e.g. because of invalid
+        // target node) report no stored bytes, the delivery is then restarted
+        // from the beginning.
+        _stop_requested = true;
+        if (pipelined) {
+            (*meta)->snapshot_delivery_index = _ptr->_last_snapshot_index;
+            (*meta)->snapshot_bytes_stored = std::min<uint64_t>(
+              reply.value().bytes_stored, _snapshot_size);
+        }
         return ss::now();
     }
 
-    auto meta = get_follower_meta();
-    if (!meta) {
-        // stop recovery when node was removed
-        _stop_requested = true;
-        return ss::make_ready_future<>();
+    if (pipelined) {
+        (*meta)->snapshot_delivery_index = _ptr->_last_snapshot_index;
+        (*meta)->snapshot_bytes_stored = std::max(
+          (*meta)->snapshot_bytes_stored,
+          std::min<uint64_t>(reply.value().bytes_stored, _snapshot_size));
+    }
+
+    // wait for remaining chunks, follower accepts the last chunk only if all
+    // the previous ones were stored
+    if (!done) {
+        return ss::now();
     }
 
     // snapshot received by the follower, continue with recovery
     (*meta)->match_index = _ptr->_last_snapshot_index;
     (*meta)->next_index = model::next_offset(_ptr->_last_snapshot_index);
     (*meta)->last_sent_offset = _ptr->_last_snapshot_index;
-    return close_snapshot_reader();
+    (*meta)->snapshot_bytes_stored = 0;
+    return ss::now();
 }
 
 ss::future<> recovery_stm::install_snapshot() {
     // open reader if not yet available
-    auto f = _snapshot_reader != nullptr ? ss::now() : open_snapshot_reader();
-
-    return f.then([this]() mutable {
-        // we are outside of raft operation lock if snapshot isn't yet ready we
-        // have to wait for it till next recovery loop
-        if (!_snapshot_reader) {
-            _stop_requested = true;
-            return ss::now();
-        }
+    if (!_snapshot_reader) {
+        co_await open_snapshot_reader();
+    }
+    // we are outside of raft operation lock if snapshot isn't yet ready we
+    // have to wait for it till next recovery loop
+    if (!_snapshot_reader) {
+        _stop_requested = true;
+        co_return;
+    }
 
-        return send_install_snapshot_request();
-    });
+    std::exception_ptr ex;
+    try {
+        co_await send_install_snapshot_chunks();
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    // delivery either finished or was interrupted, in the latter case it is
+    // resumed from the offset stored by the follower
+    co_await close_snapshot_reader();
+    if (ex) {
+        std::rethrow_exception(ex);
+    }
 }
 
 ss::future<> recovery_stm::replicate(
@@ -422,6 +580,7 @@ ss::future<> recovery_stm::replicate(
         .last_visible_index = last_visible_idx},
       std::move(reader),
       flush);
+    r.packed_batches = _ptr->use_packed_append_entries();
     auto meta = get_follower_meta();
 
     if (!meta) {
@@ -499,6 +658,9 @@ ss::future<result<append_entries_reply>> recovery_stm::dispatch_append_entries(
     rpc::client_opts opts(append_entries_timeout());
     opts.resource_units = ss::make_foreign(
       ss::make_lw_shared<std::vector<ssx::semaphore_units>>(std::move(units)));
+    // recovery reads may be large, keep them off the connection used for
+    // heartbeats and replication
+    opts.lane = rpc::connection_lane::bulk;
 
     return _ptr->_client_protocol
       .append_entries(_node_id.id(), std::move(r), std::move(opts))
@@ -559,6 +721,23 @@ ss::future<> recovery_stm::apply() {
       });
 }
 
+recovery_priority recovery_stm::get_recovery_priority() {
+    recovery_priority priority{.in_sync_replicas = 1};
+    for (const auto& [id, f] : _ptr->_fstats) {
+        if (!f.is_learner && !f.is_recovering) {
+            ++priority.in_sync_replicas;
+        }
+    }
+    auto meta = get_follower_meta();
+    if (meta) {
+        // match index is not initialized for followers with empty log
+        auto match = std::max(meta.value()->match_index, model::offset(-1));
+        auto dirty = std::max(_ptr->_log.offsets().dirty_offset, match);
+        priority.lag = dirty() - match();
+    }
+    return priority;
+}
+
 std::optional<follower_index_metadata*> recovery_stm::get_follower_meta() {
     auto it = _ptr->_fstats.find(_node_id);
     if (it == _ptr->_fstats.end()) {
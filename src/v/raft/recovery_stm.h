@@ -40,11 +40,16 @@ private:
     ss::future<result<append_entries_reply>> dispatch_append_entries(
       append_entries_request&&, std::vector<ssx::semaphore_units>);
     std::optional<follower_index_metadata*> get_follower_meta();
+    recovery_priority get_recovery_priority();
     clock_type::time_point append_entries_timeout();
 
     ss::future<> install_snapshot();
-    ss::future<> send_install_snapshot_request();
-    ss::future<> handle_install_snapshot_reply(result<install_snapshot_reply>);
+    ss::future<> send_install_snapshot_chunks();
+    ss::future<>
+    send_install_snapshot_request(install_snapshot_request, bool pipelined);
+    ss::future<> handle_install_snapshot_reply(
+      result<install_snapshot_reply>, bool done, bool pipelined);
+    ss::future<> throttle_snapshot_chunk(size_t);
     ss::future<> open_snapshot_reader();
     ss::future<> close_snapshot_reader();
     bool state_changed();
@@ -36,16 +36,19 @@ ss::future<result<vote_reply>> rpc_client_protocol::vote(
 
 ss::future<result<append_entries_reply>> rpc_client_protocol::append_entries(
   model::node_id n, append_entries_request&& r, rpc::client_opts opts) {
+    const auto timeout = opts.timeout;
+    const auto lane = opts.lane;
     return _connection_cache.local().with_node_client<raftgen_client_protocol>(
       _self,
       ss::this_shard_id(),
       n,
-      opts.timeout,
+      timeout,
       [r = std::move(r),
        opts = std::move(opts)](raftgen_client_protocol client) mutable {
           return client.append_entries(std::move(r), std::move(opts))
             .then(&rpc::get_ctx_data<append_entries_reply>);
-      });
+      },
+      lane);
 }
 
 ss::future<result<heartbeat_reply>> rpc_client_protocol::heartbeat(
@@ -74,7 +77,8 @@ rpc_client_protocol::install_snapshot(
        opts = std::move(opts)](raftgen_client_protocol client) mutable {
           return client.install_snapshot(std::move(r), std::move(opts))
             .then(&rpc::get_ctx_data<install_snapshot_reply>);
-      });
+      },
+      rpc::connection_lane::bulk);
 }
 
 ss::future<result<timeout_now_reply>> rpc_client_protocol::timeout_now(
@@ -0,0 +1,111 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "model/record_batch_reader.h"
+#include "model/tests/random_batch.h"
+#include "raft/types.h"
+#include "seastarx.h"
+#include "serde/serde.h"
+
+#include <seastar/core/memory.hh>
+#include <seastar/testing/perf_tests.hh>
+
+#include <fmt/core.h>
+
+/*
+ * Measures the cost of decoding an append entries request on the follower, in
+ * time and heap allocations per batch, for both the legacy record by record
+ * encoding and the packed encoding.
+ */
+class append_entries_decode_bench {
+public:
+    static constexpr int batches_per_request = 1000;
+    static constexpr int records_per_batch = 10;
+
+    append_entries_decode_bench()
+      : _legacy(encode(false))
+      , _packed(encode(true)) {}
+
+    append_entries_decode_bench(const append_entries_decode_bench&) = delete;
+    append_entries_decode_bench&
+    operator=(const append_entries_decode_bench&)
+      = delete;
+    append_entries_decode_bench(append_entries_decode_bench&&) = delete;
+    append_entries_decode_bench& operator=(append_entries_decode_bench&&)
+      = delete;
+
+    ~append_entries_decode_bench() {
+        report("legacy", _legacy_stats);
+        report("packed", _packed_stats);
+    }
+
+    ss::future<size_t> run(bool packed) {
+        auto& stats = packed ? _packed_stats : _legacy_stats;
+        iobuf_parser parser(packed ? _packed.share(0, _packed.size_bytes())
+                                   : _legacy.share(0, _legacy.size_bytes()));
+
+        const auto mallocs_before = ss::memory::stats().mallocs();
+        perf_tests::start_measuring_time();
+        auto req = co_await serde::read_async<raft::append_entries_request>(
+          parser);
+        perf_tests::stop_measuring_time();
+        stats.allocations += ss::memory::stats().mallocs() - mallocs_before;
+        stats.batches += batches_per_request;
+
+        perf_tests::do_not_optimize(req);
+        co_return batches_per_request;
+    }
+
+private:
+    struct decode_stats {
+        uint64_t allocations{0};
+        uint64_t batches{0};
+    };
+
+    static iobuf encode(bool packed) {
+        auto batches = model::test::make_random_batches(
+          model::test::record_batch_spec{
+            .allow_compression = false,
+            .count = batches_per_request,
+            .records = records_per_batch});
+        raft::append_entries_request req(
+          raft::vnode(model::node_id(1), model::revision_id(1)),
+          raft::vnode(model::node_id(2), model::revision_id(1)),
+          raft::protocol_metadata{.group = raft::group_id(1)},
+          model::make_memory_record_batch_reader(std::move(batches)));
+        req.packed_batches = packed;
+
+        iobuf out;
+        serde::write_async(out, std::move(req)).get();
+        return out;
+    }
+
+    static void report(std::string_view name, const decode_stats& stats) {
+        if (stats.batches == 0) {
+            return;
+        }
+        fmt::print(
+          "{} decode: {:.2f} allocations per batch\n",
+          name,
+          static_cast<double>(stats.allocations) / stats.batches);
+    }
+
+    iobuf _legacy;
+    iobuf _packed;
+    decode_stats _legacy_stats;
+    decode_stats _packed_stats;
+};
+
+PERF_TEST_C(append_entries_decode_bench, legacy_1k_batches) {
+    co_return co_await run(false);
+}
+
+PERF_TEST_C(append_entries_decode_bench, packed_1k_batches) {
+    co_return co_await run(true);
+}
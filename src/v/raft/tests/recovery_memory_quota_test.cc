@@ -0,0 +1,82 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "config/property.h"
+#include "model/fundamental.h"
+#include "raft/recovery_memory_quota.h"
+#include "units.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+static raft::recovery_memory_quota make_quota() {
+    return raft::recovery_memory_quota([] {
+        return raft::recovery_memory_quota::configuration{
+          .max_recovery_memory = config::mock_binding<std::optional<size_t>>(
+            1_MiB),
+          .default_read_buffer_size = config::mock_binding<size_t>(512_KiB),
+        };
+    });
+}
+
+static model::ntp make_ntp(int p) {
+    return model::ntp(
+      model::kafka_namespace, model::topic("tp"), model::partition_id(p));
+}
+
+SEASTAR_THREAD_TEST_CASE(test_recovery_memory_granted_by_priority) {
+    auto quota = make_quota();
+    raft::vnode follower(model::node_id(1), model::revision_id(0));
+
+    // exhaust the quota
+    auto u1 = quota
+                .acquire_read_memory(
+                  make_ntp(0), follower, {.in_sync_replicas = 3, .lag = 10})
+                .get0();
+    auto u2 = quota
+                .acquire_read_memory(
+                  make_ntp(1), follower, {.in_sync_replicas = 3, .lag = 10})
+                .get0();
+
+    std::vector<int> granted;
+    auto wait = [&](int p, raft::recovery_priority prio) {
+        return quota.acquire_read_memory(make_ntp(p), follower, prio)
+          .then([&granted, p](ssx::semaphore_units u) {
+              granted.push_back(p);
+              return u;
+          });
+    };
+    // healthy partition
+    auto f_healthy = wait(2, {.in_sync_replicas = 3, .lag = 1000});
+    // partition one replica away from losing quorum
+    auto f_at_risk = wait(3, {.in_sync_replicas = 1, .lag = 10});
+    // partition with degraded replication and large lag
+    auto f_lagging = wait(4, {.in_sync_replicas = 2, .lag = 1000});
+    // same risk, smaller lag
+    auto f_small_lag = wait(5, {.in_sync_replicas = 2, .lag = 5});
+
+    auto waiters = quota.waiters();
+    BOOST_REQUIRE_EQUAL(waiters.size(), 4);
+    BOOST_REQUIRE_EQUAL(waiters.front().ntp, make_ntp(3));
+    BOOST_REQUIRE_EQUAL(waiters.back().ntp, make_ntp(2));
+
+    u1.return_all();
+    u2.return_all();
+    auto u3 = f_at_risk.get0();
+    u3.return_all();
+    auto u4 = f_lagging.get0();
+    u4.return_all();
+    auto u5 = f_small_lag.get0();
+    f_healthy.get0().return_all();
+    u5.return_all();
+
+    BOOST_REQUIRE_EQUAL(granted, std::vector<int>({3, 4, 5, 2}));
+    BOOST_REQUIRE(quota.waiters().empty());
+    quota.stop().get();
+}
@@ -0,0 +1,303 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/iostream.h"
+#include "config/configuration.h"
+#include "hashing/crc32c.h"
+#include "model/fundamental.h"
+#include "raft/tests/raft_group_fixture.h"
+#include "raft/types.h"
+#include "random/generators.h"
+#include "test_utils/async.h"
+#include "units.h"
+
+#include <seastar/core/file.hh>
+#include <seastar/core/fstream.hh>
+#include <seastar/core/seastar.hh>
+
+#include <algorithm>
+#include <filesystem>
+
+namespace {
+
+uint32_t chunk_crc(const iobuf& chunk) {
+    crc::crc32c crc;
+    crc_extend_iobuf(crc, chunk);
+    return crc.value();
+}
+
+raft::install_snapshot_request make_chunk(
+  raft::consensus& leader,
+  raft::consensus& follower,
+  model::offset last_included_index,
+  uint64_t file_offset,
+  iobuf chunk) {
+    auto crc = chunk_crc(chunk);
+    return raft::install_snapshot_request{
+      .target_node_id = follower.self(),
+      .term = leader.term(),
+      .group = leader.group(),
+      .node_id = leader.self(),
+      .last_included_index = last_included_index,
+      .file_offset = file_offset,
+      .chunk = std::move(chunk),
+      .done = false,
+      .chunk_crc = crc};
+}
+
+iobuf random_iobuf(size_t size) {
+    iobuf ret;
+    ret.append(random_generators::gen_alphanum_string(size).data(), size);
+    return ret;
+}
+
+/// sets snapshot delivery properties on all shards, restores the defaults
+/// when destroyed
+struct snapshot_delivery_config {
+    snapshot_delivery_config(
+      size_t chunk_size, uint32_t chunks_in_flight, size_t recovery_rate) {
+        ss::smp::invoke_on_all([=] {
+            auto& cfg = config::shard_local_cfg();
+            cfg.raft_install_snapshot_chunk_size.set_value(chunk_size);
+            cfg.raft_install_snapshot_max_chunks_in_flight.set_value(
+              chunks_in_flight);
+            cfg.raft_learner_recovery_rate.set_value(recovery_rate);
+        }).get();
+    }
+    snapshot_delivery_config(const snapshot_delivery_config&) = delete;
+    snapshot_delivery_config& operator=(const snapshot_delivery_config&)
+      = delete;
+    snapshot_delivery_config(snapshot_delivery_config&&) = delete;
+    snapshot_delivery_config& operator=(snapshot_delivery_config&&) = delete;
+    ~snapshot_delivery_config() {
+        ss::smp::invoke_on_all([] {
+            auto& cfg = config::shard_local_cfg();
+            cfg.raft_install_snapshot_chunk_size.reset();
+            cfg.raft_install_snapshot_max_chunks_in_flight.reset();
+            cfg.raft_learner_recovery_rate.reset();
+        }).get();
+    }
+};
+
+model::node_id any_follower(raft_group& gr, model::node_id leader_id) {
+    auto& members = gr.get_members();
+    auto it = std::find_if(members.begin(), members.end(), [&](auto& m) {
+        return m.first != leader_id;
+    });
+    BOOST_REQUIRE(it != members.end());
+    return it->first;
+}
+
+} // namespace
+
+struct snapshot_delivery_fixture : raft_test_fixture {
+    /**
+     * Disables one of the followers, writes a snapshot with the given amount
+     * of data on the remaining members and enables the follower again, it
+     * then has to be recovered with a snapshot.
+     */
+    model::node_id
+    recover_follower_with_snapshot(raft_group& gr, size_t snapshot_data) {
+        auto leader_id = wait_for_group_leader(gr);
+        auto follower_id = any_follower(gr, leader_id);
+        gr.disable_node(follower_id);
+
+        BOOST_REQUIRE(replicate_random_batches(gr, 5).get0());
+        tests::cooperative_spin_wait_with_timeout(2s, [&gr] {
+            return are_all_commit_indexes_the_same(gr);
+        }).get0();
+
+        auto leader = get_leader_raft(gr);
+        for (auto& [_, member] : gr.get_members()) {
+            member.consensus
+              ->write_snapshot(raft::write_snapshot_cfg(
+                leader->committed_offset(), random_iobuf(snapshot_data)))
+              .get0();
+        }
+        gr.enable_node(follower_id);
+        return follower_id;
+    }
+
+    iobuf read_snapshot_prefix(raft_node& node, size_t size) {
+        auto path
+          = std::filesystem::path(node.log->config().work_directory())
+            / storage::simple_snapshot_manager::default_snapshot_filename;
+        auto f = ss::open_file_dma(path.string(), ss::open_flags::ro).get0();
+        auto in = ss::make_file_input_stream(f);
+        auto ret = read_iobuf_exactly(in, size).get0();
+        in.close().get();
+        return ret;
+    }
+
+    void wait_for_snapshot_installed(raft_group& gr, raft_node& follower) {
+        auto leader = get_leader_raft(gr);
+        wait_for(
+          10s,
+          [&] {
+              return follower.consensus->start_offset()
+                       == leader->start_offset()
+                     && follower.consensus->get_snapshot_size()
+                          == leader->get_snapshot_size();
+          },
+          "snapshot installed on follower");
+        BOOST_REQUIRE_EQUAL(
+          get_snapshot_size_from_disk(follower),
+          leader->get_snapshot_size());
+    }
+};
+
+FIXTURE_TEST(test_follower_rejects_out_of_order_chunk, raft_test_fixture) {
+    raft_group gr = raft_group(raft::group_id(0), 3);
+    gr.enable_all();
+    auto leader_id = wait_for_group_leader(gr);
+    auto leader = gr.get_member(leader_id).consensus;
+    auto follower = gr.get_member(any_follower(gr, leader_id)).consensus;
+    const auto index = model::offset(1000);
+
+    auto reply = follower
+                   ->install_snapshot(make_chunk(
+                     *leader, *follower, index, 0, random_iobuf(100)))
+                   .get0();
+    BOOST_REQUIRE(reply.success);
+    BOOST_REQUIRE_EQUAL(reply.bytes_stored, 100);
+
+    // chunk at offset 200 doesn't continue the 100 bytes stored so far
+    reply = follower
+              ->install_snapshot(make_chunk(
+                *leader, *follower, index, 200, random_iobuf(100)))
+              .get0();
+    BOOST_REQUIRE(!reply.success);
+    BOOST_REQUIRE_EQUAL(reply.bytes_stored, 100);
+    BOOST_REQUIRE_EQUAL(follower->received_snapshot_bytes(), 100);
+
+    // chunk of a different snapshot, nothing of it is stored
+    reply = follower
+              ->install_snapshot(make_chunk(
+                *leader,
+                *follower,
+                model::next_offset(index),
+                100,
+                random_iobuf(100)))
+              .get0();
+    BOOST_REQUIRE(!reply.success);
+    BOOST_REQUIRE_EQUAL(reply.bytes_stored, 0);
+
+    // delivery continues from the reported offset
+    reply = follower
+              ->install_snapshot(make_chunk(
+                *leader, *follower, index, 100, random_iobuf(100)))
+              .get0();
+    BOOST_REQUIRE(reply.success);
+    BOOST_REQUIRE_EQUAL(reply.bytes_stored, 200);
+}
+
+FIXTURE_TEST(test_follower_rejects_chunk_with_invalid_crc, raft_test_fixture) {
+    raft_group gr = raft_group(raft::group_id(0), 3);
+    gr.enable_all();
+    auto leader_id = wait_for_group_leader(gr);
+    auto leader = gr.get_member(leader_id).consensus;
+    auto follower = gr.get_member(any_follower(gr, leader_id)).consensus;
+    const auto index = model::offset(1000);
+
+    auto reply = follower
+                   ->install_snapshot(make_chunk(
+                     *leader, *follower, index, 0, random_iobuf(100)))
+                   .get0();
+    BOOST_REQUIRE(reply.success);
+
+    auto corrupted = make_chunk(
+      *leader, *follower, index, 100, random_iobuf(100));
+    *corrupted.chunk_crc += 1;
+    reply = follower->install_snapshot(std::move(corrupted)).get0();
+    BOOST_REQUIRE(!reply.success);
+    BOOST_REQUIRE_EQUAL(reply.bytes_stored, 100);
+    BOOST_REQUIRE_EQUAL(follower->received_snapshot_bytes(), 100);
+
+    // the same chunk with a valid checksum is accepted
+    reply = follower
+              ->install_snapshot(make_chunk(
+                *leader, *follower, index, 100, random_iobuf(100)))
+              .get0();
+    BOOST_REQUIRE(reply.success);
+    BOOST_REQUIRE_EQUAL(reply.bytes_stored, 200);
+}
+
+FIXTURE_TEST(test_pipelined_snapshot_delivery, snapshot_delivery_fixture) {
+    // many small chunks with a window large enough to have several of them
+    // in flight at a time
+    snapshot_delivery_config cfg(4_KiB, 8, 100_MiB);
+    raft_group gr = raft_group(raft::group_id(0), 3);
+    gr.enable_all();
+
+    auto follower_id = recover_follower_with_snapshot(gr, 256_KiB);
+    BOOST_REQUIRE_GT(
+      get_leader_raft(gr)->get_snapshot_size(), 8 * 4_KiB);
+
+    wait_for_snapshot_installed(gr, gr.get_member(follower_id));
+    BOOST_REQUIRE(replicate_random_batches(gr, 5).get0());
+    wait_for(
+      10s,
+      [&gr] { return are_all_commit_indexes_the_same(gr); },
+      "After recovery state is consistent");
+    validate_logs_replication(gr);
+}
+
+FIXTURE_TEST(test_snapshot_delivery_resumed, snapshot_delivery_fixture) {
+    /**
+     * Snapshot delivery is throttled to a few chunks per second. Once the
+     * follower stored a couple of chunks, its partial snapshot is replaced
+     * with half a chunk of the same snapshot, which makes the follower reject
+     * the chunks the leader sends next. The leader must resume the delivery
+     * from the offset reported by the follower, so that from then on the
+     * follower only ever stores half a chunk more than a multiple of the chunk
+     * size, rather than starting over from the beginning.
+     */
+    constexpr size_t chunk_size = 4_KiB;
+    constexpr size_t resume_offset = chunk_size / 2;
+    snapshot_delivery_config cfg(
+      chunk_size, 1, 4 * chunk_size * ss::smp::count);
+    raft_group gr = raft_group(raft::group_id(0), 3);
+    gr.enable_all();
+
+    auto follower_id = recover_follower_with_snapshot(gr, 128_KiB);
+    auto& follower_node = gr.get_member(follower_id);
+    auto follower = follower_node.consensus;
+    auto leader = get_leader_raft(gr);
+
+    wait_for(
+      10s,
+      [&] { return follower->received_snapshot_bytes() >= 2 * chunk_size; },
+      "follower stored part of the snapshot");
+
+    auto& leader_node = gr.get_member(gr.get_leader_id().value());
+    auto reply = follower
+                   ->install_snapshot(make_chunk(
+                     *leader,
+                     *follower,
+                     model::prev_offset(leader->start_offset()),
+                     0,
+                     read_snapshot_prefix(leader_node, resume_offset)))
+                   .get0();
+    BOOST_REQUIRE(reply.success);
+    BOOST_REQUIRE_EQUAL(reply.bytes_stored, resume_offset);
+
+    bool resumed = false;
+    tests::cooperative_spin_wait_with_timeout(20s, [&] {
+        const auto stored = follower->received_snapshot_bytes();
+        const auto total = leader->get_snapshot_size();
+        // the last chunk of the snapshot may be shorter
+        if (stored > resume_offset && stored < total) {
+            BOOST_REQUIRE_EQUAL((stored - resume_offset) % chunk_size, 0);
+            resumed = true;
+        }
+        return follower->get_snapshot_size() == total;
+    }).get0();
+    BOOST_REQUIRE(resumed);
+    wait_for_snapshot_installed(gr, follower_node);
+}
@@ -7,7 +7,9 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "bytes/bytes.h"
 #include "compression/stream_zstd.h"
+#include "hashing/crc32c.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "model/record.h"
@@ -557,3 +559,87 @@ SEASTAR_THREAD_TEST_CASE(snapshot_metadata_backward_compatibility) {
     BOOST_REQUIRE_EQUAL(
       metadata.log_start_delta, raft::offset_translator_delta{});
 }
+
+SEASTAR_THREAD_TEST_CASE(install_snapshot_request_chunk_crc_roundtrip) {
+    auto chunk = bytes_to_iobuf(random_generators::get_bytes(1024));
+    crc::crc32c crc;
+    crc_extend_iobuf(crc, chunk);
+    raft::install_snapshot_request req{
+      .target_node_id = raft::vnode(model::node_id(1), model::revision_id(2)),
+      .term = model::term_id(3),
+      .group = raft::group_id(4),
+      .node_id = raft::vnode(model::node_id(5), model::revision_id(6)),
+      .last_included_index = model::offset(123),
+      .file_offset = 4096,
+      .chunk = chunk.copy(),
+      .done = false,
+      .chunk_crc = crc.value()};
+
+    auto d = serde::from_iobuf<raft::install_snapshot_request>(
+      serde::to_iobuf(std::move(req)));
+
+    BOOST_REQUIRE_EQUAL(d.file_offset, 4096);
+    BOOST_REQUIRE_EQUAL(d.last_included_index, model::offset(123));
+    BOOST_REQUIRE(d.chunk == chunk);
+    BOOST_REQUIRE(d.chunk_crc.has_value());
+    BOOST_REQUIRE_EQUAL(*d.chunk_crc, crc.value());
+
+    // requests sent over adl do not carry the checksum
+    raft::install_snapshot_request adl_req{
+      .target_node_id = d.target_node_id,
+      .term = d.term,
+      .group = d.group,
+      .node_id = d.node_id,
+      .last_included_index = d.last_included_index,
+      .file_offset = d.file_offset,
+      .chunk = d.chunk.copy(),
+      .done = d.done,
+      .chunk_crc = d.chunk_crc};
+    auto from_adl = serialize_roundtrip_rpc(std::move(adl_req));
+    BOOST_REQUIRE(!from_adl.chunk_crc.has_value());
+    BOOST_REQUIRE(from_adl.chunk == chunk);
+}
+
+SEASTAR_THREAD_TEST_CASE(append_entries_request_packed_batches_roundtrip) {
+    auto batches = model::test::make_random_batches(model::offset(1), 20, true);
+    for (auto& b : batches) {
+        b.set_term(model::term_id(7));
+    }
+
+    for (bool packed : {false, true}) {
+        ss::circular_buffer<model::record_batch> expected;
+        ss::circular_buffer<model::record_batch> to_send;
+        for (auto& b : batches) {
+            expected.push_back(b.copy());
+            to_send.push_back(b.copy());
+        }
+
+        raft::append_entries_request req(
+          raft::vnode(model::node_id(1), model::revision_id(10)),
+          raft::vnode(model::node_id(2), model::revision_id(20)),
+          raft::protocol_metadata{
+            .group = raft::group_id(1),
+            .commit_index = model::offset(10),
+            .term = model::term_id(7)},
+          model::make_memory_record_batch_reader(std::move(to_send)));
+        req.packed_batches = packed;
+
+        iobuf buf;
+        serde::write_async(buf, std::move(req)).get();
+        iobuf_parser parser(std::move(buf));
+        auto d = serde::read_async<raft::append_entries_request>(parser).get0();
+
+        BOOST_REQUIRE_EQUAL(d.meta.group, raft::group_id(1));
+        BOOST_REQUIRE_EQUAL(d.meta.commit_index, model::offset(10));
+        auto received = model::consume_reader_to_memory(
+                          std::move(d.batches()), model::no_timeout)
+                          .get0();
+        BOOST_REQUIRE_EQUAL(received.size(), expected.size());
+        for (size_t i = 0; i < received.size(); ++i) {
+            BOOST_REQUIRE_EQUAL(received[i], expected[i]);
+            BOOST_REQUIRE_EQUAL(
+              received[i].compressed(), expected[i].compressed());
+            BOOST_REQUIRE_EQUAL(received[i].term(), model::term_id(7));
+        }
+    }
+}
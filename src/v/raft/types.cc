@@ -9,6 +9,7 @@
 
 #include "raft/types.h"
 
+#include "model/adl_serde.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "raft/consensus_utils.h"
@@ -229,7 +230,7 @@ std::ostream& operator<<(std::ostream& o, const install_snapshot_request& r) {
       o,
       "{{term: {}, group: {}, target_node_id: {}, node_id: {}, "
       "last_included_index: {}, "
-      "file_offset: {}, chunk_size: {}, done: {}}}",
+      "file_offset: {}, chunk_size: {}, done: {}, chunk_crc: {}}}",
       r.term,
       r.group,
       r.target_node_id,
@@ -237,7 +238,8 @@ std::ostream& operator<<(std::ostream& o, const install_snapshot_request& r) {
       r.last_included_index,
       r.file_offset,
       r.chunk.size_bytes(),
-      r.done);
+      r.done,
+      r.chunk_crc);
     return o;
 }
 
@@ -576,6 +578,40 @@ void heartbeat_reply::serde_read(iobuf_parser& src, const serde::header& hdr) {
     }
 }
 
+namespace {
+/*
+ * the batch count of an append entries request is tagged with this bit when
+ * batches are encoded in the packed (on-disk) format. the bit can never be set
+ * in the legacy format since the batch count is bounded by the max request
+ * size, which lets readers tell the two formats apart without a version bump
+ * that older nodes would reject.
+ */
+constexpr uint32_t packed_batches_flag = 1U << 31U;
+
+void write_packed_batch(iobuf& out, model::record_batch&& batch) {
+    reflection::serialize(
+      out,
+      reflection::batch_header{
+        .bhdr = batch.header(),
+        .is_compressed = static_cast<int8_t>(batch.compressed() ? 1 : 0)});
+    // records are already encoded, so this only shares the fragments
+    reflection::serialize(out, std::move(batch).release_data());
+}
+
+model::record_batch read_packed_batch(iobuf_parser& in) {
+    auto hdr = reflection::adl<reflection::batch_header>{}.from(in);
+    // a slice of the request buffer, no record is decoded or copied
+    auto records = reflection::adl<iobuf>{}.from(in);
+    if (hdr.is_compressed == 1) {
+        return model::record_batch(
+          hdr.bhdr,
+          model::record_batch::compressed_records(std::move(records)));
+    }
+    return model::record_batch(
+      hdr.bhdr, std::move(records), model::record_batch::tag_ctor_ng{});
+}
+} // namespace
+
 ss::future<> append_entries_request::serde_async_write(iobuf& dst) {
     auto mem_batches = co_await model::consume_reader_to_memory(
       std::move(batches()), model::no_timeout);
@@ -583,11 +619,16 @@ ss::future<> append_entries_request::serde_async_write(iobuf& dst) {
     iobuf out;
     using serde::write;
 
-    write(out, static_cast<uint32_t>(mem_batches.size()));
+    auto batch_count = static_cast<uint32_t>(mem_batches.size());
+    write(out, packed_batches ? batch_count | packed_batches_flag : batch_count);
     for (auto& batch : mem_batches) {
-        // intentionally using reflection here for batches which are not yet
-        // supported with serde, but also have largely solidified.
-        reflection::serialize(out, std::move(batch));
+        if (packed_batches) {
+            write_packed_batch(out, std::move(batch));
+        } else {
+            // intentionally using reflection here for batches which are not
+            // yet supported with serde, but also have largely solidified.
+            reflection::serialize(out, std::move(batch));
+        }
         co_await ss::coroutine::maybe_yield();
     }
 
@@ -606,10 +647,17 @@ ss::future<> append_entries_request::serde_async_read(
     iobuf_parser in(std::move(tmp));
 
     auto batch_count = read_nested<uint32_t>(in, 0U);
+    const bool packed = (batch_count & packed_batches_flag) != 0;
+    batch_count &= ~packed_batches_flag;
+
     auto batches = ss::circular_buffer<model::record_batch>{};
     batches.reserve(batch_count);
     for (uint32_t i = 0; i < batch_count; ++i) {
-        batches.push_back(reflection::adl<model::record_batch>{}.from(in));
+        if (packed) {
+            batches.push_back(read_packed_batch(in));
+        } else {
+            batches.push_back(reflection::adl<model::record_batch>{}.from(in));
+        }
         co_await ss::coroutine::maybe_yield();
     }
 
@@ -174,6 +174,14 @@ struct follower_index_metadata {
      */
     heartbeats_suppressed suppress_heartbeats = heartbeats_suppressed::no;
     follower_req_seq last_suppress_heartbeats_seq{0};
+    /**
+     * Snapshot delivery progress reported by the follower. When snapshot
+     * delivery is interrupted the next recovery round resumes sending the
+     * snapshot from the last byte stored by the follower instead of starting
+     * from the beginning.
+     */
+    model::offset snapshot_delivery_index;
+    uint64_t snapshot_bytes_stored{0};
 
     friend std::ostream&
     operator<<(std::ostream& o, const follower_index_metadata& i);
@@ -255,13 +263,23 @@ struct append_entries_request
         return _batches.value();
     }
     flush_after_append flush;
+    /*
+     * when set, serde encodes batches in their on-disk format rather than
+     * record by record. the receiver then slices each batch out of the
+     * request buffer without materializing individual records. this is a
+     * sender side hint and is never serialized. it must only be set once all
+     * nodes understand the packed format (feature raft_packed_append_entries).
+     */
+    bool packed_batches{false};
     static append_entries_request make_foreign(append_entries_request&& req) {
-        return append_entries_request(
+        append_entries_request ret(
           req.node_id,
           req.target_node_id,
           std::move(req.meta),
           model::make_foreign_record_batch_reader(std::move(req.batches())),
           req.flush);
+        ret.packed_batches = req.packed_batches;
+        return ret;
     }
 
     friend std::ostream&
@@ -525,7 +543,7 @@ struct snapshot_metadata {
 struct install_snapshot_request
   : serde::envelope<
       install_snapshot_request,
-      serde::version<0>,
+      serde::version<1>,
       serde::compat_version<0>> {
     // node id to validate on receiver
     vnode target_node_id;
@@ -543,6 +561,8 @@ struct install_snapshot_request
     iobuf chunk;
     // true if this is the last chunk
     bool done;
+    // crc32c of the chunk, not set by senders using older protocol versions
+    std::optional<uint32_t> chunk_crc;
 
     raft::group_id target_group() const { return group; }
     vnode source_node() const { return node_id; }
@@ -563,7 +583,8 @@ struct install_snapshot_request
           last_included_index,
           file_offset,
           chunk,
-          done);
+          done,
+          chunk_crc);
     }
 };
 
@@ -586,7 +607,8 @@ public:
           .last_included_index = _ptr->last_included_index,
           .file_offset = _ptr->file_offset,
           .chunk = _ptr->chunk.copy(),
-          .done = _ptr->done};
+          .done = _ptr->done,
+          .chunk_crc = _ptr->chunk_crc};
     }
     raft::group_id target_group() const { return _ptr->target_group(); }
     vnode target_node() const { return _ptr->target_node_id; }
@@ -58,6 +58,7 @@
 #include "model/timeout_clock.h"
 #include "net/dns.h"
 #include "pandaproxy/schema_registry/api.h"
+#include "raft/group_manager.h"
 #include "raft/types.h"
 #include "redpanda/admin/api-doc/broker.json.h"
 #include "redpanda/admin/api-doc/cluster.json.h"
@@ -123,7 +124,8 @@ admin_server::admin_server(
   pandaproxy::schema_registry::api* schema_registry,
   ss::sharded<cloud_storage::topic_recovery_service>& topic_recovery_svc,
   ss::sharded<cluster::topic_recovery_status_frontend>&
-    topic_recovery_status_frontend)
+    topic_recovery_status_frontend,
+  ss::sharded<raft::group_manager>& raft_group_manager)
   : _log_level_timer([this] { log_level_timer_handler(); })
   , _server("admin")
   , _cfg(std::move(cfg))
@@ -138,7 +140,8 @@ admin_server::admin_server(
   , _self_test_frontend(self_test_frontend)
   , _schema_registry(schema_registry)
   , _topic_recovery_service(topic_recovery_svc)
-  , _topic_recovery_status_frontend(topic_recovery_status_frontend) {}
+  , _topic_recovery_status_frontend(topic_recovery_status_frontend)
+  , _raft_group_manager(raft_group_manager) {}
 
 ss::future<> admin_server::start() {
     configure_metrics_route();
@@ -3398,6 +3401,43 @@ void admin_server::register_debug_routes() {
                   ss::json::json_return_type(ans));
             });
       });
+
+    register_route<user>(
+      seastar::httpd::debug_json::get_raft_recovery_queue,
+      [this](std::unique_ptr<ss::httpd::request>)
+        -> ss::future<ss::json::json_return_type> {
+          using result_t = ss::httpd::debug_json::raft_recovery_waiter;
+          auto per_shard = co_await _raft_group_manager.map(
+            [](raft::group_manager& gm) {
+                std::vector<result_t> ret;
+                const auto now = raft::clock_type::now();
+                for (auto& w : gm.recovery_waiters()) {
+                    result_t r;
+                    r.ns = w.ntp.ns;
+                    r.topic = w.ntp.tp.topic;
+                    r.partition_id = w.ntp.tp.partition;
+                    r.follower = w.follower.id();
+                    r.shard = ss::this_shard_id();
+                    r.in_sync_replicas = w.priority.in_sync_replicas;
+                    r.lag = w.priority.lag;
+                    r.wait_time_ms
+                      = std::chrono::duration_cast<std::chrono::milliseconds>(
+                          now - w.enqueued_at)
+                          .count();
+                    ret.push_back(std::move(r));
+                }
+                return ret;
+            });
+
+          std::vector<result_t> ans;
+          for (auto& shard_waiters : per_shard) {
+              std::move(
+                shard_waiters.begin(),
+                shard_waiters.end(),
+                std::back_inserter(ans));
+          }
+          co_return ss::json::json_return_type(std::move(ans));
+      });
 }
 ss::future<ss::json::json_return_type>
 admin_server::get_partition_balancer_status_handler(
@@ -3663,6 +3703,7 @@ map_status_to_json(cluster::single_status status) {
         c.pending_downloads = count.pending_downloads;
         c.successful_downloads = count.successful_downloads;
         c.failed_downloads = count.failed_downloads;
+        c.downloaded_bytes = count.downloaded_bytes;
         status_json.topic_download_counts.push(c);
     }
 
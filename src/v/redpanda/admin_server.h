@@ -16,6 +16,7 @@
 #include "coproc/partition_manager.h"
 #include "model/metadata.h"
 #include "pandaproxy/schema_registry/fwd.h"
+#include "raft/fwd.h"
 #include "rpc/connection_cache.h"
 #include "seastarx.h"
 #include "utils/request_auth.h"
@@ -66,7 +67,8 @@ public:
       ss::sharded<cluster::self_test_frontend>&,
       pandaproxy::schema_registry::api*,
       ss::sharded<cloud_storage::topic_recovery_service>&,
-      ss::sharded<cluster::topic_recovery_status_frontend>&);
+      ss::sharded<cluster::topic_recovery_status_frontend>&,
+      ss::sharded<raft::group_manager>&);
 
     ss::future<> start();
     ss::future<> stop();
@@ -427,4 +429,5 @@ private:
     ss::sharded<cloud_storage::topic_recovery_service>& _topic_recovery_service;
     ss::sharded<cluster::topic_recovery_status_frontend>&
       _topic_recovery_status_frontend;
+    ss::sharded<raft::group_manager>& _raft_group_manager;
 };
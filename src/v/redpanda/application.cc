@@ -827,7 +827,8 @@ void application::configure_admin_server() {
       std::ref(self_test_frontend),
       _schema_registry.get(),
       std::ref(topic_recovery_service),
-      std::ref(topic_recovery_status_frontend))
+      std::ref(topic_recovery_status_frontend),
+      std::ref(raft_group_manager))
       .get();
 }
 
@@ -956,6 +957,18 @@ make_upload_controller_config(ss::scheduling_group sg) {
       config::shard_local_cfg().cloud_storage_upload_ctrl_max_shares()};
 }
 
+// The server credentials are built on every shard and seastar generates the
+// session ticket key when the credentials are built, there is no way to set
+// the key from outside. A ticket can therefore only be decrypted by the shard
+// which issued it, which is why the resumption is opt-in.
+static void maybe_enable_tls_session_resumption(
+  std::optional<ss::tls::credentials_builder>& builder) {
+    if (builder && config::shard_local_cfg().tls_enable_session_resumption()) {
+        builder->set_session_resume_mode(
+          ss::tls::session_resume_mode::TLS13_SESSION_TICKET);
+    }
+}
+
 // add additional services in here
 void application::wire_up_runtime_services(model::node_id node_id) {
     wire_up_redpanda_services(node_id);
@@ -1408,6 +1421,7 @@ void application::wire_up_redpanda_services(model::node_id node_id) {
                         .get();
                       auto kafka_builder
                         = it->config.get_credentials_builder().get0();
+                      maybe_enable_tls_session_resumption(kafka_builder);
                       credentails
                         = kafka_builder
                             ? kafka_builder
@@ -1584,10 +1598,13 @@ void application::wire_up_bootstrap_services() {
                 = config::shard_local_cfg().rpc_server_tcp_recv_buf;
               c.tcp_send_buf
                 = config::shard_local_cfg().rpc_server_tcp_send_buf;
+              c.stream_recv_buf
+                = config::shard_local_cfg().rpc_server_stream_recv_buf;
               auto rpc_builder = config::node()
                                    .rpc_server_tls()
                                    .get_credentials_builder()
                                    .get0();
+              maybe_enable_tls_session_resumption(rpc_builder);
               auto credentials
                 = rpc_builder
                     ? rpc_builder
@@ -1861,6 +1878,19 @@ void application::start_runtime_services(
                 _rpc.local().set_use_service_unavailable();
             });
       });
+    ssx::background = feature_table.invoke_on_all(
+      [this](features::feature_table& ft) {
+          return ft.await_feature_then(
+            features::feature::rpc_lz4_compression, [this] {
+                if (ss::this_shard_id() == 0) {
+                    vlog(_log.debug, "Activating lz4 RPC reply compression");
+                }
+                // lz4 is much cheaper than zstd for the large replies, and
+                // replies that don't compress well are skipped altogether.
+                _rpc.local().set_reply_compression(
+                  rpc::compression_type::lz4);
+            });
+      });
 
     thread_worker->start().get();
 
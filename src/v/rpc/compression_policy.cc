@@ -0,0 +1,53 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "rpc/compression_policy.h"
+
+namespace rpc {
+
+namespace {
+// weight of the most recent sample in the smoothed ratio
+constexpr double sample_weight = 0.25;
+} // namespace
+
+bool compression_policy::should_compress(uint32_t method_id) {
+    auto it = _methods.find(method_id);
+    if (it == _methods.end() || it->second.ratio < poor_ratio) {
+        return true;
+    }
+    if (++it->second.skipped >= probe_interval) {
+        it->second.skipped = 0;
+        return true;
+    }
+    return false;
+}
+
+void compression_policy::record(
+  uint32_t method_id, size_t original, size_t compressed) {
+    if (original == 0) {
+        return;
+    }
+    const auto sample = static_cast<double>(compressed)
+                        / static_cast<double>(original);
+    auto [it, inserted] = _methods.try_emplace(method_id);
+    auto& state = it->second;
+    if (inserted) {
+        state.ratio = sample;
+    } else {
+        state.ratio = (1 - sample_weight) * state.ratio
+                      + sample_weight * sample;
+    }
+}
+
+double compression_policy::ratio(uint32_t method_id) const {
+    auto it = _methods.find(method_id);
+    return it == _methods.end() ? 0 : it->second.ratio;
+}
+
+} // namespace rpc
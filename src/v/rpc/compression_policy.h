@@ -0,0 +1,56 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include <absl/container/flat_hash_map.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace rpc {
+
+/**
+ * Tracks the compression ratio observed for the messages of each rpc method
+ * and stops compressing the methods whose payloads do not shrink, e.g. raft
+ * replication of batches that producers already compressed. A message is
+ * still compressed every probe_interval messages so that a change in the
+ * payload mix of a method is eventually noticed.
+ *
+ * A policy is owned by a single connection or server shard and is not
+ * thread safe.
+ */
+class compression_policy {
+public:
+    /// compressed size above this fraction of the original size is poor
+    static constexpr double poor_ratio = 0.9;
+    /// messages sent uncompressed before the ratio is sampled again
+    static constexpr uint32_t probe_interval = 64;
+
+    /// returns true if the next message of the method should be compressed
+    bool should_compress(uint32_t method_id);
+
+    /// records the outcome of compressing a message of the method
+    void record(uint32_t method_id, size_t original, size_t compressed);
+
+    /// the smoothed compressed/original ratio, 0 if nothing was recorded
+    double ratio(uint32_t method_id) const;
+
+private:
+    struct method_state {
+        double ratio{0};
+        uint32_t skipped{0};
+    };
+
+    absl::flat_hash_map<uint32_t, method_state> _methods;
+};
+
+} // namespace rpc
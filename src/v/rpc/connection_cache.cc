@@ -10,6 +10,9 @@
 #include "rpc/connection_cache.h"
 
 #include "rpc/backoff_policy.h"
+#include "ssx/sformat.h"
+
+#include <seastar/core/when_all.hh>
 
 #include <fmt/format.h>
 
@@ -17,6 +20,22 @@
 
 namespace rpc {
 
+namespace {
+// same policy as the clients created by the cluster for the latency lane
+constexpr auto bulk_lane_min_backoff = std::chrono::seconds(1);
+constexpr auto bulk_lane_max_backoff = std::chrono::seconds(15);
+
+ss::future<>
+stop_transports(const connection_cache::node_transports& transports) {
+    if (!transports.bulk) {
+        return transports.latency->stop();
+    }
+    return ss::when_all_succeed(
+             transports.latency->stop(), transports.bulk->stop())
+      .discard_result();
+}
+} // namespace
+
 connection_cache::connection_cache(std::optional<connection_cache_label> label)
   : _label(std::move(label)) {}
 
@@ -33,28 +52,52 @@ ss::future<> connection_cache::emplace(
         if (_cache.find(n) != _cache.end()) {
             return;
         }
+        auto latency = ss::make_lw_shared<rpc::reconnect_transport>(
+          c, std::move(backoff_policy), _label, n);
         _cache.emplace(
           n,
-          ss::make_lw_shared<rpc::reconnect_transport>(
-            std::move(c), std::move(backoff_policy), _label, n));
+          node_transports{
+            .latency = std::move(latency), .config = std::move(c)});
     });
 }
+
+connection_cache::transport_ptr
+connection_cache::get(model::node_id n, connection_lane lane) {
+    auto& transports = _cache.find(n)->second;
+    if (lane == connection_lane::latency) {
+        return transports.latency;
+    }
+    if (!transports.bulk) {
+        // the bulk lane reports its metrics under its own label so that the
+        // queues of both lanes can be told apart
+        auto label = connection_cache_label(
+          _label ? ssx::sformat("{}_bulk", (*_label)()) : "bulk");
+        transports.bulk = ss::make_lw_shared<rpc::reconnect_transport>(
+          transports.config,
+          make_exponential_backoff_policy<clock_type>(
+            bulk_lane_min_backoff, bulk_lane_max_backoff),
+          label,
+          n);
+    }
+    return transports.bulk;
+}
 ss::future<> connection_cache::remove(model::node_id n) {
     return _mutex
-      .with([this, n]() -> transport_ptr {
+      .with([this, n]() -> std::optional<node_transports> {
           auto it = _cache.find(n);
           if (it == _cache.end()) {
-              return nullptr;
+              return std::nullopt;
           }
-          auto ptr = it->second;
+          auto transports = std::move(it->second);
           _cache.erase(it);
-          return ptr;
+          return transports;
       })
-      .then([](transport_ptr ptr) {
-          if (!ptr) {
+      .then([](std::optional<node_transports> transports) {
+          if (!transports) {
               return ss::now();
           }
-          return ptr->stop().finally([ptr] {});
+          return stop_transports(*transports)
+            .finally([transports = std::move(transports)] {});
       });
 }
 
@@ -62,8 +105,8 @@ ss::future<> connection_cache::remove(model::node_id n) {
 ss::future<> connection_cache::stop() {
     return _mutex.with([this]() {
         return parallel_for_each(_cache, [](auto& it) {
-            auto& [_, cli] = it;
-            return cli->stop();
+            auto& [_, transports] = it;
+            return stop_transports(transports);
         });
         _cache.clear();
         // mark mutex as broken to prevent new connections from being created
@@ -27,11 +27,24 @@
 #include <unordered_map>
 
 namespace rpc {
+/**
+ * Keeps the client connections of this shard to other nodes. Every node is
+ * reached over one connection per connection_lane. The latency lane is
+ * created with the node, the bulk lane is connected the first time it is
+ * used, so nodes that never see bulk traffic keep a single connection.
+ */
 class connection_cache final
   : public ss::peering_sharded_service<connection_cache> {
 public:
     using transport_ptr = ss::lw_shared_ptr<rpc::reconnect_transport>;
-    using underlying = std::unordered_map<model::node_id, transport_ptr>;
+
+    struct node_transports {
+        transport_ptr latency;
+        transport_ptr bulk;
+        transport_configuration config;
+    };
+
+    using underlying = std::unordered_map<model::node_id, node_transports>;
     using iterator = typename underlying::iterator;
 
     static inline ss::shard_id shard_for(
@@ -46,7 +59,11 @@ public:
     bool contains(model::node_id n) const {
         return _cache.find(n) != _cache.end();
     }
-    transport_ptr get(model::node_id n) const { return _cache.find(n)->second; }
+    transport_ptr get(model::node_id n) const {
+        return _cache.find(n)->second.latency;
+    }
+    /// \brief returns the transport of the lane, creating it if needed
+    transport_ptr get(model::node_id n, connection_lane lane);
 
     /// \brief needs to be a future, because mutations may come from different
     /// fibers and they need to be synchronized
@@ -77,20 +94,21 @@ public:
       ss::shard_id src_shard,
       model::node_id node_id,
       timeout_spec connection_timeout,
-      Func&& f) {
+      Func&& f,
+      connection_lane lane = connection_lane::latency) {
         using ret_t = result_wrap_t<std::invoke_result_t<Func, Protocol>>;
         auto shard = rpc::connection_cache::shard_for(self, src_shard, node_id);
 
         return container().invoke_on(
           shard,
-          [node_id, f = std::forward<Func>(f), connection_timeout](
+          [node_id, f = std::forward<Func>(f), connection_timeout, lane](
             rpc::connection_cache& cache) mutable {
               if (!cache.contains(node_id)) {
                   // No client available
                   return ss::futurize<ret_t>::convert(
                     rpc::make_error_code(errc::missing_node_rpc_client));
               }
-              return cache.get(node_id)
+              return cache.get(node_id, lane)
                 ->get_connected(connection_timeout.timeout_at())
                 .then([f = std::forward<Func>(f)](
                         result<rpc::transport*> transport) mutable {
@@ -111,13 +129,15 @@ public:
       ss::shard_id src_shard,
       model::node_id node_id,
       Timeout connection_timeout,
-      Func&& f) {
+      Func&& f,
+      connection_lane lane = connection_lane::latency) {
         return with_node_client<Protocol, Func>(
           self,
           src_shard,
           node_id,
           timeout_spec::from_either(connection_timeout),
-          std::forward<Func>(f));
+          std::forward<Func>(f),
+          lane);
     }
 
     /// If a reconnect_transport is in a backed-off state, reset
@@ -134,8 +154,11 @@ public:
                   // No client available
                   return;
               }
-              auto recon_transport = cache.get(node_id);
-              recon_transport->reset_backoff();
+              auto& transports = cache._cache.find(node_id)->second;
+              transports.latency->reset_backoff();
+              if (transports.bulk) {
+                  transports.bulk->reset_backoff();
+              }
           });
     }
 
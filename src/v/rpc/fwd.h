@@ -13,6 +13,7 @@
 
 namespace rpc {
 
+class compression_policy;
 class connection_cache;
 
 } // namespace rpc
@@ -9,9 +9,11 @@
 
 #include "bytes/iobuf.h"
 #include "bytes/scattered_message.h"
+#include "compression/async_stream_lz4.h"
 #include "compression/async_stream_zstd.h"
 #include "hashing/xx.h"
 #include "reflection/adl.h"
+#include "rpc/compression_policy.h"
 #include "rpc/types.h"
 #include "vassert.h"
 
@@ -31,6 +33,8 @@ ss::future<ss::scattered_message<char>> netbuf::as_scattered() && {
     // Move object members into coroutine before first supension.
     iobuf out_buf = std::move(_out);
     auto hdr = std::move(_hdr);
+    auto policy = _compression_policy;
+    const auto method_id = _compression_method_id;
 
     if (hdr.correlation_id == 0 || hdr.meta == 0) {
         throw std::runtime_error(
@@ -39,9 +43,25 @@ ss::future<ss::scattered_message<char>> netbuf::as_scattered() && {
     }
     if (
       out_buf.size_bytes() >= _min_compression_bytes
-      && rpc::compression_type::zstd == hdr.compression) {
-        auto& zstd_inst = compression::async_stream_zstd_instance();
-        out_buf = co_await zstd_inst.compress(std::move(out_buf));
+      && hdr.compression != rpc::compression_type::none
+      && (!policy || policy->should_compress(method_id))) {
+        const auto original_size = out_buf.size_bytes();
+        switch (hdr.compression) {
+        case rpc::compression_type::zstd: {
+            auto& zstd_inst = compression::async_stream_zstd_instance();
+            out_buf = co_await zstd_inst.compress(std::move(out_buf));
+            break;
+        }
+        case rpc::compression_type::lz4:
+            out_buf = co_await compression::async_stream_lz4::compress(
+              std::move(out_buf));
+            break;
+        case rpc::compression_type::none:
+            break;
+        }
+        if (policy) {
+            policy->record(method_id, original_size, out_buf.size_bytes());
+        }
     } else {
         // didn't meet min requirements
         hdr.compression = rpc::compression_type::none;
@@ -12,6 +12,7 @@
 #pragma once
 
 #include "bytes/iostream.h"
+#include "compression/async_stream_lz4.h"
 #include "compression/async_stream_zstd.h"
 #include "hashing/xx.h"
 #include "likely.h"
@@ -287,6 +288,10 @@ ss::future<T> parse_type(ss::input_stream<char>& in, const header& h) {
             iobuf_fut = zstd_inst.uncompress(std::move(io));
             break;
         }
+        case compression_type::lz4:
+            iobuf_fut = compression::async_stream_lz4::uncompress(
+              std::move(io));
+            break;
         default:
             iobuf_fut = ss::make_exception_future<iobuf>(std::runtime_error(
               fmt::format("no compression supported. header: {}", h)));
@@ -76,7 +76,9 @@ ss::future<> rpc_server::apply(ss::lw_shared_ptr<net::connection> conn) {
 ss::future<>
 rpc_server::send_reply(ss::lw_shared_ptr<server_context_impl> ctx, netbuf buf) {
     buf.set_min_compression_bytes(reply_min_compression_bytes);
-    buf.set_compression(rpc::compression_type::zstd);
+    buf.set_compression(_reply_compression);
+    buf.set_compression_policy(
+      &_reply_compression_policy, ctx->get_header().meta);
     buf.set_correlation_id(ctx->get_header().correlation_id);
 
     auto view = co_await std::move(buf).as_scattered();
@@ -10,6 +10,7 @@
 
 #include "config/configuration.h"
 #include "net/server.h"
+#include "rpc/compression_policy.h"
 #include "rpc/service.h"
 #include "vassert.h"
 
@@ -39,6 +40,9 @@ public:
 
     void set_use_service_unavailable() { _service_unavailable_allowed = true; }
 
+    // Compression applied to replies larger than the compression threshold.
+    void set_reply_compression(compression_type c) { _reply_compression = c; }
+
     // Adds the given services to the protocol.
     // May be called whether or not the server has already been started.
     void add_services(std::vector<std::unique_ptr<service>> services) {
@@ -74,6 +78,8 @@ private:
 
     bool _all_services_added{false};
     bool _service_unavailable_allowed{false};
+    compression_type _reply_compression{compression_type::zstd};
+    compression_policy _reply_compression_policy;
     std::vector<std::unique_ptr<service>> _services;
 };
 
@@ -7,6 +7,7 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "rpc/compression_policy.h"
 #include "rpc/parse_utils.h"
 
 #include <seastar/core/thread.hh>
@@ -45,3 +46,70 @@ SEASTAR_THREAD_TEST_CASE(netbuf_pod) {
     BOOST_REQUIRE_EQUAL(src.y, dst.y);
     BOOST_REQUIRE_EQUAL(src.z, dst.z);
 }
+
+SEASTAR_THREAD_TEST_CASE(netbuf_lz4_roundtrip) {
+    auto n = rpc::netbuf();
+    n.set_correlation_id(42);
+    n.set_service_method({"test::test", 66});
+    n.set_compression(rpc::compression_type::lz4);
+    n.set_min_compression_bytes(0);
+    const auto payload = ss::sstring(4096, 'x');
+    reflection::serialize(n.buffer(), payload);
+
+    auto bufs = std::move(n).as_scattered().get().release().release();
+    auto in = make_iobuf_input_stream(iobuf(std::move(bufs)));
+    auto hdr = rpc::parse_header(in).get0();
+    BOOST_REQUIRE(hdr.has_value());
+    BOOST_REQUIRE(hdr->compression == rpc::compression_type::lz4);
+    BOOST_REQUIRE_LT(hdr->payload_size, payload.size());
+    auto dst = rpc::parse_type<ss::sstring, rpc::default_message_codec>(
+                 in, *hdr)
+                 .get0();
+    BOOST_REQUIRE_EQUAL(dst, payload);
+}
+
+SEASTAR_THREAD_TEST_CASE(compression_policy_skips_poor_ratio) {
+    rpc::compression_policy policy;
+    constexpr uint32_t compressible = 1;
+    constexpr uint32_t incompressible = 2;
+
+    BOOST_REQUIRE(policy.should_compress(compressible));
+    BOOST_REQUIRE(policy.should_compress(incompressible));
+    policy.record(compressible, 1000, 200);
+    policy.record(incompressible, 1000, 1010);
+
+    BOOST_REQUIRE(policy.should_compress(compressible));
+    // poorly compressing method is probed once per interval
+    size_t compressed = 0;
+    for (uint32_t i = 0; i < rpc::compression_policy::probe_interval; ++i) {
+        compressed += policy.should_compress(incompressible) ? 1 : 0;
+    }
+    BOOST_REQUIRE_EQUAL(compressed, 1);
+
+    // payload becomes compressible again: the probes pick it up
+    while (policy.ratio(incompressible)
+           >= rpc::compression_policy::poor_ratio) {
+        policy.record(incompressible, 1000, 100);
+    }
+    BOOST_REQUIRE(policy.should_compress(incompressible));
+}
+
+SEASTAR_THREAD_TEST_CASE(netbuf_compression_policy_skips_incompressible) {
+    rpc::compression_policy policy;
+    constexpr uint32_t method_id = 66;
+    policy.record(method_id, 1000, 1000);
+
+    auto n = rpc::netbuf();
+    n.set_correlation_id(42);
+    n.set_service_method({"test::test", method_id});
+    n.set_compression(rpc::compression_type::zstd);
+    n.set_min_compression_bytes(0);
+    n.set_compression_policy(&policy, method_id);
+    reflection::serialize(n.buffer(), ss::sstring(4096, 'x'));
+
+    auto bufs = std::move(n).as_scattered().get().release().release();
+    auto in = make_iobuf_input_stream(iobuf(std::move(bufs)));
+    auto hdr = rpc::parse_header(in).get0();
+    BOOST_REQUIRE(hdr.has_value());
+    BOOST_REQUIRE(hdr->compression == rpc::compression_type::none);
+}
@@ -212,6 +212,45 @@ FIXTURE_TEST(echo_from_cache, rpc_integration_fixture) {
     }
 }
 
+FIXTURE_TEST(echo_from_cache_lanes, rpc_integration_fixture) {
+    configure_server();
+    register_services();
+    start_server();
+    rpc::connection_cache cache;
+    const auto node_id = model::node_id(0);
+    cache
+      .emplace(
+        node_id,
+        client_config(),
+        rpc::make_exponential_backoff_policy<rpc::clock_type>(
+          std::chrono::milliseconds(1), std::chrono::milliseconds(1)))
+      .get();
+    auto cleanup = ss::defer([&cache] { cache.stop().get(); });
+
+    auto latency = cache.get(node_id, rpc::connection_lane::latency);
+    auto bulk = cache.get(node_id, rpc::connection_lane::bulk);
+    BOOST_REQUIRE(latency == cache.get(node_id));
+    BOOST_REQUIRE(bulk != latency);
+    BOOST_REQUIRE(bulk == cache.get(node_id, rpc::connection_lane::bulk));
+
+    // each lane is served over its own connection
+    for (auto& lane : {latency, bulk}) {
+        const auto payload = random_generators::gen_alphanum_string(100);
+        auto transport = lane->get_connected(rpc::clock_type::now() + 5s).get();
+        BOOST_REQUIRE(transport.has_value());
+        echo::echo_client_protocol client(*transport.value());
+        auto ret = client
+                     .echo(
+                       echo::echo_req{.str = payload},
+                       rpc::client_opts(rpc::clock_type::now() + 100ms))
+                     .get();
+        BOOST_REQUIRE(ret.has_value());
+        BOOST_CHECK_EQUAL(ret.value().data.str, payload);
+    }
+    BOOST_REQUIRE(latency->is_valid());
+    BOOST_REQUIRE(bulk->is_valid());
+}
+
 FIXTURE_TEST(echo_round_trip_tls, rpc_integration_fixture) {
     auto creds_builder = config::tls_config(
                            true,
@@ -238,6 +277,46 @@ FIXTURE_TEST(echo_round_trip_tls, rpc_integration_fixture) {
     BOOST_REQUIRE_EQUAL(ret.value().data.str, payload);
 }
 
+FIXTURE_TEST(echo_round_trip_tls_session_resumption, rpc_integration_fixture) {
+    auto creds_builder = config::tls_config(
+                           true,
+                           config::key_cert{"redpanda.key", "redpanda.crt"},
+                           "root_certificate_authority.chain_cert",
+                           false)
+                           .get_credentials_builder()
+                           .get0();
+    creds_builder->set_session_resume_mode(
+      ss::tls::session_resume_mode::TLS13_SESSION_TICKET);
+
+    configure_server(creds_builder);
+    register_services();
+    start_server();
+
+    rpc::transport transport(client_config(creds_builder));
+    auto cleanup = ss::defer([&transport] { transport.stop().get(); });
+    echo::echo_client_protocol client(transport);
+
+    for (int i = 0; i < 2; ++i) {
+        transport.connect(model::no_timeout).get();
+        // the session is saved once the first reply was read, so it is
+        // in place by the time the second reply arrives
+        for (int r = 0; r < 2; ++r) {
+            const auto payload = random_generators::gen_alphanum_string(100);
+            auto ret = client
+                         .echo(
+                           echo::echo_req{.str = payload},
+                           rpc::client_opts(rpc::no_timeout))
+                         .get();
+            BOOST_REQUIRE(ret.has_value());
+            BOOST_REQUIRE_EQUAL(ret.value().data.str, payload);
+        }
+        BOOST_REQUIRE(transport.has_tls_session());
+        // The first connection performs a full handshake, the second one
+        // resumes the session saved by the first one.
+        BOOST_REQUIRE_EQUAL(transport.is_tls_session_resumed(), i > 0);
+    }
+}
+
 class temporary_dir {
 public:
     temporary_dir()
@@ -348,7 +348,9 @@ ss::future<> transport::do_reads() {
                   fail_outstanding_futures();
                   return ss::make_ready_future<>();
               }
-              return dispatch(std::move(h.value()));
+              return dispatch(std::move(h.value())).then([this] {
+                  return maybe_save_tls_session();
+              });
           });
       });
 }
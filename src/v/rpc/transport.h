@@ -15,6 +15,7 @@
 #include "net/transport.h"
 #include "outcome.h"
 #include "reflection/async_adl.h"
+#include "rpc/compression_policy.h"
 #include "rpc/errc.h"
 #include "rpc/parse_utils.h"
 #include "rpc/response_handler.h"
@@ -217,6 +218,9 @@ private:
      */
     transport_version _default_version;
 
+    // skips compression of requests for methods that don't compress well
+    compression_policy _compression_policy;
+
     friend class ::rpc_integration_fixture_oc_ns_adl_serde_no_upgrade;
     friend class ::rpc_integration_fixture_oc_ns_adl_only_no_upgrade;
     void set_version(transport_version v) { _version = v; }
@@ -339,6 +343,7 @@ transport::send_typed_versioned(
     auto b = std::make_unique<rpc::netbuf>();
     b->set_compression(opts.compression);
     b->set_min_compression_bytes(opts.min_compression_bytes);
+    b->set_compression_policy(&_compression_policy, method.id);
     auto raw_b = b.get();
     raw_b->set_service_method(method);
 
@@ -76,4 +76,14 @@ std::ostream& operator<<(std::ostream& o, transport_version v) {
     return o;
 }
 
+std::ostream& operator<<(std::ostream& o, connection_lane l) {
+    switch (l) {
+    case connection_lane::latency:
+        return o << "latency";
+    case connection_lane::bulk:
+        return o << "bulk";
+    }
+    return o << "unknown";
+}
+
 } // namespace rpc
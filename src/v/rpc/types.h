@@ -16,6 +16,7 @@
 #include "net/types.h"
 #include "net/unresolved_address.h"
 #include "outcome.h"
+#include "rpc/fwd.h"
 #include "seastarx.h"
 #include "ssx/semaphore.h"
 #include "utils/hdr_hist.h"
@@ -161,17 +162,34 @@ inline constexpr timeout_spec timeout_spec::none = {
 using connection_cache_label
   = named_type<ss::sstring, struct connection_cache_label_tag>;
 
+/**
+ * Client connections to a node are split into lanes, each with its own
+ * connection, so that bulk transfers (recovery, snapshots) do not delay the
+ * latency sensitive requests (heartbeats, votes, replication) queued behind
+ * them on the same connection.
+ */
+enum class connection_lane : uint8_t {
+    latency = 0,
+    bulk,
+};
+std::ostream& operator<<(std::ostream&, connection_lane);
+
 enum class compression_type : uint8_t {
     none = 0,
     zstd,
+    // NOTE: peers running versions that predate lz4 support fail to decode
+    // lz4 frames. lz4 should only be used once feature::rpc_lz4_compression
+    // is active.
+    lz4,
     min = none,
-    max = zstd,
+    max = lz4,
 };
 
 struct negotiation_frame {
     int8_t version = 0;
     /// \brief 0 - no compression
     ///        1 - zstd
+    ///        2 - lz4
     compression_type compression = compression_type::none;
 };
 
@@ -300,6 +318,8 @@ struct client_opts {
      * to control caller resources.
      */
     resource_units_t resource_units;
+    /// connection lane carrying the request, see connection_cache
+    connection_lane lane{connection_lane::latency};
 };
 
 /// \brief used to pass environment context to the class
@@ -363,6 +383,10 @@ public:
     void set_compression(rpc::compression_type c);
     void set_service_method(method_info);
     void set_min_compression_bytes(size_t);
+    /// \brief skip compression for messages of the given method when the
+    /// policy observed that they don't compress well. for replies the method
+    /// is the one of the request being answered.
+    void set_compression_policy(compression_policy*, uint32_t method_id);
     void set_version(transport_version v) { _hdr.version = v; }
     iobuf& buffer();
 
@@ -380,6 +404,8 @@ public:
 private:
     const char* _name = nullptr;
     size_t _min_compression_bytes{1024};
+    compression_policy* _compression_policy{nullptr};
+    uint32_t _compression_method_id{0};
     header _hdr;
     iobuf _out;
 };
@@ -403,6 +429,11 @@ inline void netbuf::set_service_method(method_info info) {
 inline void netbuf::set_min_compression_bytes(size_t min) {
     _min_compression_bytes = min;
 }
+inline void
+netbuf::set_compression_policy(compression_policy* policy, uint32_t method_id) {
+    _compression_policy = policy;
+    _compression_method_id = method_id;
+}
 
 class method_probes {
 public:
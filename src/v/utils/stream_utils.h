@@ -76,10 +76,15 @@ public:
         (void)produce();
     }
 
-    /// Stop consuming the input stream
+    /// Stop consuming the input stream and close it
     ss::future<> stop() {
         _pcond.broadcast();
+        // The producer might be waiting for the buffers which will never be
+        // consumed by the detached clients.
+        _buffer.clear();
+        _sem.broken();
         co_await _gate.close();
+        co_await _in.close();
     }
 
     /// Detach client with 'index' from the fanout
@@ -819,6 +819,14 @@ class Admin:
         return self._request("GET", f"debug/controller_status",
                              node=node).json()
 
+    def get_raft_recovery_queue(self, node):
+        """
+        Get raft recoveries waiting for recovery memory on node, ordered
+        from the highest priority
+        """
+        return self._request("GET", "debug/raft_recovery_queue",
+                             node=node).json()
+
     def get_cluster_uuid(self, node):
         try:
             r = self._request("GET", "cluster/uuid", node=node)
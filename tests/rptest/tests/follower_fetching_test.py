@@ -0,0 +1,96 @@
+# Copyright 2022 Redpanda Data, Inc.
+#
+# Use of this software is governed by the Business Source License
+# included in the file licenses/BSL.md
+#
+# As of the Change Date specified in that file, in accordance with
+# the Business Source License, use of this software will be governed
+# by the Apache License, Version 2.0
+
+from ducktape.utils.util import wait_until
+from confluent_kafka import Consumer, Producer
+
+from rptest.clients.types import TopicSpec
+from rptest.services.admin import Admin
+from rptest.services.cluster import cluster
+from rptest.tests.redpanda_test import RedpandaTest
+
+
+class FollowerFetchingTest(RedpandaTest):
+    def __init__(self, test_context):
+        super(FollowerFetchingTest, self).__init__(
+            test_context=test_context,
+            num_brokers=3,
+            extra_rp_conf={'enable_follower_fetching': True})
+
+    def setUp(self):
+        # Racks are assigned per node in the test body
+        pass
+
+    def _records_fetched(self, node, topic):
+        total = 0
+        for family in self.redpanda.metrics(node):
+            for sample in family.samples:
+                if "cluster_partition_records_fetched" not in sample.name:
+                    continue
+                if sample.labels["topic"] != topic:
+                    continue
+                total += int(sample.value)
+        return total
+
+    @cluster(num_nodes=3)
+    def test_fetch_from_follower_in_client_rack(self):
+        """
+        Every broker sits in its own rack. A consumer placed in the rack of a
+        follower should be redirected by the leader to that follower and
+        read the whole partition from it.
+        """
+        for ix, node in enumerate(self.redpanda.nodes):
+            self.redpanda.set_extra_node_conf(node, {'rack': f"rack-{ix}"})
+        self.redpanda.start()
+
+        topic = TopicSpec(partition_count=1, replication_factor=3)
+        self.client().create_topic(topic)
+
+        msg_count = 100
+        producer = Producer({
+            'bootstrap.servers': self.redpanda.brokers(),
+            'acks': 'all'
+        })
+        for i in range(msg_count):
+            producer.produce(topic.name, key=str(i), value=str(i))
+        producer.flush()
+
+        admin = Admin(self.redpanda)
+        leader_id = admin.get_partition_leader(namespace="kafka",
+                                               topic=topic.name,
+                                               partition=0)
+        follower_ix, follower = next(
+            (ix, n) for ix, n in enumerate(self.redpanda.nodes)
+            if self.redpanda.node_id(n) != leader_id)
+        follower_rack = f"rack-{follower_ix}"
+
+        consumer = Consumer({
+            'bootstrap.servers': self.redpanda.brokers(),
+            'group.id': 'follower-fetching',
+            'auto.offset.reset': 'earliest',
+            'client.rack': follower_rack,
+        })
+        consumer.subscribe([topic.name])
+
+        consumed = 0
+
+        def consumed_all():
+            nonlocal consumed
+            msg = consumer.poll(1.0)
+            if msg is not None and msg.error() is None:
+                consumed += 1
+            return consumed >= msg_count
+
+        wait_until(consumed_all,
+                   timeout_sec=60,
+                   backoff_sec=0,
+                   err_msg="consumer did not read all records")
+        consumer.close()
+
+        assert self._records_fetched(follower, topic.name) >= msg_count